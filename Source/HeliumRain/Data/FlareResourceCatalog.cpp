@@ -61,13 +61,23 @@ FFlareResourceDescription* UFlareResourceCatalog::Get(FName Identifier) const
 }
 
 UFlareResourceCatalogEntry* UFlareResourceCatalog::GetEntry(FFlareResourceDescription* Resource) const
+{
+	int32 ResourceIndex = GetResourceIndex(Resource);
+	if (ResourceIndex != INDEX_NONE)
+	{
+		return Resources[ResourceIndex];
+	}
+	return NULL;
+}
+
+int32 UFlareResourceCatalog::GetResourceIndex(FFlareResourceDescription* Resource) const
 {
 	for (int32 ResourceIndex = 0; ResourceIndex < Resources.Num(); ResourceIndex++)
 	{
 		if(Resource == &Resources[ResourceIndex]->Data)
 		{
-			return Resources[ResourceIndex];
+			return ResourceIndex;
 		}
 	}
-	return NULL;
+	return INDEX_NONE;
 }
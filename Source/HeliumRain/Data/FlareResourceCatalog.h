@@ -39,6 +39,9 @@ public:
 	/** Get a resource from identifier */
 	UFlareResourceCatalogEntry* GetEntry(FFlareResourceDescription*) const;
 
+	/** Get the index of a resource in the resource list */
+	int32 GetResourceIndex(FFlareResourceDescription* Resource) const;
+
 	/** Get all resources */
 	TArray<UFlareResourceCatalogEntry*>& GetResourceList()
 	{
@@ -72,6 +72,8 @@ void UFlareCargoBay::Load(UFlareSimulatedSpacecraft* ParentSpacecraft, TArray<FF
 
 		CargoBay.Add(Cargo);
 	}
+
+	UpdateSummary();
 }
 
 
@@ -115,32 +117,12 @@ TArray<FFlareCargoSave>* UFlareCargoBay::Save()
 
 bool UFlareCargoBay::HasResources(FFlareResourceDescription* Resource, int32 Quantity, UFlareCompany* Client)
 {
-	int32 PresentQuantity = 0;
-
 	if (Quantity == 0)
 	{
 		return true;
 	}
 
-	for (int CargoIndex = 0; CargoIndex < CargoBay.Num() ; CargoIndex++)
-	{
-		FFlareCargo* Cargo = &CargoBay[CargoIndex];
-
-		if(!CheckRestriction(Cargo, Client))
-		{
-			continue;
-		}
-
-		if (Cargo->Resource == Resource)
-		{
-			PresentQuantity += Cargo->Quantity;
-			if (PresentQuantity >= Quantity)
-			{
-				return true;
-			}
-		}
-	}
-	return false;
+	return GetResourceQuantity(Resource, Client) >= Quantity;
 }
 
 int32 UFlareCargoBay::TakeResources(FFlareResourceDescription* Resource, int32 Quantity, UFlareCompany* Client)
@@ -180,6 +162,7 @@ int32 UFlareCargoBay::TakeResources(FFlareResourceDescription* Resource, int32 Q
 		int32 TakenQuantity = FMath::Min(MinQuantityCargo->Quantity, QuantityToTake);
 		if (TakenQuantity > 0)
 		{
+			UpdateSlotSummary(*MinQuantityCargo, -1);
 			MinQuantityCargo->Quantity -= TakenQuantity;
 			QuantityToTake -= TakenQuantity;
 
@@ -187,6 +170,7 @@ int32 UFlareCargoBay::TakeResources(FFlareResourceDescription* Resource, int32 Q
 			{
 				MinQuantityCargo->Resource = NULL;
 			}
+			UpdateSlotSummary(*MinQuantityCargo, 1);
 
 			if (QuantityToTake == 0)
 			{
@@ -209,6 +193,7 @@ int32 UFlareCargoBay::TakeResources(FFlareResourceDescription* Resource, int32 Q
 			int32 TakenQuantity = FMath::Min(Cargo.Quantity, QuantityToTake);
 			if (TakenQuantity > 0)
 			{
+				UpdateSlotSummary(Cargo, -1);
 				Cargo.Quantity -= TakenQuantity;
 				QuantityToTake -= TakenQuantity;
 
@@ -216,6 +201,7 @@ int32 UFlareCargoBay::TakeResources(FFlareResourceDescription* Resource, int32 Q
 				{
 					Cargo.Resource = NULL;
 				}
+				UpdateSlotSummary(Cargo, 1);
 
 				if (QuantityToTake == 0)
 				{
@@ -229,11 +215,13 @@ int32 UFlareCargoBay::TakeResources(FFlareResourceDescription* Resource, int32 Q
 
 void UFlareCargoBay::DumpCargo(FFlareCargo* Cargo)
 {
+	UpdateSlotSummary(*Cargo, -1);
 	Cargo->Quantity = 0;
 	if (Cargo->Lock == EFlareResourceLock::NoLock)
 	{
 		Cargo->Resource = NULL;
 	}
+	UpdateSlotSummary(*Cargo, 1);
 }
 
 int32 UFlareCargoBay::GiveResources(FFlareResourceDescription* Resource, int32 Quantity, UFlareCompany* Client)
@@ -261,7 +249,9 @@ int32 UFlareCargoBay::GiveResources(FFlareResourceDescription* Resource, int32 Q
 			int32 GivenQuantity = FMath::Min(AvailableCapacity, QuantityToGive);
 			if (GivenQuantity > 0)
 			{
+				UpdateSlotSummary(Cargo, -1);
 				Cargo.Quantity += GivenQuantity;
+				UpdateSlotSummary(Cargo, 1);
 				QuantityToGive -= GivenQuantity;
 
 				if (QuantityToGive == 0)
@@ -287,8 +277,10 @@ int32 UFlareCargoBay::GiveResources(FFlareResourceDescription* Resource, int32 Q
 			int32 GivenQuantity = FMath::Min(GetSlotCapacity(), QuantityToGive);
 			if (GivenQuantity > 0)
 			{
+				UpdateSlotSummary(Cargo, -1);
 				Cargo.Quantity += GivenQuantity;
 				Cargo.Resource = Resource;
+				UpdateSlotSummary(Cargo, 1);
 
 				QuantityToGive -= GivenQuantity;
 
@@ -356,20 +348,17 @@ int32 UFlareCargoBay::GetFreeCargoSpace() const
 
 int32 UFlareCargoBay::GetResourceQuantity(FFlareResourceDescription* Resource, UFlareCompany* Client) const
 {
-	int32 Quantity = 0;
-
-	for (int CargoIndex = 0; CargoIndex < CargoBay.Num() ; CargoIndex++)
+	const FFlareCargoBayResourceSummary* Summary = ResourceSummaries.Find(Resource);
+	if (!Summary)
 	{
-		const FFlareCargo& Cargo = CargoBay[CargoIndex];
-		if (Cargo.Resource == Resource)
-		{
-			if(!CheckRestriction(&Cargo, Client))
-			{
-				continue;
-			}
+		return 0;
+	}
 
-			Quantity += Cargo.Quantity;
-		}
+	int32 Quantity = 0;
+	int32 ClassCount = GetRestrictionClassCount(Client);
+	for (int32 ClassIndex = 0; ClassIndex < ClassCount; ClassIndex++)
+	{
+		Quantity += Summary->Quantity[ClassIndex];
 	}
 
 	return Quantity;
@@ -377,24 +366,18 @@ int32 UFlareCargoBay::GetResourceQuantity(FFlareResourceDescription* Resource, U
 
 int32 UFlareCargoBay::GetFreeSpaceForResource(FFlareResourceDescription* Resource, UFlareCompany* Client) const
 {
+	const FFlareCargoBayResourceSummary* Summary = ResourceSummaries.Find(Resource);
+	int32 SlotCapacity = GetSlotCapacity();
 	int32 Quantity = 0;
 
-	for (int CargoIndex = 0; CargoIndex < CargoBay.Num() ; CargoIndex++)
+	int32 ClassCount = GetRestrictionClassCount(Client);
+	for (int32 ClassIndex = 0; ClassIndex < ClassCount; ClassIndex++)
 	{
-		const FFlareCargo& Cargo = CargoBay[CargoIndex];
-
-		if(!CheckRestriction(&Cargo, Client))
-		{
-			continue;
-		}
+		Quantity += EmptySlotSummary.SlotCount[ClassIndex] * SlotCapacity;
 
-		if (Cargo.Resource == NULL)
-		{
-			Quantity += GetSlotCapacity();
-		}
-		else if (Cargo.Resource == Resource)
+		if (Summary)
 		{
-			Quantity += GetSlotCapacity() - Cargo.Quantity;
+			Quantity += Summary->SlotCount[ClassIndex] * SlotCapacity - Summary->Quantity[ClassIndex];
 		}
 	}
 
@@ -403,15 +386,7 @@ int32 UFlareCargoBay::GetFreeSpaceForResource(FFlareResourceDescription* Resourc
 
 bool UFlareCargoBay::HasRestrictions() const
 {
-	for (int CargoIndex = 0; CargoIndex < CargoBay.Num() ; CargoIndex++)
-	{
-		const FFlareCargo& Cargo = CargoBay[CargoIndex];
-		if(Cargo.Restriction != EFlareResourceRestriction::Everybody)
-		{
-			return true;
-		}
-	}
-	return false;
+	return RestrictedSlotCount > 0;
 }
 
 int32 UFlareCargoBay::GetSlotCount() const
@@ -441,6 +416,7 @@ bool UFlareCargoBay::LockSlot(FFlareResourceDescription* Resource, EFlareResourc
 
 		if (Cargo.Lock == EFlareResourceLock::NoLock && (Cargo.Resource == NULL || Cargo.Resource == Resource))
 		{
+			UpdateSlotSummary(Cargo, -1);
 			Cargo.Lock = LockType;
 			Cargo.ManualLock = ManualLock;
 
@@ -449,6 +425,7 @@ bool UFlareCargoBay::LockSlot(FFlareResourceDescription* Resource, EFlareResourc
 				Cargo.Resource = Resource;
 				Cargo.Quantity = 0;
 			}
+			UpdateSlotSummary(Cargo, 1);
 			return true;
 		}
 	}
@@ -469,6 +446,7 @@ void UFlareCargoBay::UnlockAll(bool IgnoreManualLock)
 				continue;
 			}
 
+			UpdateSlotSummary(Cargo, -1);
 			Cargo.Lock = EFlareResourceLock::NoLock;
 			Cargo.ManualLock = false;
 
@@ -476,6 +454,7 @@ void UFlareCargoBay::UnlockAll(bool IgnoreManualLock)
 			{
 				Cargo.Resource = NULL;
 			}
+			UpdateSlotSummary(Cargo, 1);
 		}
 	}
 }
@@ -485,28 +464,23 @@ void UFlareCargoBay::SetSlotRestriction(int32 SlotIndex, EFlareResourceRestricti
 	if(SlotIndex >= CargoBay.Num())
 	{
 		FLOGV("Invalid index %d for set slot restriction (cargo bay size: %d)", SlotIndex, CargoBay.Num());
+		return;
 	}
-	CargoBay[SlotIndex].Restriction = RestrictionType;
+
+	FFlareCargo& Cargo = CargoBay[SlotIndex];
+	UpdateSlotSummary(Cargo, -1);
+	Cargo.Restriction = RestrictionType;
+	UpdateSlotSummary(Cargo, 1);
 }
 
 bool UFlareCargoBay::WantSell(FFlareResourceDescription* Resource, UFlareCompany* Client) const
 {
-	for (int CargoIndex = 0; CargoIndex < CargoBay.Num() ; CargoIndex++)
-	{
-		const FFlareCargo& Cargo = CargoBay[CargoIndex];
-		if(Cargo.Resource != NULL && Cargo.Resource != Resource)
-		{
-			continue;
-		}
+	const FFlareCargoBayResourceSummary* Summary = ResourceSummaries.Find(Resource);
 
-		if(!CheckRestriction(&Cargo, Client))
-		{
-			continue;
-		}
-
-		if(Cargo.Lock == EFlareResourceLock::NoLock ||
-				Cargo.Lock == EFlareResourceLock::Output ||
-				Cargo.Lock == EFlareResourceLock::Trade)
+	int32 ClassCount = GetRestrictionClassCount(Client);
+	for (int32 ClassIndex = 0; ClassIndex < ClassCount; ClassIndex++)
+	{
+		if (EmptySlotSummary.SellSlotCount[ClassIndex] > 0 || (Summary && Summary->SellSlotCount[ClassIndex] > 0))
 		{
 			return true;
 		}
@@ -517,26 +491,17 @@ bool UFlareCargoBay::WantSell(FFlareResourceDescription* Resource, UFlareCompany
 
 bool UFlareCargoBay::WantBuy(FFlareResourceDescription* Resource, UFlareCompany* Client) const
 {
-	for (int CargoIndex = 0; CargoIndex < CargoBay.Num() ; CargoIndex++)
-	{
-		const FFlareCargo& Cargo = CargoBay[CargoIndex];
-		if(Cargo.Resource != NULL && Cargo.Resource != Resource)
-		{
-			continue;
-		}
+	const FFlareCargoBayResourceSummary* Summary = ResourceSummaries.Find(Resource);
 
-		if(!CheckRestriction(&Cargo, Client))
-		{
-			continue;
-		}
-
-		if(Cargo.Lock == EFlareResourceLock::NoLock ||
-				Cargo.Lock == EFlareResourceLock::Input||
-				Cargo.Lock == EFlareResourceLock::Trade)
+	int32 ClassCount = GetRestrictionClassCount(Client);
+	for (int32 ClassIndex = 0; ClassIndex < ClassCount; ClassIndex++)
+	{
+		if (EmptySlotSummary.BuySlotCount[ClassIndex] > 0 || (Summary && Summary->BuySlotCount[ClassIndex] > 0))
 		{
 			return true;
 		}
 	}
+
 	return false;
 }
 
@@ -559,3 +524,72 @@ bool UFlareCargoBay::CheckRestriction(const FFlareCargo* Cargo, UFlareCompany* C
 	}
 	return true;
 }
+
+int32 UFlareCargoBay::GetRestrictionClassCount(UFlareCompany* Client) const
+{
+	// Restriction classes are ordered from the most open to the most closed
+	if (!Client)
+	{
+		return EFlareResourceRestriction::Nobody + 1;
+	}
+	else if (Client == Parent->GetCompany())
+	{
+		return EFlareResourceRestriction::OwnerOnly + 1;
+	}
+	else
+	{
+		return EFlareResourceRestriction::Everybody + 1;
+	}
+}
+
+
+/*----------------------------------------------------
+	Summary
+----------------------------------------------------*/
+
+void UFlareCargoBay::UpdateSummary()
+{
+	ResourceSummaries.Empty();
+	EmptySlotSummary = FFlareCargoBayResourceSummary();
+	RestrictedSlotCount = 0;
+
+	for (int CargoIndex = 0; CargoIndex < CargoBay.Num() ; CargoIndex++)
+	{
+		UpdateSlotSummary(CargoBay[CargoIndex], 1);
+	}
+}
+
+void UFlareCargoBay::UpdateSlotSummary(const FFlareCargo& Cargo, int32 Sign)
+{
+	// Stock is part of the company value
+	if (Parent && Parent->GetCompany())
+	{
+		Parent->GetCompany()->InvalidateCompanyValue();
+		Parent->GetGame()->GetWorldEvents().Notify(EFlareWorldEvent::Cargo);
+	}
+
+	FFlareCargoBayResourceSummary& Summary = (Cargo.Resource ? ResourceSummaries.FindOrAdd(Cargo.Resource) : EmptySlotSummary);
+	int32 ClassIndex = Cargo.Restriction;
+
+	Summary.Quantity[ClassIndex] += Sign * Cargo.Quantity;
+	Summary.SlotCount[ClassIndex] += Sign;
+
+	if (Cargo.Lock == EFlareResourceLock::NoLock ||
+			Cargo.Lock == EFlareResourceLock::Output ||
+			Cargo.Lock == EFlareResourceLock::Trade)
+	{
+		Summary.SellSlotCount[ClassIndex] += Sign;
+	}
+
+	if (Cargo.Lock == EFlareResourceLock::NoLock ||
+			Cargo.Lock == EFlareResourceLock::Input ||
+			Cargo.Lock == EFlareResourceLock::Trade)
+	{
+		Summary.BuySlotCount[ClassIndex] += Sign;
+	}
+
+	if (Cargo.Restriction != EFlareResourceRestriction::Everybody)
+	{
+		RestrictedSlotCount += Sign;
+	}
+}
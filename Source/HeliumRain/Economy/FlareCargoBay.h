@@ -7,6 +7,28 @@ struct FFlareCargo;
 struct FFlareResourceDescription;
 
 
+/** Cargo bay totals for one resource, split by slot restriction */
+struct FFlareCargoBayResourceSummary
+{
+	FFlareCargoBayResourceSummary()
+	{
+		FMemory::Memzero(*this);
+	}
+
+	/** Stored quantity */
+	int32 Quantity[EFlareResourceRestriction::Nobody + 1];
+
+	/** Number of slots holding the resource */
+	int32 SlotCount[EFlareResourceRestriction::Nobody + 1];
+
+	/** Number of slots accepting to sell the resource */
+	int32 SellSlotCount[EFlareResourceRestriction::Nobody + 1];
+
+	/** Number of slots accepting to buy the resource */
+	int32 BuySlotCount[EFlareResourceRestriction::Nobody + 1];
+};
+
+
 UCLASS()
 class HELIUMRAIN_API UFlareCargoBay : public UObject
 {
@@ -48,6 +70,15 @@ public:
 
 protected:
 
+	/** Rebuild the per-resource summary from the slots */
+	void UpdateSummary();
+
+	/** Add (Sign = 1) or remove (Sign = -1) a slot contribution to the summary */
+	void UpdateSlotSummary(const FFlareCargo& Cargo, int32 Sign);
+
+	/** Get the number of restriction classes visible to a client, in enum order */
+	int32 GetRestrictionClassCount(UFlareCompany* Client) const;
+
 	/*----------------------------------------------------
 	   Protected data
 	----------------------------------------------------*/
@@ -58,6 +89,11 @@ protected:
 
 	TArray<FFlareCargo>                        CargoBay;
 
+	// Summary cache, kept in sync with the slots
+	TMap<FFlareResourceDescription*, FFlareCargoBayResourceSummary> ResourceSummaries;
+	FFlareCargoBayResourceSummary              EmptySlotSummary;
+	int32                                      RestrictedSlotCount;
+
 	// Cache
 	int32								       CargoBayCount;
 	int32								       CargoBayBaseCapacity;
@@ -90,7 +126,7 @@ public:
 
 	FFlareCargo* GetSlot(int32 Index);
 
-	TArray<FFlareCargo>& GetSlots()
+	const TArray<FFlareCargo>& GetSlots() const
 	{
 		return CargoBay;
 	}
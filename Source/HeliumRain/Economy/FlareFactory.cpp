@@ -159,12 +159,20 @@ void UFlareFactory::Start()
 		FactoryData.OrderShipCompany = NAME_None;
 		FactoryData.OrderShipClass = NAME_None;
 		FactoryData.OrderShipAdvancePayment = 0;
+
+		if (Parent->GetCurrentSector())
+		{
+			Parent->GetCurrentSector()->InvalidateMarket();
+		}
 	}
+
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Spacecrafts);
 }
 
 void UFlareFactory::Pause()
 {
 	FactoryData.Active = false;
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Spacecrafts);
 }
 
 void UFlareFactory::Stop()
@@ -176,11 +184,13 @@ void UFlareFactory::Stop()
 void UFlareFactory::SetInfiniteCycle(bool Mode)
 {
 	FactoryData.InfiniteCycle = Mode;
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Spacecrafts);
 }
 
 void UFlareFactory::SetCycleCount(uint32 Count)
 {
 	FactoryData.CycleCount = Count;
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Spacecrafts);
 }
 
 void UFlareFactory::SetOutputLimit(FFlareResourceDescription* Resource, uint32 MaxSlot)
@@ -203,6 +213,8 @@ void UFlareFactory::SetOutputLimit(FFlareResourceDescription* Resource, uint32 M
 		NewCargoLimit.Quantity = MaxSlot;
 		FactoryData.OutputCargoLimit.Add(NewCargoLimit);
 	}
+
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Spacecrafts);
 }
 
 void UFlareFactory::ClearOutputLimit(FFlareResourceDescription* Resource)
@@ -212,6 +224,7 @@ void UFlareFactory::ClearOutputLimit(FFlareResourceDescription* Resource)
 		if (FactoryData.OutputCargoLimit[CargoLimitIndex].ResourceIdentifier == Resource->Identifier)
 		{
 			FactoryData.OutputCargoLimit.RemoveAt(CargoLimitIndex);
+			Game->GetWorldEvents().Notify(EFlareWorldEvent::Spacecrafts);
 			return;
 		}
 	}
@@ -272,6 +285,7 @@ void UFlareFactory::OrderShip(UFlareCompany* OrderCompany, FName ShipIdentifier)
 		Game->GetQuestManager()->OnEvent(FFlareBundle().PutTag("order-ship").PutInt32("size", Size));
 	}
 
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Spacecrafts);
 }
 
 void UFlareFactory::CancelOrder()
@@ -285,6 +299,7 @@ void UFlareFactory::CancelOrder()
 	FactoryData.OrderShipClass = NAME_None;
 	FactoryData.OrderShipCompany = NAME_None;
 	FactoryData.OrderShipAdvancePayment = 0;
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Spacecrafts);
 }
 
 bool UFlareFactory::HasCostReserved()
@@ -461,6 +476,9 @@ void UFlareFactory::BeginProduction()
 		}
 	}
 
+	// Reserved resources are part of the company value
+	Parent->GetCompany()->InvalidateCompanyValue();
+
 	FactoryData.CostReserved = GetProductionCost();
 }
 
@@ -485,10 +503,18 @@ void UFlareFactory::CancelProduction()
 			FactoryData.ResourceReserved[ReservedResourceIndex].Quantity -= GivenQuantity;
 		}
 	}
+	Parent->GetCompany()->InvalidateCompanyValue();
 
 	FactoryData.ProductedDuration = 0;
 	FactoryData.TargetShipClass = NAME_None;
 	FactoryData.TargetShipCompany = NAME_None;
+
+	if (Parent->GetCurrentSector())
+	{
+		Parent->GetCurrentSector()->InvalidateMarket();
+	}
+
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Spacecrafts);
 }
 
 void UFlareFactory::DoProduction()
@@ -520,6 +546,9 @@ void UFlareFactory::DoProduction()
 		}
 	}
 
+	// Consumed reserved resources are no longer part of the company value
+	Parent->GetCompany()->InvalidateCompanyValue();
+
 	// Generate output resources
 	TArray<FFlareFactoryResource> OutputResources = GetLimitedOutputResources();
 	for (int32 ResourceIndex = 0 ; ResourceIndex < OutputResources.Num() ; ResourceIndex++)
@@ -628,6 +657,11 @@ void UFlareFactory::PerformCreateShipAction(const FFlareFactoryAction* Action)
 	FactoryData.TargetShipClass = NAME_None;
 	FactoryData.TargetShipCompany = NAME_None;
 
+	if (Parent->GetCurrentSector())
+	{
+		Parent->GetCurrentSector()->InvalidateMarket();
+	}
+
 	if (FactoryData.OrderShipCompany == NAME_None)
 	{
 		// No more ship to produce
@@ -998,6 +1032,30 @@ uint32 UFlareFactory::GetOutputResourceQuantity(FFlareResourceDescription* Resou
 
 
 FText UFlareFactory::GetFactoryCycleCost(const FFlareProductionData* Data)
+{
+	return CycleCostText.Get(Game->GetWorldEvents(), Data, [=]()
+	{
+		return ComputeFactoryCycleCost(Data);
+	});
+}
+
+FText UFlareFactory::GetFactoryCycleInfo()
+{
+	return CycleInfoText.Get(Game->GetWorldEvents(), this, [this]()
+	{
+		return ComputeFactoryCycleInfo();
+	});
+}
+
+FText UFlareFactory::GetFactoryStatus()
+{
+	return StatusText.Get(Game->GetWorldEvents(), this, [this]()
+	{
+		return ComputeFactoryStatus();
+	});
+}
+
+FText UFlareFactory::ComputeFactoryCycleCost(const FFlareProductionData* Data)
 {
 	FText ProductionCostText;
 	FText CommaTextReference = LOCTEXT("Comma", " +");
@@ -1023,7 +1081,7 @@ FText UFlareFactory::GetFactoryCycleCost(const FFlareProductionData* Data)
 	return ProductionCostText;
 }
 
-FText UFlareFactory::GetFactoryCycleInfo()
+FText UFlareFactory::ComputeFactoryCycleInfo()
 {
 	FText CommaTextReference = LOCTEXT("Comma", " +");
 	FText ProductionOutputText;
@@ -1034,7 +1092,7 @@ FText UFlareFactory::GetFactoryCycleInfo()
 		return LOCTEXT("SelectShipClass", "No ship in construction.");
 	}
 
-	FText ProductionCostText = GetFactoryCycleCost(&GetCycleData());
+	FText ProductionCostText = ComputeFactoryCycleCost(&GetCycleData());
 
 	// Cycle output in factory actions
 	for (int ActionIndex = 0; ActionIndex < GetDescription()->OutputActions.Num(); ActionIndex++)
@@ -1090,7 +1148,7 @@ FText UFlareFactory::GetFactoryCycleInfo()
 		FText::FromString(*UFlareGameTools::FormatDate(GetProductionTime(GetCycleData()), 2))); // FString needed here
 }
 
-FText UFlareFactory::GetFactoryStatus()
+FText UFlareFactory::ComputeFactoryStatus()
 {
 	FText ProductionStatusText;
 
@@ -3,6 +3,7 @@
 #include "FlareResource.h"
 #include "../Data/FlareResourceCatalogEntry.h"
 #include "../Game/FlareWorld.h"
+#include "../Game/FlareWorldEvents.h"
 #include "FlareFactory.generated.h"
 
 class UFlareSimulatedSpacecraft;
@@ -82,6 +83,16 @@ public:
 
 protected:
 
+	/** Build this factory's cycle costs */
+	FText ComputeFactoryCycleCost(const FFlareProductionData* Data);
+
+	/** Build this factory's cycle data */
+	FText ComputeFactoryCycleInfo();
+
+	/** Build this factory's status text */
+	FText ComputeFactoryStatus();
+
+
 	/*----------------------------------------------------
 	   Protected data
 	----------------------------------------------------*/
@@ -99,6 +110,11 @@ protected:
 	FFlareProductionData CycleCostCache;
 	int32 CycleCostCacheLevel;
 
+	// Texts shown by menus
+	FFlareCachedText                         CycleCostText;
+	FFlareCachedText                         CycleInfoText;
+	FFlareCachedText                         StatusText;
+
 public:
 
 	FFlareFactoryDescription           ConstructionFactoryDescription;
@@ -20,6 +20,25 @@ UFlarePeople::UFlarePeople(const FObjectInitializer& ObjectInitializer)
 {
 }
 
+/*----------------------------------------------------
+   Needs
+----------------------------------------------------*/
+
+// All in kg and kg/hab
+
+static const FFlarePeopleNeedDescription PeopleNeeds[EFlarePeopleNeed::Count] =
+{
+	// Resource   Min   Stock  Happiness  Sadness  Max price ratio
+	{ TEXT("food"),  1.0f, 20,    0.1f,      10.f,    MAX_FLT },
+	{ TEXT("fuel"),  0.6f, 10,    0.6f,      4.f,     0.75f },
+	{ TEXT("tools"), 0.5f, 10,    0.5f,      2.f,     0.5f },
+	{ TEXT("tech"),  0.4f, 10,    0.4f,      1.f,     0.25f }
+};
+
+// Consumption reduction on shortage for needs of lower priority than the missing one
+static float SHORTAGE_SECONDARY_REDUCTION = 0.1f;
+
+
 /*----------------------------------------------------
    Save
 ----------------------------------------------------*/
@@ -31,6 +50,11 @@ void UFlarePeople::Load(UFlareSimulatedSector* ParentSector, const FFlarePeopleS
 
 	PeopleData = Data;
 	Parent = ParentSector;
+
+	for (int32 NeedIndex = 0; NeedIndex < EFlarePeopleNeed::Count; NeedIndex++)
+	{
+		NeedResources[NeedIndex] = Game->GetResourceCatalog()->Get(PeopleNeeds[NeedIndex].ResourceIdentifier);
+	}
 }
 
 FFlarePeopleSave* UFlarePeople::Save()
@@ -46,28 +70,6 @@ static uint32 BIRTH_POINT_TRESHOLD = 3000;
 static uint32 DEATH_POINT_TRESHOLD = 29200;
 static uint32 MONETARY_CREATION = 10000;
 
-// All in kg and kg/hab
-
-static float FOOD_MIN_CONSUMPTION = 1;
-static float FUEL_MIN_CONSUMPTION = 0.6;
-static float TOOL_MIN_CONSUMPTION = 0.5;
-static float TECH_MIN_CONSUMPTION = 0.4;
-
-static int32 FOOD_NEED_STOCK = 20;
-static int32 FUEL_NEED_STOCK = 10;
-static int32 TOOL_NEED_STOCK = 10;
-static int32 TECH_NEED_STOCK = 10;
-
-static float FOOD_HAPPINESS = 0.1;
-static float FUEL_HAPPINESS = 0.6;
-static float TOOL_HAPPINESS = 0.5;
-static float TECH_HAPPINESS = 0.4;
-
-static float FOOD_SADNESS = 10;
-static float FUEL_SADNESS = 4;
-static float TOOL_SADNESS = 2;
-static float TECH_SADNESS = 1;
-
 static int32 MIN_GENERAL_STOCK = 1000;
 
 void UFlarePeople::Simulate()
@@ -110,202 +112,103 @@ void UFlarePeople::Simulate()
 	PeopleData.BirthPoint = PeopleData.BirthPoint % BIRTH_POINT_TRESHOLD;
 
 
-	// Eat
-	// Each inhabitant eat 1 kg of food a day as vital food.
-	// If an inhabitant don't heat, happiness decrease heavily and  hunger is increase
-	// If some inhabitant heat, the hunger deaseapear and some happiness is gain
-	uint32 FoodConsumption = PeopleData.Population * PeopleData.FoodConsumption;
-	uint32 EatenFood = FMath::Min(FoodConsumption, PeopleData.FoodStock);
-	// Reduce stock
-	PeopleData.FoodStock -= EatenFood;
-	IncreaseHappiness(EatenFood * FOOD_HAPPINESS);
-
-	// Reduce hunger (100% if everybody eat)
-	float FeedPeopleRatio = (float) EatenFood / (float) FoodConsumption;
-
-	PeopleData.HungerPoint *= 1 - FeedPeopleRatio;
-
-	// Add hunger (0 if everybody eat)
-	uint32 Hunger = FoodConsumption - EatenFood;
-	PeopleData.HungerPoint += Hunger + PeopleData.HungerPoint / 10;
-	DecreaseHappiness(Hunger * FOOD_SADNESS);
-
-	// Fuel
-	int32 FuelConsumption = PeopleData.Population * PeopleData.FuelConsumption;
-	int32 EatenFuel = FMath::Min(FuelConsumption, PeopleData.FuelStock);
-	// Reduce stock
-	PeopleData.FuelStock -= EatenFuel;
-	IncreaseHappiness(EatenFuel * FUEL_HAPPINESS);
-
-	// Add hunger (0 if everybody eat)
-	Hunger = FuelConsumption - EatenFuel;
-	DecreaseHappiness(Hunger * FUEL_SADNESS);
-
-	// Tool
-	int32 ToolConsumption = PeopleData.Population * PeopleData.ToolConsumption;
-	int32 EatenTool = FMath::Min(ToolConsumption, PeopleData.ToolStock);
-	// Reduce stock
-	PeopleData.ToolStock -= EatenTool;
-	IncreaseHappiness(EatenTool * TOOL_HAPPINESS);
-
-
-	// Add hunger (0 if everybody eat)
-	Hunger = ToolConsumption - EatenTool;
-	DecreaseHappiness(Hunger * TOOL_SADNESS);
-
-	// Tech
-	int32 TechConsumption = PeopleData.Population * PeopleData.TechConsumption;
-	int32 EatenTech = FMath::Min(TechConsumption, PeopleData.TechStock);
-	// Reduce stock
-	PeopleData.TechStock -= EatenTech;
-	IncreaseHappiness(EatenTech * TECH_HAPPINESS);
-
-	Hunger = TechConsumption - EatenTech;
-	DecreaseHappiness(Hunger * TECH_SADNESS);
-}
+	// Consume
+	for (int32 NeedIndex = 0; NeedIndex < EFlarePeopleNeed::Count; NeedIndex++)
+	{
+		const FFlarePeopleNeedDescription& Need = PeopleNeeds[NeedIndex];
 
-void UFlarePeople::SimulateResourcePurchase()
-{
-	FFlareResourceDescription* Food = Game->GetResourceCatalog()->Get("food");
-	FFlareResourceDescription* Fuel = Game->GetResourceCatalog()->Get("fuel");
-	FFlareResourceDescription* Tool = Game->GetResourceCatalog()->Get("tools");
-	FFlareResourceDescription* Tech = Game->GetResourceCatalog()->Get("tech");
+		int64 Consumption = (int64) (PeopleData.Population * GetNeedConsumption(NeedIndex));
+		int64 Stock = GetNeedStock(NeedIndex);
+		int64 Consumed = FMath::Min(Consumption, Stock);
 
-	uint32 FoodConsumption = GetRessourceConsumption(Food, true);
-	uint32 BoughtFood = BuyResourcesInSector(Food, FoodConsumption); // In Tons
-	//if(BoughtFood)
-	//	FLOGV("People in %s bought %u food", *Parent->GetSectorName().ToString(), BoughtFood);
-	PeopleData.FoodStock += BoughtFood * 1000; // In kg
+		// Reduce stock
+		SetNeedStock(NeedIndex, Stock - Consumed);
+		IncreaseHappiness(Consumed * Need.Happiness);
 
-	if(FoodConsumption == BoughtFood)
-	{
-		PeopleData.FoodConsumption += 0.01 * FOOD_MIN_CONSUMPTION / PeopleData.FoodConsumption;
-	}
-	else
-	{
-		PeopleData.FoodConsumption -= 1.f /FOOD_NEED_STOCK * FOOD_MIN_CONSUMPTION;
-		PeopleData.FuelConsumption -= 1.f /FUEL_NEED_STOCK * FUEL_MIN_CONSUMPTION;
-		PeopleData.ToolConsumption -= 1.f /TOOL_NEED_STOCK * TOOL_MIN_CONSUMPTION;
-		PeopleData.TechConsumption -= 1.f /TECH_NEED_STOCK * TECH_MIN_CONSUMPTION;
+		// Add hunger (0 if everybody eat)
+		int64 Hunger = Consumption - Consumed;
+
+		// Each inhabitant eat 1 kg of food a day as vital food.
+		// If an inhabitant don't heat, happiness decrease heavily and  hunger is increase
+		// If some inhabitant heat, the hunger deaseapear and some happiness is gain
+		if (NeedIndex == EFlarePeopleNeed::Food)
+		{
+			// Reduce hunger (100% if everybody eat)
+			float FeedPeopleRatio = (float) Consumed / (float) Consumption;
+			PeopleData.HungerPoint *= 1 - FeedPeopleRatio;
+			PeopleData.HungerPoint += Hunger + PeopleData.HungerPoint / 10;
+		}
 
-		//TODO reputation
+		DecreaseHappiness(Hunger * Need.Sadness);
 	}
+}
 
+void UFlarePeople::SimulateResourcePurchase()
+{
+	// Find companies selling to the people, once for all resources
+	TArray<UFlareSimulatedSpacecraft*> SellingStations;
+	TArray<UFlareCompany*> SellingCompanies;
 
-	float FuelPrice = Parent->GetResourcePrice(Fuel, EFlareResourcePriceContext::Default);
-	float FuelPriceRatio = (FuelPrice - Fuel->MinPrice) / (float)(Fuel->MaxPrice - Fuel->MinPrice);
-	if(FuelPriceRatio < 0.75)
+	for (int32 SpacecraftIndex = 0; SpacecraftIndex < Parent->GetSectorStations().Num(); SpacecraftIndex++)
 	{
+		UFlareSimulatedSpacecraft* Station = Parent->GetSectorStations()[SpacecraftIndex];
 
-		uint32 FuelConsumption = GetRessourceConsumption(Fuel, true);
-		uint32 BoughtFuel = BuyResourcesInSector(Fuel, FuelConsumption); // In Tons
-		//if(BoughtFuel)
-		//	FLOGV("People in %s bought %u fuel", *Parent->GetSectorName().ToString(), BoughtFuel);
-		PeopleData.FuelStock += BoughtFuel * 1000; // In kg
-
-		if(FuelConsumption == BoughtFuel)
-		{
-			PeopleData.FuelConsumption += 0.01 * FUEL_MIN_CONSUMPTION / PeopleData.FuelConsumption;
-		}
-		else
+		if(!Station->HasCapability(EFlareSpacecraftCapability::Consumer))
 		{
-			PeopleData.FoodConsumption -= 0.1f /FOOD_NEED_STOCK * FOOD_MIN_CONSUMPTION;
-			PeopleData.FuelConsumption -= 1.f /FUEL_NEED_STOCK * FUEL_MIN_CONSUMPTION;
-			PeopleData.ToolConsumption -= 1.f /TOOL_NEED_STOCK * TOOL_MIN_CONSUMPTION;
-			PeopleData.TechConsumption -= 1.f /TECH_NEED_STOCK * TECH_MIN_CONSUMPTION;
-
-			//TODO reputation
+			continue;
 		}
+		SellingStations.Add(Station);
+		SellingCompanies.AddUnique(Station->GetCompany());
 	}
 
-	float ToolPrice = Parent->GetResourcePrice(Tool, EFlareResourcePriceContext::Default);
-	float ToolPriceRatio = (ToolPrice - Tool->MinPrice) / (float)(Tool->MaxPrice - Tool->MinPrice);
-	if(ToolPriceRatio < 0.5)
+	for (int32 NeedIndex = 0; NeedIndex < EFlarePeopleNeed::Count; NeedIndex++)
 	{
-		uint32 ToolConsumption = GetRessourceConsumption(Tool, true);
-		uint32 BoughtTool = BuyResourcesInSector(Tool, ToolConsumption); // In Tons
-		//if(BoughtTool)
-		//	FLOGV("People in %s bought %u tool", *Parent->GetSectorName().ToString(), BoughtTool);
-		PeopleData.ToolStock += BoughtTool * 1000; // In kg
+		const FFlarePeopleNeedDescription& Need = PeopleNeeds[NeedIndex];
+		FFlareResourceDescription* Resource = NeedResources[NeedIndex];
 
-		if(ToolConsumption == BoughtTool)
-		{
-			PeopleData.ToolConsumption += 0.01 * TOOL_MIN_CONSUMPTION / PeopleData.ToolConsumption;
-		}
-		else
+		// Skip expensive resources
+		float Price = Parent->GetResourcePrice(Resource, EFlareResourcePriceContext::Default);
+		float PriceRatio = (Price - Resource->MinPrice) / (float)(Resource->MaxPrice - Resource->MinPrice);
+		if (Need.MaxPriceRatio != MAX_FLT && PriceRatio >= Need.MaxPriceRatio)
 		{
-			PeopleData.FoodConsumption -= 0.1f /FOOD_NEED_STOCK * FOOD_MIN_CONSUMPTION;
-			PeopleData.FuelConsumption -= 0.1f /FUEL_NEED_STOCK * FUEL_MIN_CONSUMPTION;
-			PeopleData.ToolConsumption -= 1.f /TOOL_NEED_STOCK * TOOL_MIN_CONSUMPTION;
-			PeopleData.TechConsumption -= 1.f /TECH_NEED_STOCK * TECH_MIN_CONSUMPTION;
-
-			//TODO reputation
+			continue;
 		}
-	}
 
+		uint32 Consumption = GetRessourceConsumption(Resource, true);
+		uint32 Bought = BuyResourcesInSector(Resource, Consumption, SellingStations, SellingCompanies); // In Tons
+		SetNeedStock(NeedIndex, GetNeedStock(NeedIndex) + Bought * 1000); // In kg
 
-	float TechPrice = Parent->GetResourcePrice(Tech, EFlareResourcePriceContext::Default);
-	float TechPriceRatio = (TechPrice - Tech->MinPrice) / (float)(Tech->MaxPrice - Tech->MinPrice);
-	if(TechPriceRatio < 0.25)
-	{
-		uint32 TechConsumption = GetRessourceConsumption(Tech, true);
-		uint32 BoughtTech = BuyResourcesInSector(Tech, TechConsumption); // In Tons
-		//if(BoughtTech)
-		//	FLOGV("People in %s bought %u tech", *Parent->GetSectorName().ToString(), BoughtTech);
-		PeopleData.TechStock += BoughtTech * 1000; // In kg
-
-		if(TechConsumption == BoughtTech)
+		if(Consumption == Bought)
 		{
-			PeopleData.TechConsumption += 0.01 * TECH_MIN_CONSUMPTION / PeopleData.TechConsumption;
+			GetNeedConsumption(NeedIndex) += 0.01 * Need.MinConsumption / GetNeedConsumption(NeedIndex);
 		}
 		else
 		{
-			PeopleData.FoodConsumption -= 0.1f /FOOD_NEED_STOCK * FOOD_MIN_CONSUMPTION;
-			PeopleData.FuelConsumption -= 0.1f /FUEL_NEED_STOCK * FUEL_MIN_CONSUMPTION;
-			PeopleData.ToolConsumption -= 0.1f /TOOL_NEED_STOCK * TOOL_MIN_CONSUMPTION;
-			PeopleData.TechConsumption -= 1.f /TOOL_NEED_STOCK * TOOL_MIN_CONSUMPTION;
+			// Shortage reduces this need and, to a lesser extent, the more vital ones
+			for (int32 ReducedIndex = 0; ReducedIndex < EFlarePeopleNeed::Count; ReducedIndex++)
+			{
+				const FFlarePeopleNeedDescription& ReducedNeed = PeopleNeeds[ReducedIndex];
+				float Reduction = (ReducedIndex < NeedIndex ? SHORTAGE_SECONDARY_REDUCTION : 1.f);
+
+				GetNeedConsumption(ReducedIndex) -= Reduction / ReducedNeed.NeedStock * ReducedNeed.MinConsumption;
+			}
+
 			//TODO reputation
 		}
 	}
 
 	// TODO use setter to set consumption
-	if (PeopleData.FoodConsumption < FOOD_MIN_CONSUMPTION)
-	{
-		PeopleData.FoodConsumption = FOOD_MIN_CONSUMPTION;
-	}
-	if (PeopleData.FuelConsumption < FUEL_MIN_CONSUMPTION)
-	{
-		PeopleData.FuelConsumption = FUEL_MIN_CONSUMPTION;
-	}
-	if (PeopleData.ToolConsumption < TOOL_MIN_CONSUMPTION)
-	{
-		PeopleData.ToolConsumption = TOOL_MIN_CONSUMPTION;
-	}
-	if (PeopleData.TechConsumption < TECH_MIN_CONSUMPTION)
+	for (int32 NeedIndex = 0; NeedIndex < EFlarePeopleNeed::Count; NeedIndex++)
 	{
-		PeopleData.TechConsumption = TECH_MIN_CONSUMPTION;
-	}
-}
-
-uint32 UFlarePeople::BuyResourcesInSector(FFlareResourceDescription* Resource, uint32 Quantity)
-{
-	// Find companies selling the ressource
-
-	TArray<UFlareSimulatedSpacecraft*> SellingStations;
-	TArray<UFlareCompany*> SellingCompanies;
-
-	for (int32 SpacecraftIndex = 0; SpacecraftIndex < Parent->GetSectorStations().Num(); SpacecraftIndex++)
-	{
-		UFlareSimulatedSpacecraft* Station = Parent->GetSectorStations()[SpacecraftIndex];
-
-		if(!Station->HasCapability(EFlareSpacecraftCapability::Consumer))
+		if (GetNeedConsumption(NeedIndex) < PeopleNeeds[NeedIndex].MinConsumption)
 		{
-			continue;
+			GetNeedConsumption(NeedIndex) = PeopleNeeds[NeedIndex].MinConsumption;
 		}
-		SellingStations.Add(Station);
-		SellingCompanies.AddUnique(Station->GetCompany());
 	}
+}
 
+uint32 UFlarePeople::BuyResourcesInSector(FFlareResourceDescription* Resource, uint32 Quantity, TArray<UFlareSimulatedSpacecraft*>& SellingStations, TArray<UFlareCompany*> SellingCompanies)
+{
 	// Limit quantity to buy with money
 	uint32 BaseQuantity = FMath::Min(Quantity, PeopleData.Money / (uint32) (Parent->GetResourcePrice(Resource, EFlareResourcePriceContext::ConsumerConsumption)));
 	uint32 ResourceToBuy = BaseQuantity;
@@ -396,94 +299,83 @@ uint32 UFlarePeople::BuyInStationForCompany(FFlareResourceDescription* Resource,
 
 float UFlarePeople::GetRessourceConsumption(FFlareResourceDescription* Resource, bool WithStock)
 {
-	FFlareResourceDescription* Food = Game->GetResourceCatalog()->Get("food");
-	FFlareResourceDescription* Fuel = Game->GetResourceCatalog()->Get("fuel");
-	FFlareResourceDescription* Tools = Game->GetResourceCatalog()->Get("tools");
-	FFlareResourceDescription* Tech = Game->GetResourceCatalog()->Get("tech");
+	int32 NeedIndex = GetNeedIndex(Resource);
 
-	if (PeopleData.Population == 0)
+	if (PeopleData.Population == 0 || NeedIndex == INDEX_NONE)
 	{
 		return 0;
 	}
 
-	if (Resource == Food)
-	{
-		if (PeopleData.FoodConsumption < FOOD_MIN_CONSUMPTION)
-		{
-			PeopleData.FoodConsumption = FOOD_MIN_CONSUMPTION;
-		}
+	const FFlarePeopleNeedDescription& Need = PeopleNeeds[NeedIndex];
+	float& Consumption = GetNeedConsumption(NeedIndex);
 
-		if(!WithStock)
-		{
-			return PeopleData.Population * PeopleData.FoodConsumption / 1000.f;
-		}
-
-		uint32 FoodToHave =  MIN_GENERAL_STOCK + PeopleData.Population * PeopleData.FoodConsumption * FOOD_NEED_STOCK; // In kg
-		if(FoodToHave > PeopleData.FoodStock)
-		{
-			uint32 FoodToBuy = FoodToHave - PeopleData.FoodStock;
-			return FoodToBuy / 1000.f;
-		}
-	}
-	else if (Resource == Fuel)
+	if (Consumption < Need.MinConsumption)
 	{
-		if (PeopleData.FuelConsumption < FUEL_MIN_CONSUMPTION)
-		{
-			PeopleData.FuelConsumption = FUEL_MIN_CONSUMPTION;
-		}
-
-		if(!WithStock)
-		{
-			return PeopleData.Population * PeopleData.FuelConsumption / 1000.f;
-		}
+		Consumption = Need.MinConsumption;
+	}
 
-		int32 FuelToHave =  MIN_GENERAL_STOCK + PeopleData.Population * PeopleData.FuelConsumption * FUEL_NEED_STOCK; // In kg
-		if (FuelToHave > PeopleData.FuelStock)
-		{
-			int32 FuelToBuy = FuelToHave - PeopleData.FuelStock;
-			return FuelToBuy / 1000.f;
-		}
+	if(!WithStock)
+	{
+		return PeopleData.Population * Consumption / 1000.f;
 	}
-	else if (Resource == Tools)
+
+	int64 ToHave = MIN_GENERAL_STOCK + (int64) (PeopleData.Population * Consumption * Need.NeedStock); // In kg
+	int64 Stock = GetNeedStock(NeedIndex);
+	if (ToHave > Stock)
 	{
-		if (PeopleData.ToolConsumption < TOOL_MIN_CONSUMPTION)
-		{
-			PeopleData.ToolConsumption = TOOL_MIN_CONSUMPTION;
-		}
+		return (ToHave - Stock) / 1000.f;
+	}
 
-		if(!WithStock)
-		{
-			return PeopleData.Population * PeopleData.ToolConsumption / 1000.f;
-		}
+	return 0;
+}
 
-		int32 ToolToHave =  MIN_GENERAL_STOCK + PeopleData.Population * PeopleData.ToolConsumption * TOOL_NEED_STOCK; // In kg
-		if (ToolToHave > PeopleData.ToolStock)
-		{
-			int32 ToolToBuy = ToolToHave - PeopleData.ToolStock;
-			return ToolToBuy / 1000.f;
-		}
+float& UFlarePeople::GetNeedConsumption(int32 NeedIndex)
+{
+	switch (NeedIndex)
+	{
+		case EFlarePeopleNeed::Fuel: return PeopleData.FuelConsumption;
+		case EFlarePeopleNeed::Tool: return PeopleData.ToolConsumption;
+		case EFlarePeopleNeed::Tech: return PeopleData.TechConsumption;
+		case EFlarePeopleNeed::Food:
+		default:                     return PeopleData.FoodConsumption;
 	}
-	else if (Resource == Tech)
+}
+
+int64 UFlarePeople::GetNeedStock(int32 NeedIndex) const
+{
+	switch (NeedIndex)
 	{
-		if (PeopleData.TechConsumption < TECH_MIN_CONSUMPTION)
-		{
-			PeopleData.TechConsumption = TECH_MIN_CONSUMPTION;
-		}
+		case EFlarePeopleNeed::Fuel: return PeopleData.FuelStock;
+		case EFlarePeopleNeed::Tool: return PeopleData.ToolStock;
+		case EFlarePeopleNeed::Tech: return PeopleData.TechStock;
+		case EFlarePeopleNeed::Food:
+		default:                     return PeopleData.FoodStock;
+	}
+}
 
-		if(!WithStock)
-		{
-			return PeopleData.Population * PeopleData.TechConsumption / 1000.f;
-		}
+void UFlarePeople::SetNeedStock(int32 NeedIndex, int64 Stock)
+{
+	switch (NeedIndex)
+	{
+		case EFlarePeopleNeed::Fuel: PeopleData.FuelStock = Stock; break;
+		case EFlarePeopleNeed::Tool: PeopleData.ToolStock = Stock; break;
+		case EFlarePeopleNeed::Tech: PeopleData.TechStock = Stock; break;
+		case EFlarePeopleNeed::Food:
+		default:                     PeopleData.FoodStock = Stock; break;
+	}
+}
 
-		int32 TechToHave =  MIN_GENERAL_STOCK + PeopleData.Population * PeopleData.TechConsumption * TECH_NEED_STOCK; // In kg
-		if (TechToHave > PeopleData.TechStock)
+int32 UFlarePeople::GetNeedIndex(FFlareResourceDescription* Resource) const
+{
+	for (int32 NeedIndex = 0; NeedIndex < EFlarePeopleNeed::Count; NeedIndex++)
+	{
+		if (NeedResources[NeedIndex] == Resource)
 		{
-			int32 TechToBuy = TechToHave - PeopleData.TechStock;
-			return TechToBuy / 1000.f;
+			return NeedIndex;
 		}
 	}
 
-	return 0;
+	return INDEX_NONE;
 }
 
 void UFlarePeople::GiveBirth(uint32 BirthCount)
@@ -80,6 +80,41 @@ struct FFlarePeopleSave
 };
 
 
+/** People needs, in purchase priority order */
+namespace EFlarePeopleNeed
+{
+	enum Type
+	{
+		Food,
+		Fuel,
+		Tool,
+		Tech,
+		Count
+	};
+}
+
+/** Consumption model of a people need */
+struct FFlarePeopleNeedDescription
+{
+	/** Resource identifier */
+	const TCHAR* ResourceIdentifier;
+
+	/** Minimal consumption, in kg per inhabitant per day */
+	float MinConsumption;
+
+	/** Stock to keep, in days of consumption */
+	int32 NeedStock;
+
+	/** Happiness gained per kg consumed */
+	float Happiness;
+
+	/** Happiness lost per kg missing */
+	float Sadness;
+
+	/** Price ratio (0 at min price, 1 at max price) under which people buy */
+	float MaxPriceRatio;
+};
+
 
 UCLASS()
 class HELIUMRAIN_API UFlarePeople : public UObject
@@ -105,7 +140,8 @@ public:
 
 	void SimulateResourcePurchase();
 
-	uint32 BuyResourcesInSector(FFlareResourceDescription* Resource, uint32 Quantity);
+	/** Buy a resource in the sector consumer stations, shared between companies by reputation */
+	uint32 BuyResourcesInSector(FFlareResourceDescription* Resource, uint32 Quantity, TArray<UFlareSimulatedSpacecraft*>& SellingStations, TArray<UFlareCompany*> SellingCompanies);
 
 	uint32 BuyInStationForCompany(FFlareResourceDescription* Resource, uint32 Quantity, UFlareCompany* Company, TArray<UFlareSimulatedSpacecraft*>& Stations);
 
@@ -141,8 +177,21 @@ protected:
 	   Protected data
 	----------------------------------------------------*/
 
+	/** Get the per-inhabitant consumption of a need */
+	float& GetNeedConsumption(int32 NeedIndex);
+
+	/** Get the stock of a need, in kg */
+	int64 GetNeedStock(int32 NeedIndex) const;
+
+	/** Set the stock of a need, in kg */
+	void SetNeedStock(int32 NeedIndex, int64 Stock);
+
+	/** Get the need index of a resource, or INDEX_NONE */
+	int32 GetNeedIndex(FFlareResourceDescription* Resource) const;
+
 	// Gameplay data
 	FFlarePeopleSave                         PeopleData;
+	FFlareResourceDescription*               NeedResources[EFlarePeopleNeed::Count];
 
 	AFlareGame*                              Game;
 	UFlareSimulatedSector*   				 Parent;
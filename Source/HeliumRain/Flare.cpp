@@ -1,5 +1,6 @@
 
 #include "Flare.h"
+#include "Game/FlareAllocationStats.h"
 
 
 IMPLEMENT_PRIMARY_GAME_MODULE(FFlareModule, HeliumRain, "HeliumRain");
@@ -14,6 +15,7 @@ DEFINE_LOG_CATEGORY(LogFlare)
 void FFlareModule::StartupModule()
 {
 	FDefaultGameModuleImpl::StartupModule();
+	FFlareAllocationStats::Initialize();
 	FSlateStyleRegistry::UnRegisterSlateStyle("FlareStyle");
 	StyleInstance.Initialize();
 }
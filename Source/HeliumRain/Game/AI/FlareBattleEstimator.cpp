@@ -0,0 +1,212 @@
+
+#include "../../Flare.h"
+#include "FlareBattleEstimator.h"
+
+#include "../FlareCompany.h"
+#include "../FlareSimulatedSector.h"
+#include "../../Spacecrafts/FlareSimulatedSpacecraft.h"
+
+DECLARE_CYCLE_STAT(TEXT("FlareBattleEstimator EstimateBattle"), STAT_FlareBattleEstimator_EstimateBattle, STATGROUP_Flare);
+
+
+// Number of new battles a company may estimate each day, so that the AI stays deterministic
+#define BATTLE_ESTIMATE_DAILY_BUDGET 200
+
+// Turns simulated before calling the fight a stalemate
+#define BATTLE_ESTIMATE_MAX_TURNS 50
+
+// Share of its firepower a fleet inflicts as damage each turn
+#define BATTLE_ESTIMATE_DAMAGE_RATIO 0.1f
+
+// Efficiency of weapons against the other hull size : heavy weapons rarely hit small ships
+#define BATTLE_ESTIMATE_ANTI_LARGE_VS_SMALL 0.1f
+#define BATTLE_ESTIMATE_ANTI_SMALL_VS_LARGE 0.5f
+
+// Advantage returned for a fight against nobody
+#define BATTLE_ESTIMATE_MAX_ADVANTAGE 1000.f
+
+
+/*----------------------------------------------------
+	Snapshot
+----------------------------------------------------*/
+
+void FFlareBattleFleetSnapshot::AddShip(UFlareSimulatedSpacecraft* Ship)
+{
+	int32 ShipCombatPoints = Ship->GetCombatPoints(true);
+	if (ShipCombatPoints == 0)
+	{
+		return;
+	}
+
+	if (Ship->GetSize() == EFlarePartSize::L)
+	{
+		LargeShipCount++;
+		LargeShipCombatPoints += ShipCombatPoints;
+	}
+	else
+	{
+		SmallShipCount++;
+		SmallShipCombatPoints += ShipCombatPoints;
+	}
+
+	if (Ship->GetWeaponsSystem()->HasAntiSmallShipWeapon())
+	{
+		AntiSmallCombatPoints += ShipCombatPoints;
+	}
+
+	if (Ship->GetWeaponsSystem()->HasAntiLargeShipWeapon())
+	{
+		AntiLargeCombatPoints += ShipCombatPoints;
+	}
+}
+
+
+/*----------------------------------------------------
+	Public API
+----------------------------------------------------*/
+
+UFlareBattleEstimator::UFlareBattleEstimator(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, Company(NULL)
+	, EstimateCount(0)
+{
+}
+
+void UFlareBattleEstimator::Load(UFlareCompany* ParentCompany)
+{
+	Company = ParentCompany;
+	ResetCache();
+}
+
+void UFlareBattleEstimator::ResetCache()
+{
+	Estimates.Empty();
+	HostileFleets.Empty();
+	EstimateCount = 0;
+}
+
+bool UFlareBattleEstimator::EstimateBattle(const FFlareBattleFleetSnapshot& Attackers, UFlareSimulatedSector* Sector, FFlareBattleEstimate& Estimate)
+{
+	FFlareBattleEstimateKey Key;
+	Key.Attackers = Attackers;
+	Key.Sector = Sector;
+
+	FFlareBattleEstimate* CachedEstimate = Estimates.Find(Key);
+	if (CachedEstimate)
+	{
+		Estimate = *CachedEstimate;
+		return true;
+	}
+
+	if (EstimateCount >= BATTLE_ESTIMATE_DAILY_BUDGET)
+	{
+		return false;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_FlareBattleEstimator_EstimateBattle);
+
+	Estimate = ComputeBattle(Attackers, GetHostileFleet(Sector));
+	Estimates.Add(Key, Estimate);
+
+	EstimateCount++;
+	return true;
+}
+
+const FFlareBattleFleetSnapshot& UFlareBattleEstimator::GetHostileFleet(UFlareSimulatedSector* Sector)
+{
+	FFlareBattleFleetSnapshot* CachedFleet = HostileFleets.Find(Sector);
+	if (CachedFleet)
+	{
+		return *CachedFleet;
+	}
+
+	FFlareBattleFleetSnapshot Fleet;
+	for (UFlareSimulatedSpacecraft* Ship : Sector->GetSectorShips())
+	{
+		if (Ship->IsMilitary() && Ship->GetCompany()->GetWarState(Company) == EFlareHostility::Hostile)
+		{
+			Fleet.AddShip(Ship);
+		}
+	}
+
+	return HostileFleets.Add(Sector, Fleet);
+}
+
+FFlareBattleEstimate UFlareBattleEstimator::ComputeBattle(const FFlareBattleFleetSnapshot& Attackers, const FFlareBattleFleetSnapshot& Defenders)
+{
+	FFlareBattleEstimate Estimate;
+	Estimate.AttackerRemainingRatio = (Attackers.GetCombatPoints() > 0 ? 1.f : 0.f);
+	Estimate.DefenderRemainingRatio = (Defenders.GetCombatPoints() > 0 ? 1.f : 0.f);
+
+	if (Defenders.GetCombatPoints() == 0)
+	{
+		Estimate.Advantage = (Attackers.GetCombatPoints() > 0 ? BATTLE_ESTIMATE_MAX_ADVANTAGE : 1.f);
+		return Estimate;
+	}
+	else if (Attackers.GetCombatPoints() == 0)
+	{
+		Estimate.Advantage = 0;
+		return Estimate;
+	}
+
+	// Remaining hull health of each side
+	float AttackerSmall = Attackers.SmallShipCombatPoints;
+	float AttackerLarge = Attackers.LargeShipCombatPoints;
+	float DefenderSmall = Defenders.SmallShipCombatPoints;
+	float DefenderLarge = Defenders.LargeShipCombatPoints;
+
+	for (int32 Turn = 0; Turn < BATTLE_ESTIMATE_MAX_TURNS; Turn++)
+	{
+		// Firepower decreases as ships are destroyed
+		float AttackerRatio = (AttackerSmall + AttackerLarge) / Attackers.GetCombatPoints();
+		float DefenderRatio = (DefenderSmall + DefenderLarge) / Defenders.GetCombatPoints();
+
+		float AttackerAntiSmall = Attackers.AntiSmallCombatPoints * AttackerRatio * BATTLE_ESTIMATE_DAMAGE_RATIO;
+		float AttackerAntiLarge = Attackers.AntiLargeCombatPoints * AttackerRatio * BATTLE_ESTIMATE_DAMAGE_RATIO;
+		float DefenderAntiSmall = Defenders.AntiSmallCombatPoints * DefenderRatio * BATTLE_ESTIMATE_DAMAGE_RATIO;
+		float DefenderAntiLarge = Defenders.AntiLargeCombatPoints * DefenderRatio * BATTLE_ESTIMATE_DAMAGE_RATIO;
+
+		// Each weapon class fires at its preferred hull size, and at the other one when nothing is left
+		float DamageToDefenderSmall = (DefenderSmall > 0 ? AttackerAntiSmall + (DefenderLarge > 0 ? 0 : AttackerAntiLarge * BATTLE_ESTIMATE_ANTI_LARGE_VS_SMALL) : 0);
+		float DamageToDefenderLarge = (DefenderLarge > 0 ? AttackerAntiLarge + (DefenderSmall > 0 ? 0 : AttackerAntiSmall * BATTLE_ESTIMATE_ANTI_SMALL_VS_LARGE) : 0);
+		float DamageToAttackerSmall = (AttackerSmall > 0 ? DefenderAntiSmall + (AttackerLarge > 0 ? 0 : DefenderAntiLarge * BATTLE_ESTIMATE_ANTI_LARGE_VS_SMALL) : 0);
+		float DamageToAttackerLarge = (AttackerLarge > 0 ? DefenderAntiLarge + (AttackerSmall > 0 ? 0 : DefenderAntiSmall * BATTLE_ESTIMATE_ANTI_SMALL_VS_LARGE) : 0);
+
+		if (DamageToDefenderSmall + DamageToDefenderLarge + DamageToAttackerSmall + DamageToAttackerLarge <= 0)
+		{
+			// Nobody can hurt anybody
+			break;
+		}
+
+		DefenderSmall = FMath::Max(0.f, DefenderSmall - DamageToDefenderSmall);
+		DefenderLarge = FMath::Max(0.f, DefenderLarge - DamageToDefenderLarge);
+		AttackerSmall = FMath::Max(0.f, AttackerSmall - DamageToAttackerSmall);
+		AttackerLarge = FMath::Max(0.f, AttackerLarge - DamageToAttackerLarge);
+
+		if (AttackerSmall + AttackerLarge <= 0 || DefenderSmall + DefenderLarge <= 0)
+		{
+			break;
+		}
+	}
+
+	Estimate.AttackerRemainingRatio = (AttackerSmall + AttackerLarge) / Attackers.GetCombatPoints();
+	Estimate.DefenderRemainingRatio = (DefenderSmall + DefenderLarge) / Defenders.GetCombatPoints();
+
+	// Convert the survivors into a strength ratio, following the square law : A² - D² = Remaining²
+	if (Estimate.DefenderRemainingRatio <= 0)
+	{
+		float Loss = 1.f - FMath::Square(Estimate.AttackerRemainingRatio);
+		Estimate.Advantage = (Loss > 0 ? FMath::Min(1.f / FMath::Sqrt(Loss), BATTLE_ESTIMATE_MAX_ADVANTAGE) : BATTLE_ESTIMATE_MAX_ADVANTAGE);
+	}
+	else if (Estimate.AttackerRemainingRatio <= 0)
+	{
+		Estimate.Advantage = FMath::Sqrt(1.f - FMath::Square(Estimate.DefenderRemainingRatio));
+	}
+	else
+	{
+		// Stalemate
+		Estimate.Advantage = Estimate.AttackerRemainingRatio / Estimate.DefenderRemainingRatio;
+	}
+
+	return Estimate;
+}
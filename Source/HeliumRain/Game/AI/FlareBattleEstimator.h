@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Object.h"
+#include "../FlareGameTypes.h"
+#include "FlareBattleEstimator.generated.h"
+
+
+class UFlareCompany;
+class UFlareSimulatedSector;
+class UFlareSimulatedSpacecraft;
+
+
+/** Compact snapshot of a military fleet, as seen by the battle estimator */
+struct FFlareBattleFleetSnapshot
+{
+	int32 SmallShipCount;
+	int32 LargeShipCount;
+
+	/** Combat points carried by small and large hulls, used as health */
+	int32 SmallShipCombatPoints;
+	int32 LargeShipCombatPoints;
+
+	/** Combat points of ships armed against small and large hulls, used as firepower */
+	int32 AntiSmallCombatPoints;
+	int32 AntiLargeCombatPoints;
+
+	FFlareBattleFleetSnapshot()
+		: SmallShipCount(0)
+		, LargeShipCount(0)
+		, SmallShipCombatPoints(0)
+		, LargeShipCombatPoints(0)
+		, AntiSmallCombatPoints(0)
+		, AntiLargeCombatPoints(0)
+	{
+	}
+
+	/** Add a military ship to the snapshot */
+	void AddShip(UFlareSimulatedSpacecraft* Ship);
+
+	int32 GetCombatPoints() const
+	{
+		return SmallShipCombatPoints + LargeShipCombatPoints;
+	}
+
+	bool operator==(const FFlareBattleFleetSnapshot& Other) const
+	{
+		return SmallShipCount == Other.SmallShipCount
+			&& LargeShipCount == Other.LargeShipCount
+			&& SmallShipCombatPoints == Other.SmallShipCombatPoints
+			&& LargeShipCombatPoints == Other.LargeShipCombatPoints
+			&& AntiSmallCombatPoints == Other.AntiSmallCombatPoints
+			&& AntiLargeCombatPoints == Other.AntiLargeCombatPoints;
+	}
+};
+
+/** Predicted outcome of a fight */
+struct FFlareBattleEstimate
+{
+	/** Ratio of the initial combat points left to each side at the end of the fight */
+	float AttackerRemainingRatio;
+	float DefenderRemainingRatio;
+
+	/** Equivalent attacker / defender strength ratio, comparable to the AI attack and retreat thresholds */
+	float Advantage;
+};
+
+/** Memoization key : an attacking fleet composition against a sector */
+struct FFlareBattleEstimateKey
+{
+	FFlareBattleFleetSnapshot Attackers;
+	UFlareSimulatedSector*    Sector;
+
+	bool operator==(const FFlareBattleEstimateKey& Other) const
+	{
+		return Sector == Other.Sector && Attackers == Other.Attackers;
+	}
+
+	friend uint32 GetTypeHash(const FFlareBattleEstimateKey& Key)
+	{
+		uint32 Hash = PointerHash(Key.Sector);
+		Hash = HashCombine(Hash, GetTypeHash(Key.Attackers.SmallShipCount));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Attackers.LargeShipCount));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Attackers.SmallShipCombatPoints));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Attackers.LargeShipCombatPoints));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Attackers.AntiSmallCombatPoints));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Attackers.AntiLargeCombatPoints));
+		return Hash;
+	}
+};
+
+
+/** Cheap prediction of automatic battles, used by the AI to plan wars */
+UCLASS()
+class HELIUMRAIN_API UFlareBattleEstimator : public UObject
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+
+	/*----------------------------------------------------
+		Public API
+	----------------------------------------------------*/
+
+	/** Setup the estimator */
+	void Load(UFlareCompany* ParentCompany);
+
+	/** Forget all estimates and reset the daily budget, once a day */
+	void ResetCache();
+
+	/** Estimate a fight between our fleet and the hostile army in a sector. Return false if the daily budget is exhausted. */
+	bool EstimateBattle(const FFlareBattleFleetSnapshot& Attackers, UFlareSimulatedSector* Sector, FFlareBattleEstimate& Estimate);
+
+	/** Get the army hostile to the company in this sector */
+	const FFlareBattleFleetSnapshot& GetHostileFleet(UFlareSimulatedSector* Sector);
+
+	/** Run the attrition model on two fleet snapshots */
+	static FFlareBattleEstimate ComputeBattle(const FFlareBattleFleetSnapshot& Attackers, const FFlareBattleFleetSnapshot& Defenders);
+
+
+protected:
+
+	/*----------------------------------------------------
+		Data
+	----------------------------------------------------*/
+
+	// Gameplay data
+	UFlareCompany*                                               Company;
+
+	// Cache
+	TMap<FFlareBattleEstimateKey, FFlareBattleEstimate>          Estimates;
+	TMap<UFlareSimulatedSector*, FFlareBattleFleetSnapshot>      HostileFleets;
+	int32                                                        EstimateCount;
+
+};
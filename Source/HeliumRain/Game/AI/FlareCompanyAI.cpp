@@ -53,6 +53,10 @@ void UFlareCompanyAI::Load(UFlareCompany* ParentCompany, const FFlareCompanyAISa
 
 	// Setup Behavior
 	Behavior = NewObject<UFlareAIBehavior>(this, UFlareAIBehavior::StaticClass());
+
+	// Setup battle estimator
+	BattleEstimator = NewObject<UFlareBattleEstimator>(this, UFlareBattleEstimator::StaticClass());
+	BattleEstimator->Load(Company);
 }
 
 FFlareCompanyAISave* UFlareCompanyAI::Save()
@@ -73,6 +77,7 @@ void UFlareCompanyAI::Simulate()
 	if (Game && Company != Game->GetPC()->GetCompany())
 	{
 		Behavior->Load(Company);
+		BattleEstimator->ResetCache();
 
 		CheckBattleResolution();
 		UpdateDiplomacy();
@@ -1171,6 +1176,7 @@ TArray<WarTarget> UFlareCompanyAI::GenerateWarTargetList()
 		Target.OwnedStationCount = 0;
 		Target.OwnedMilitaryCount = 0;
 		Target.WarTargetIncomingFleets = GenerateWarTargetIncomingFleets(Sector);
+		FFlareBattleFleetSnapshot OwnedFleet;
 
 
 		for (UFlareSimulatedSpacecraft* Spacecraft : Sector->GetSectorSpacecrafts())
@@ -1224,6 +1230,7 @@ TArray<WarTarget> UFlareCompanyAI::GenerateWarTargetList()
 
 						Target.OwnedArmyCombatPoints += ShipCombatPoints;
 						Target.OwnedMilitaryCount++;
+						OwnedFleet.AddShip(Spacecraft);
 
 						if (Spacecraft->GetWeaponsSystem()->HasAntiLargeShipWeapon())
 						{
@@ -1244,8 +1251,15 @@ TArray<WarTarget> UFlareCompanyAI::GenerateWarTargetList()
 		}
 
 
-		if (Target.OwnedArmyAntiLCombatPoints <= Target.EnemyArmyLCombatPoints * Behavior->RetreatThreshold ||
-				Target.OwnedArmyAntiSCombatPoints <= Target.EnemyArmySCombatPoints * Behavior->RetreatThreshold)
+		// Check if the local army is too weak, using the battle estimator when the enemy is armed
+		bool StrongEnough = false;
+		if (Target.EnemyArmyCombatPoints == 0 || !EstimateFleetStrength(OwnedFleet, Sector, Behavior->RetreatThreshold, StrongEnough))
+		{
+			StrongEnough = Target.OwnedArmyAntiLCombatPoints > Target.EnemyArmyLCombatPoints * Behavior->RetreatThreshold &&
+					Target.OwnedArmyAntiSCombatPoints > Target.EnemyArmySCombatPoints * Behavior->RetreatThreshold;
+		}
+
+		if (!StrongEnough)
 		{
 			WarTargetList.Add(Target);
 
@@ -1302,6 +1316,7 @@ TArray<DefenseSector> UFlareCompanyAI::GenerateDefenseSectorList()
 		Target.ArmySmallShipCombatPoints = 0;
 		Target.LargeShipArmyCount = 0;
 		Target.SmallShipArmyCount = 0;
+		Target.Fleet = FFlareBattleFleetSnapshot();
 
 		for (UFlareSimulatedSpacecraft* Ship : Sector->GetSectorShips())
 		{
@@ -1335,6 +1350,8 @@ TArray<DefenseSector> UFlareCompanyAI::GenerateDefenseSectorList()
 			{
 				Target.ArmyAntiSCombatPoints += ShipCombatPoints;
 			}
+
+			Target.Fleet.AddShip(Ship);
 		}
 
 		Target.CapturingStation = false;
@@ -1458,7 +1475,13 @@ void UFlareCompanyAI::UpdateWarMilitaryMovement()
 #endif
 
 			// Check if the army is strong enough
-			if (Sector.CombatPoints < Target.EnemyArmyCombatPoints * Behavior->GetAttackThreshold())
+			bool StrongEnough = false;
+			if (!EstimateFleetStrength(Sector.Fleet, Target.Sector, Behavior->GetAttackThreshold(), StrongEnough))
+			{
+				StrongEnough = Sector.CombatPoints >= Target.EnemyArmyCombatPoints * Behavior->GetAttackThreshold();
+			}
+
+			if (!StrongEnough)
 			{
 				// Army too weak
 #ifdef DEBUG_AI_WAR_MILITARY_MOVEMENT
@@ -2285,6 +2308,19 @@ bool UFlareCompanyAI::UpgradeMilitaryFleet(WarTarget Target, DefenseSector& Sect
 	bool FinalEnoughAntiL = Sector.ArmyAntiLCombatPoints >= Target.EnemyArmyLCombatPoints * Behavior->GetAttackThreshold();
 	bool FinalEnoughAntiS = Sector.ArmyAntiSCombatPoints >= Target.EnemyArmySCombatPoints * Behavior->GetAttackThreshold();
 
+	// Check the upgraded fleet against the enemy army
+	FFlareBattleFleetSnapshot UpgradedFleet;
+	for (UFlareSimulatedSpacecraft* Ship : MovableShips)
+	{
+		UpgradedFleet.AddShip(Ship);
+	}
+
+	bool FinalStrongEnough = false;
+	if (!EstimateFleetStrength(UpgradedFleet, Target.Sector, Behavior->GetAttackThreshold(), FinalStrongEnough))
+	{
+		FinalStrongEnough = FinalEnoughAntiL && FinalEnoughAntiS;
+	}
+
 	#ifdef DEBUG_AI_WAR_MILITARY_MOVEMENT
 					FLOGV("upgrade at %s failed FinalEnoughAntiL=%d, FinalEnoughAntiS=%d",
 						*Sector.Sector->GetSectorName().ToString(),
@@ -2294,7 +2330,26 @@ bool UFlareCompanyAI::UpgradeMilitaryFleet(WarTarget Target, DefenseSector& Sect
 						Sector.ArmyAntiSCombatPoints, Target.EnemyArmySCombatPoints);
 	#endif
 
-	return !UpgradeFailed || (FinalEnoughAntiL && FinalEnoughAntiS);
+	return !UpgradeFailed || FinalStrongEnough;
+}
+
+bool UFlareCompanyAI::EstimateFleetStrength(const FFlareBattleFleetSnapshot& Fleet, UFlareSimulatedSector* Sector, float Threshold, bool& StrongEnough)
+{
+	FFlareBattleEstimate Estimate;
+	if (!BattleEstimator->EstimateBattle(Fleet, Sector, Estimate))
+	{
+		return false;
+	}
+
+#ifdef DEBUG_AI_WAR_MILITARY_MOVEMENT
+	FLOGV("estimate battle at %s : Advantage=%f, Threshold=%f, AttackerRemainingRatio=%f, DefenderRemainingRatio=%f",
+		*Sector->GetSectorName().ToString(),
+		Estimate.Advantage, Threshold,
+		Estimate.AttackerRemainingRatio, Estimate.DefenderRemainingRatio);
+#endif
+
+	StrongEnough = Estimate.Advantage > Threshold;
+	return true;
 }
 
 //#define DEBUG_AI_PEACE_MILITARY_MOVEMENT
@@ -3625,10 +3680,10 @@ SectorVariation UFlareCompanyAI::ComputeSectorResourceVariation(UFlareSimulatedS
 			}
 
 
-			TArray<FFlareCargo>& CargoBaySlots = Ship->GetCargoBay()->GetSlots();
+			const TArray<FFlareCargo>& CargoBaySlots = Ship->GetCargoBay()->GetSlots();
 			for (int32 CargoIndex = 0; CargoIndex < CargoBaySlots.Num(); CargoIndex++)
 			{
-				FFlareCargo& Cargo = CargoBaySlots[CargoIndex];
+				const FFlareCargo& Cargo = CargoBaySlots[CargoIndex];
 
 				if (!Cargo.Resource)
 				{
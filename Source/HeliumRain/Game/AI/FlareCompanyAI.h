@@ -3,11 +3,13 @@
 #include "Object.h"
 #include "../FlareGameTypes.h"
 #include "../FlareWorldHelper.h"
+#include "FlareBattleEstimator.h"
 #include "FlareCompanyAI.generated.h"
 
 
 class UFlareCompany;
 class UFlareAIBehavior;
+class UFlareBattleEstimator;
 
 /* Inter-sector trade deal */
 struct SectorDeal
@@ -62,6 +64,7 @@ struct DefenseSector
 	int32 LargeShipArmyCount;
 	int32 SmallShipArmyCount;
 	bool CapturingStation;
+	FFlareBattleFleetSnapshot Fleet;
 
 	bool operator==(const DefenseSector& lhs)
 	{
@@ -187,6 +190,9 @@ public:
 
 	void CheckBattleState();
 
+	/** Check if a fleet would defeat the hostile army in a sector by the given margin. Return false if the estimator is out of budget. */
+	bool EstimateFleetStrength(const FFlareBattleFleetSnapshot& Fleet, UFlareSimulatedSector* Sector, float Threshold, bool& StrongEnough);
+
 	bool HasHealthyTradeFleet() const;
 
 
@@ -258,6 +264,8 @@ protected:
 	AFlareGame*                            Game;
 	UPROPERTY()
 	UFlareAIBehavior*                      Behavior;
+	UPROPERTY()
+	UFlareBattleEstimator*                 BattleEstimator;
 	
 	// Cache
 	TMap<FFlareResourceDescription*, WorldHelper::FlareResourceStats> WorldStats;
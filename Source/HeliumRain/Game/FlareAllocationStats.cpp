@@ -0,0 +1,144 @@
+
+#include "../Flare.h"
+#include "FlareAllocationStats.h"
+
+
+/*----------------------------------------------------
+	Counting allocator
+----------------------------------------------------*/
+
+static bool FlareAllocationStatsEnabled = false;
+
+static thread_local uint64 FlareThreadAllocationCount = 0;
+
+/** Forward everything to the engine allocator, counting new blocks on the calling thread */
+class FFlareCountingMalloc : public FMalloc
+{
+public:
+
+	FFlareCountingMalloc(FMalloc* InUsedMalloc)
+		: UsedMalloc(InUsedMalloc)
+	{
+	}
+
+	virtual void* Malloc(SIZE_T Size, uint32 Alignment) override
+	{
+		FlareThreadAllocationCount++;
+		return UsedMalloc->Malloc(Size, Alignment);
+	}
+
+	virtual void* Realloc(void* Ptr, SIZE_T NewSize, uint32 Alignment) override
+	{
+		if (NewSize > 0)
+		{
+			FlareThreadAllocationCount++;
+		}
+		return UsedMalloc->Realloc(Ptr, NewSize, Alignment);
+	}
+
+	virtual void Free(void* Ptr) override
+	{
+		UsedMalloc->Free(Ptr);
+	}
+
+	virtual bool GetAllocationSize(void *Original, SIZE_T &SizeOut) override
+	{
+		return UsedMalloc->GetAllocationSize(Original, SizeOut);
+	}
+
+	virtual void Trim() override
+	{
+		UsedMalloc->Trim();
+	}
+
+	virtual void SetupTLSCachesOnCurrentThread() override
+	{
+		UsedMalloc->SetupTLSCachesOnCurrentThread();
+	}
+
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+	{
+		UsedMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+	}
+
+	virtual void UpdateStats() override
+	{
+		UsedMalloc->UpdateStats();
+	}
+
+	virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override
+	{
+		UsedMalloc->GetAllocatorStats(OutStats);
+	}
+
+	virtual void DumpAllocatorStats(class FOutputDevice& Ar) override
+	{
+		UsedMalloc->DumpAllocatorStats(Ar);
+	}
+
+	virtual bool IsInternallyThreadSafe() const override
+	{
+		return UsedMalloc->IsInternallyThreadSafe();
+	}
+
+	virtual bool ValidateHeap() override
+	{
+		return UsedMalloc->ValidateHeap();
+	}
+
+	virtual const TCHAR* GetDescriptorName() const override
+	{
+		return UsedMalloc->GetDescriptorName();
+	}
+
+
+protected:
+
+	FMalloc*                                        UsedMalloc;
+
+};
+
+
+/*----------------------------------------------------
+	Public API
+----------------------------------------------------*/
+
+void FFlareAllocationStats::Initialize()
+{
+	if (!FlareAllocationStatsEnabled && FParse::Param(FCommandLine::Get(), TEXT("FlareAllocStats")))
+	{
+		// Blocks allocated before this point are still freed by the engine allocator
+		GMalloc = new FFlareCountingMalloc(GMalloc);
+		FlareAllocationStatsEnabled = true;
+		FLOG("FFlareAllocationStats::Initialize : counting allocations");
+	}
+}
+
+bool FFlareAllocationStats::IsEnabled()
+{
+	return FlareAllocationStatsEnabled;
+}
+
+uint64 FFlareAllocationStats::GetThreadAllocationCount()
+{
+	return FlareThreadAllocationCount;
+}
+
+
+/*----------------------------------------------------
+	Scope
+----------------------------------------------------*/
+
+FFlareAllocationScope::FFlareAllocationScope(FName InStatName)
+	: StatName(InStatName)
+	, StartCount(FlareThreadAllocationCount)
+{
+}
+
+FFlareAllocationScope::~FFlareAllocationScope()
+{
+	if (FlareAllocationStatsEnabled)
+	{
+		INC_DWORD_STAT_BY_FName(StatName, FlareThreadAllocationCount - StartCount);
+	}
+}
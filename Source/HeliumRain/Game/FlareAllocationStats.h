@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Engine.h"
+
+
+/** Heap allocation counting, enabled with -FlareAllocStats on the command line */
+class HELIUMRAIN_API FFlareAllocationStats
+{
+public:
+
+	/*----------------------------------------------------
+		Public API
+	----------------------------------------------------*/
+
+	/** Install the counting allocator if it was requested */
+	static void Initialize();
+
+	/** Check if allocations are being counted */
+	static bool IsEnabled();
+
+	/** Get the number of allocations made by the calling thread so far */
+	static uint64 GetThreadAllocationCount();
+
+};
+
+
+/** Add the allocations made by the current thread during a scope to a per-frame counter stat */
+class HELIUMRAIN_API FFlareAllocationScope
+{
+public:
+
+	FFlareAllocationScope(FName InStatName);
+
+	~FFlareAllocationScope();
+
+
+protected:
+
+	FName                                           StatName;
+	uint64                                          StartCount;
+
+};
+
+
+/** Count the allocations of a scope in a DECLARE_DWORD_COUNTER_STAT, nested scopes being counted in their parents too */
+#if STATS
+#define SCOPE_FLARE_ALLOCATION_COUNTER(Stat) FFlareAllocationScope FlareAllocationScope_##Stat(GET_STATFNAME(Stat))
+#else
+#define SCOPE_FLARE_ALLOCATION_COUNTER(Stat)
+#endif
@@ -6,6 +6,8 @@
 #include "FlareGame.h"
 #include "FlareGameTools.h"
 
+DECLARE_CYCLE_STAT(TEXT("FlareBattle Simulate"), STAT_FlareBattle_Simulate, STATGROUP_Flare);
+
 struct BattleTargetPreferences
 {
         float IsLarge;
@@ -41,9 +43,98 @@ void UFlareBattle::Load(UFlareSimulatedSector* BattleSector)
     Sector = BattleSector;
     PlayerCompany = Game->GetPC()->GetCompany();
 	Catalog = Game->GetShipPartsCatalog();
+	BattleInProgress = false;
 
+	LoadCombatants();
+	UpdateFightingCompanies();
 }
 
+void UFlareBattle::LoadCombatants()
+{
+	Companies = Game->GetGameWorld()->GetCompanies();
+	Combatants.Empty();
+
+	for (int32 SpacecraftIndex = 0 ; SpacecraftIndex < Sector->GetSectorSpacecrafts().Num(); SpacecraftIndex++)
+	{
+		UFlareSimulatedSpacecraft* Spacecraft = Sector->GetSectorSpacecrafts()[SpacecraftIndex];
+
+		if(Spacecraft->IsReserve())
+		{
+			// No in fight
+			continue;
+		}
+
+		FFlareBattleCombatant Combatant;
+		Combatant.Spacecraft = Spacecraft;
+		Combatant.CompanyIndex = Companies.Find(Spacecraft->GetCompany());
+		Combatant.Size = Spacecraft->GetSize();
+		Combatant.IsStation = Spacecraft->IsStation();
+		Combatant.IsMilitary = Spacecraft->IsMilitary();
+
+		for (int32 ComponentIndex = 0; ComponentIndex < Spacecraft->GetData().Components.Num(); ComponentIndex++)
+		{
+			FFlareSpacecraftComponentDescription* ComponentDescription = Catalog->Get(Spacecraft->GetData().Components[ComponentIndex].ComponentIdentifier);
+			Combatant.ComponentDescriptions.Add(ComponentDescription);
+
+			if (ComponentDescription && ComponentDescription->Type == EFlarePartType::Weapon && ComponentDescription->WeaponCharacteristics.TurretCharacteristics.IsTurret)
+			{
+				Combatant.Turrets.Add(ComponentIndex);
+			}
+		}
+
+		UpdateCombatantState(Combatant);
+		Combatants.Add(Combatant);
+	}
+
+	// Hostility doesn't change during a battle
+	for (int32 ShipIndex = 0; ShipIndex < Combatants.Num(); ShipIndex++)
+	{
+		FFlareBattleCombatant& Ship = Combatants[ShipIndex];
+
+		for (int32 CandidateIndex = 0; CandidateIndex < Combatants.Num(); CandidateIndex++)
+		{
+			if (Ship.Spacecraft->GetCompany()->GetWarState(Combatants[CandidateIndex].Spacecraft->GetCompany()) == EFlareHostility::Hostile)
+			{
+				Ship.Targets.Add(CandidateIndex);
+			}
+		}
+	}
+}
+
+void UFlareBattle::UpdateCombatantState(FFlareBattleCombatant& Combatant)
+{
+	UFlareSimulatedSpacecraftDamageSystem* DamageSystem = Combatant.Spacecraft->GetDamageSystem();
+
+	Combatant.IsAlive = DamageSystem->IsAlive();
+	Combatant.IsDisarmed = DamageSystem->IsDisarmed();
+	Combatant.IsStranded = DamageSystem->IsStranded();
+	Combatant.IsUncontrollable = DamageSystem->IsUncontrollable();
+	Combatant.IsHarpooned = Combatant.Spacecraft->IsHarpooned();
+}
+
+void UFlareBattle::UpdateFightingCompanies()
+{
+	bool IsLocalSector = (Sector == GetGame()->GetPC()->GetPlayerShip()->GetCurrentSector());
+
+	BattleInProgress = false;
+	FightingCompanies.SetNum(Companies.Num());
+
+	for (int CompanyIndex = 0; CompanyIndex < Companies.Num(); CompanyIndex++)
+	{
+		UFlareCompany* Company = Companies[CompanyIndex];
+		FFlareSectorBattleState BattleState = Sector->GetSectorBattleState(Company);
+
+		FightingCompanies[CompanyIndex] = BattleState.WantFight();
+
+		// Local sector, don't check if the player want fight
+		if (FightingCompanies[CompanyIndex] && !(Company == PlayerCompany && IsLocalSector))
+		{
+			BattleInProgress = true;
+		}
+	}
+}
+
+
 /*----------------------------------------------------
 	Gameplay
 ----------------------------------------------------*/
@@ -51,6 +142,8 @@ void UFlareBattle::Load(UFlareSimulatedSector* BattleSector)
 
 void UFlareBattle::Simulate()
 {
+	SCOPE_CYCLE_COUNTER(STAT_FlareBattle_Simulate);
+
     int32 BattleTurn = 0;
 
     FLOGV("Simulate battle in %s", *Sector->GetSectorName().ToString());
@@ -70,85 +163,37 @@ void UFlareBattle::Simulate()
             FLOG("ERROR: Battle too long, still not ended after 1000 turns");
             break;
         }
+
+		UpdateFightingCompanies();
     }
 
 	CombatLog::AutomaticBattleEnded(Sector);
     FLOGV("Battle in %s finish after %d turns", *Sector->GetSectorName().ToString(), BattleTurn);
 }
 
-bool UFlareBattle::HasBattle()
-{
-    // Check if battle
-    bool HasBattle = false;
-    for (int CompanyIndex = 0; CompanyIndex < Game->GetGameWorld()->GetCompanies().Num(); CompanyIndex++)
-    {
-        UFlareCompany* Company = Game->GetGameWorld()->GetCompanies()[CompanyIndex];
-
-        if (Company == PlayerCompany && Sector == GetGame()->GetPC()->GetPlayerShip()->GetCurrentSector())
-        {
-            // Local sector, don't check if the player want fight
-            continue;
-        }
-
-		FFlareSectorBattleState BattleState = Sector->GetSectorBattleState(Company);
-
-		if(!BattleState.WantFight())
-        {
-            // Don't want fight
-            continue;
-        }
-
-        return true;
-    }
-    return false;
-}
-
 bool UFlareBattle::SimulateTurn()
 {
     bool HasFight = false;
 
-    // List company in war
-    TArray<UFlareCompany*> FightingCompanies;
-    for (int CompanyIndex = 0; CompanyIndex < Game->GetGameWorld()->GetCompanies().Num(); CompanyIndex++)
-    {
-        UFlareCompany* Company = Game->GetGameWorld()->GetCompanies()[CompanyIndex];
-
-		FFlareSectorBattleState BattleState = Sector->GetSectorBattleState(Company);
-
-		if(!BattleState.WantFight())
-		{
-            // Don't want fight
-            continue;
-        }
-
-        FightingCompanies.Add(Company);
-    }
-
     // List all fighting ships
-    TArray<UFlareSimulatedSpacecraft*> ShipToSimulate;
-    for (int32 ShipIndex = 0 ; ShipIndex < Sector->GetSectorShips().Num(); ShipIndex++)
+	TArray<int32> ShipToSimulate;
+	for (int32 ShipIndex = 0 ; ShipIndex < Combatants.Num(); ShipIndex++)
     {
-        UFlareSimulatedSpacecraft* Ship = Sector->GetSectorShips()[ShipIndex];
+		const FFlareBattleCombatant& Ship = Combatants[ShipIndex];
 
-		if(Ship->IsReserve())
-		{
-			// No in fight
-			continue;
-		}
-
-		if(!Ship->IsMilitary()  || Ship->GetDamageSystem()->IsDisarmed())
+		if(Ship.IsStation || !Ship.IsMilitary || Ship.IsDisarmed)
         {
             // No weapon
             continue;
         }
 
-        if(!FightingCompanies.Contains(Ship->GetCompany()))
+		if(Ship.CompanyIndex == INDEX_NONE || !FightingCompanies[Ship.CompanyIndex])
         {
             // Not in war
             continue;
         }
 
-        ShipToSimulate.Add(Ship);
+        ShipToSimulate.Add(ShipIndex);
     }
 
     // Play fighting ship inthem in random order
@@ -171,28 +216,27 @@ bool UFlareBattle::SimulateTurn()
     return HasFight;
 }
 
-bool UFlareBattle::SimulateShipTurn(UFlareSimulatedSpacecraft* Ship)
+bool UFlareBattle::SimulateShipTurn(int32 ShipIndex)
 {
-    if(Ship->GetSize() == EFlarePartSize::S)
+	if(Combatants[ShipIndex].Size == EFlarePartSize::S)
     {
-        return SimulateSmallShipTurn(Ship);
+		return SimulateSmallShipTurn(ShipIndex);
     }
-    else if(Ship->GetSize() == EFlarePartSize::L)
+	else if(Combatants[ShipIndex].Size == EFlarePartSize::L)
     {
-        return SimulateLargeShipTurn(Ship);
+		return SimulateLargeShipTurn(ShipIndex);
     }
 
     return false;
 }
 
-bool UFlareBattle::SimulateSmallShipTurn(UFlareSimulatedSpacecraft* Ship)
+bool UFlareBattle::SimulateSmallShipTurn(int32 ShipIndex)
 {
     //  - Find a target
     //  - Find a weapon
     //  - Apply damage
 
-
-	UFlareSimulatedSpacecraft* Target = NULL;
+	UFlareSimulatedSpacecraft* Ship = Combatants[ShipIndex].Spacecraft;
 
     struct BattleTargetPreferences TargetPreferences;
     TargetPreferences.IsLarge = 1;
@@ -214,14 +258,15 @@ bool UFlareBattle::SimulateSmallShipTurn(UFlareSimulatedSpacecraft* Ship)
 
 	Ship->GetWeaponsSystem()->GetTargetPreference(&TargetPreferences.IsSmall, &TargetPreferences.IsLarge, &TargetPreferences.IsUncontrollableCivil, &TargetPreferences.IsUncontrollableSmallMilitary, &TargetPreferences.IsUncontrollableLargeMilitary, &TargetPreferences.IsNotUncontrollable, &TargetPreferences.IsStation, &TargetPreferences.IsHarpooned);
 
-	Target = GetBestTarget(Ship, TargetPreferences);
+	int32 TargetIndex = GetBestTarget(ShipIndex, TargetPreferences);
 
-	if (!Target)
+	if (TargetIndex == INDEX_NONE)
     {
 		return false;
 	}
 
 	// Find best weapon
+	UFlareSimulatedSpacecraft* Target = Combatants[TargetIndex].Spacecraft;
 	int32 WeaponGroupIndex = Ship->GetWeaponsSystem()->FindBestWeaponGroup(Target);
 
 	if(WeaponGroupIndex == -1)
@@ -235,25 +280,21 @@ bool UFlareBattle::SimulateSmallShipTurn(UFlareSimulatedSpacecraft* Ship)
 		  *Ship->GetWeaponsSystem()->GetWeaponGroup(WeaponGroupIndex)->Description->Identifier.ToString())
 
 
-	return SimulateShipAttack(Ship, WeaponGroupIndex, Target);
+	return SimulateShipAttack(ShipIndex, WeaponGroupIndex, TargetIndex);
 }
 
-bool UFlareBattle::SimulateLargeShipTurn(UFlareSimulatedSpacecraft* Ship)
+bool UFlareBattle::SimulateLargeShipTurn(int32 ShipIndex)
 {
 	bool HasAttacked = false;
+	FFlareBattleCombatant& Combatant = Combatants[ShipIndex];
+	UFlareSimulatedSpacecraft* Ship = Combatant.Spacecraft;
 
 	// Fire each turret individualy
-	for (int32 ComponentIndex = 0; ComponentIndex < Ship->GetData().Components.Num(); ComponentIndex++)
+	for (int32 TurretIndex = 0; TurretIndex < Combatant.Turrets.Num(); TurretIndex++)
 	{
+		int32 ComponentIndex = Combatant.Turrets[TurretIndex];
 		FFlareSpacecraftComponentSave* ComponentData = &Ship->GetData().Components[ComponentIndex];
-
-		FFlareSpacecraftComponentDescription* ComponentDescription = Catalog->Get(ComponentData->ComponentIdentifier);
-
-		if(ComponentDescription->Type != EFlarePartType::Weapon || !ComponentDescription->WeaponCharacteristics.TurretCharacteristics.IsTurret)
-		{
-			// Ignore if not a turret
-			continue;
-		}
+		FFlareSpacecraftComponentDescription* ComponentDescription = Combatant.ComponentDescriptions[ComponentIndex];
 
 		if(Ship->GetDamageSystem()->GetUsableRatio(ComponentDescription, ComponentData) <= 0)
 		{
@@ -262,9 +303,6 @@ bool UFlareBattle::SimulateLargeShipTurn(UFlareSimulatedSpacecraft* Ship)
 		}
 
 
-		UFlareSimulatedSpacecraft* Target = NULL;
-
-
 		struct BattleTargetPreferences TargetPreferences;
 		TargetPreferences.IsLarge = 1;
 		TargetPreferences.IsSmall = 1;
@@ -288,20 +326,20 @@ bool UFlareBattle::SimulateLargeShipTurn(UFlareSimulatedSpacecraft* Ship)
 		TargetPreferences.IsStation = ComponentDescription->WeaponCharacteristics.AntiStationValue;
 
 
-		Target = GetBestTarget(Ship, TargetPreferences);
+		int32 TargetIndex = GetBestTarget(ShipIndex, TargetPreferences);
 
-		if (!Target)
+		if (TargetIndex == INDEX_NONE)
 		{
 			return false;
 		}
 
 		FLOGV("%s want to attack %s with %s",
 			  *Ship->GetImmatriculation().ToString(),
-			  *Target->GetImmatriculation().ToString(),
+			  *Combatants[TargetIndex].Spacecraft->GetImmatriculation().ToString(),
 			  *ComponentData->ShipSlotIdentifier.ToString())
 
 
-		if (SimulateShipWeaponAttack(Ship, ComponentDescription, ComponentData, Target))
+		if (SimulateShipWeaponAttack(ShipIndex, ComponentDescription, ComponentData, TargetIndex))
 		{
 			HasAttacked = true;
 		}
@@ -309,30 +347,18 @@ bool UFlareBattle::SimulateLargeShipTurn(UFlareSimulatedSpacecraft* Ship)
 	return HasAttacked;
 }
 
-UFlareSimulatedSpacecraft* UFlareBattle::GetBestTarget(UFlareSimulatedSpacecraft* Ship, struct BattleTargetPreferences Preferences)
+int32 UFlareBattle::GetBestTarget(int32 ShipIndex, struct BattleTargetPreferences Preferences)
 {
-	UFlareSimulatedSpacecraft* BestTarget = NULL;
+	int32 BestTarget = INDEX_NONE;
 	float BestScore = 0;
 
-	//FLOGV("GetBestTarget for %s", *Ship->GetImmatriculation().ToString());
+	const TArray<int32>& Targets = Combatants[ShipIndex].Targets;
 
-	for (int32 SpacecraftIndex = 0 ; SpacecraftIndex < Sector->GetSectorSpacecrafts().Num(); SpacecraftIndex++)
+	for (int32 CandidateIndex = 0 ; CandidateIndex < Targets.Num(); CandidateIndex++)
 	{
-		UFlareSimulatedSpacecraft* ShipCandidate = Sector->GetSectorSpacecrafts()[SpacecraftIndex];
+		const FFlareBattleCombatant& Candidate = Combatants[Targets[CandidateIndex]];
 
-		if(ShipCandidate->IsReserve())
-		{
-			// No in fight
-			continue;
-		}
-
-		if (Ship->GetCompany()->GetWarState(ShipCandidate->GetCompany()) != EFlareHostility::Hostile)
-		{
-			// Ignore not hostile ships
-			continue;
-		}
-
-		if (!ShipCandidate->GetDamageSystem()->IsAlive())
+		if (!Candidate.IsAlive)
 		{
 			// Ignore destroyed ships
 			continue;
@@ -344,17 +370,17 @@ UFlareSimulatedSpacecraft* UFlareBattle::GetBestTarget(UFlareSimulatedSpacecraft
 
 		StateScore = Preferences.TargetStateWeight;
 
-		if (ShipCandidate->GetSize() == EFlarePartSize::L)
+		if (Candidate.Size == EFlarePartSize::L)
 		{
 			StateScore *= Preferences.IsLarge;
 		}
 
-		if (ShipCandidate->GetSize() == EFlarePartSize::S)
+		if (Candidate.Size == EFlarePartSize::S)
 		{
 			StateScore *= Preferences.IsSmall;
 		}
 
-		if (ShipCandidate->IsStation())
+		if (Candidate.IsStation)
 		{
 			StateScore *= Preferences.IsStation;
 		}
@@ -363,7 +389,7 @@ UFlareSimulatedSpacecraft* UFlareBattle::GetBestTarget(UFlareSimulatedSpacecraft
 			StateScore *= Preferences.IsNotStation;
 		}
 
-		if (ShipCandidate->IsMilitary())
+		if (Candidate.IsMilitary)
 		{
 			StateScore *= Preferences.IsMilitary;
 		}
@@ -372,7 +398,7 @@ UFlareSimulatedSpacecraft* UFlareBattle::GetBestTarget(UFlareSimulatedSpacecraft
 			StateScore *= Preferences.IsNotMilitary;
 		}
 
-		if(ShipCandidate->IsMilitary()  && !ShipCandidate->GetDamageSystem()->IsDisarmed())
+		if(Candidate.IsMilitary && !Candidate.IsDisarmed)
 		{
 			StateScore *= Preferences.IsDangerous;
 		}
@@ -381,7 +407,7 @@ UFlareSimulatedSpacecraft* UFlareBattle::GetBestTarget(UFlareSimulatedSpacecraft
 			StateScore *= Preferences.IsNotDangerous;
 		}
 
-		if (ShipCandidate->GetDamageSystem()->IsStranded())
+		if (Candidate.IsStranded)
 		{
 			StateScore *= Preferences.IsStranded;
 		}
@@ -390,11 +416,11 @@ UFlareSimulatedSpacecraft* UFlareBattle::GetBestTarget(UFlareSimulatedSpacecraft
 			StateScore *= Preferences.IsNotStranded;
 		}
 
-		if (ShipCandidate->GetDamageSystem()->IsUncontrollable() && ShipCandidate->GetDamageSystem()->IsDisarmed())
+		if (Candidate.IsUncontrollable && Candidate.IsDisarmed)
 		{
-			if(ShipCandidate->IsMilitary())
+			if(Candidate.IsMilitary)
 			{
-				if (ShipCandidate->GetSize() == EFlarePartSize::S)
+				if (Candidate.Size == EFlarePartSize::S)
 				{
 					StateScore *= Preferences.IsUncontrollableSmallMilitary;
 				}
@@ -413,8 +439,8 @@ UFlareSimulatedSpacecraft* UFlareBattle::GetBestTarget(UFlareSimulatedSpacecraft
 			StateScore *= Preferences.IsNotUncontrollable;
 		}
 
-		if(ShipCandidate->IsHarpooned()) {
-			if(ShipCandidate->GetDamageSystem()->IsUncontrollable())
+		if(Candidate.IsHarpooned) {
+			if(Candidate.IsUncontrollable)
 			{
 				// Never target harponned uncontrollable ships
 				continue;
@@ -428,9 +454,9 @@ UFlareSimulatedSpacecraft* UFlareBattle::GetBestTarget(UFlareSimulatedSpacecraft
 
 		if (Score > 0)
 		{
-			if (BestTarget == NULL || Score > BestScore)
+			if (BestTarget == INDEX_NONE || Score > BestScore)
 			{
-				BestTarget = ShipCandidate;
+				BestTarget = Targets[CandidateIndex];
 				BestScore = Score;
 			}
 		}
@@ -440,8 +466,9 @@ UFlareSimulatedSpacecraft* UFlareBattle::GetBestTarget(UFlareSimulatedSpacecraft
 }
 
 
-bool UFlareBattle::SimulateShipAttack(UFlareSimulatedSpacecraft* Ship, int32 WeaponGroupIndex, UFlareSimulatedSpacecraft* Target)
+bool UFlareBattle::SimulateShipAttack(int32 ShipIndex, int32 WeaponGroupIndex, int32 TargetIndex)
 {
+	UFlareSimulatedSpacecraft* Ship = Combatants[ShipIndex].Spacecraft;
 	FFlareSimulatedWeaponGroup* WeaponGroup = Ship->GetWeaponsSystem()->GetWeaponGroup(WeaponGroupIndex);
 
 	bool HasAttacked = false;
@@ -458,7 +485,7 @@ bool UFlareBattle::SimulateShipAttack(UFlareSimulatedSpacecraft* Ship, int32 Wea
 				continue;
 			}
 
-			if (SimulateShipWeaponAttack(Ship, WeaponGroup->Description, WeaponGroup->Weapons[WeaponIndex], Target))
+			if (SimulateShipWeaponAttack(ShipIndex, WeaponGroup->Description, WeaponGroup->Weapons[WeaponIndex], TargetIndex))
 			{
 				HasAttacked = true;
 			}
@@ -473,8 +500,10 @@ bool UFlareBattle::SimulateShipAttack(UFlareSimulatedSpacecraft* Ship, int32 Wea
 	return HasAttacked;
 }
 
-bool UFlareBattle::SimulateShipWeaponAttack(UFlareSimulatedSpacecraft* Ship, FFlareSpacecraftComponentDescription* WeaponDescription, FFlareSpacecraftComponentSave* Weapon, UFlareSimulatedSpacecraft* Target)
+bool UFlareBattle::SimulateShipWeaponAttack(int32 ShipIndex, FFlareSpacecraftComponentDescription* WeaponDescription, FFlareSpacecraftComponentSave* Weapon, int32 TargetIndex)
 {
+	UFlareSimulatedSpacecraft* Ship = Combatants[ShipIndex].Spacecraft;
+	UFlareSimulatedSpacecraft* Target = Combatants[TargetIndex].Spacecraft;
 	float UsageRatio = Ship->GetDamageSystem()->GetUsableRatio(WeaponDescription, Weapon);
 	int32 MaxAmmo = WeaponDescription->WeaponCharacteristics.AmmoCapacity;
 	int32 CurrentAmmo = MaxAmmo - Weapon->Weapon.FiredAmmo;
@@ -495,17 +524,17 @@ bool UFlareBattle::SimulateShipWeaponAttack(UFlareSimulatedSpacecraft* Ship, FFl
 
 		float TargetCoef = 1.1;
 
-		if(Target->GetSize() == EFlarePartSize::S)
+		if(Combatants[TargetIndex].Size == EFlarePartSize::S)
 		{
 			TargetCoef *= 50;
 		}
 
-		if(Target->GetDamageSystem()->IsStranded())
+		if(Combatants[TargetIndex].IsStranded)
 		{
 			TargetCoef /= 2;
 		}
 
-		if(Target->GetDamageSystem()->IsUncontrollable())
+		if(Combatants[TargetIndex].IsUncontrollable)
 		{
 			TargetCoef /= 10;
 		}
@@ -523,7 +552,7 @@ bool UFlareBattle::SimulateShipWeaponAttack(UFlareSimulatedSpacecraft* Ship, FFl
 			if(FMath::FRand() < Precision)
 			{
 				// Apply bullet damage
-				SimulateBulletDamage(WeaponDescription, Target, Ship->GetCompany());
+				SimulateBulletDamage(WeaponDescription, TargetIndex, Ship->GetCompany());
 			}
 		}
 
@@ -534,10 +563,10 @@ bool UFlareBattle::SimulateShipWeaponAttack(UFlareSimulatedSpacecraft* Ship, FFl
 	{
 		// Drop one bomb with a hit probabiliy of (1 + usable ratio + isUncontrollable)/3
 
-		if (FMath::FRand() < (1+UsageRatio+(Target->GetDamageSystem()->IsUncontrollable() ? 1.f:0.f)))
+		if (FMath::FRand() < (1+UsageRatio+(Combatants[TargetIndex].IsUncontrollable ? 1.f:0.f)))
 		{
 			// Apply bullet damage
-			SimulateBombDamage(WeaponDescription, Target, Ship->GetCompany());
+			SimulateBombDamage(WeaponDescription, TargetIndex, Ship->GetCompany());
 		}
 
 		Weapon->Weapon.FiredAmmo++;
@@ -549,18 +578,22 @@ bool UFlareBattle::SimulateShipWeaponAttack(UFlareSimulatedSpacecraft* Ship, FFl
 		return false;
 	}
 
+	// The shooter may have run out of ammo
+	Ship->GetDamageSystem()->SetAmmoDirty();
+	UpdateCombatantState(Combatants[ShipIndex]);
+
 	return true;
 }
 
-void UFlareBattle::SimulateBulletDamage(FFlareSpacecraftComponentDescription* WeaponDescription, UFlareSimulatedSpacecraft* Target, UFlareCompany* DamageSource)
+void UFlareBattle::SimulateBulletDamage(FFlareSpacecraftComponentDescription* WeaponDescription, int32 TargetIndex, UFlareCompany* DamageSource)
 {
 	if(WeaponDescription->WeaponCharacteristics.DamageType == EFlareShellDamageType::ArmorPiercing)
 	{
-		ApplyDamage(Target, WeaponDescription->WeaponCharacteristics.GunCharacteristics.KineticEnergy, EFlareDamage::DAM_ArmorPiercing, DamageSource);
+		ApplyDamage(TargetIndex, WeaponDescription->WeaponCharacteristics.GunCharacteristics.KineticEnergy, EFlareDamage::DAM_ArmorPiercing, DamageSource);
 	}
 	else if(WeaponDescription->WeaponCharacteristics.DamageType == EFlareShellDamageType::HEAT)
 	{
-		ApplyDamage(Target, WeaponDescription->WeaponCharacteristics.ExplosionPower, EFlareDamage::DAM_HEAT, DamageSource);
+		ApplyDamage(TargetIndex, WeaponDescription->WeaponCharacteristics.ExplosionPower, EFlareDamage::DAM_HEAT, DamageSource);
 	}
 	else if(WeaponDescription->WeaponCharacteristics.DamageType == EFlareShellDamageType::HighExplosive)
 	{
@@ -572,15 +605,17 @@ void UFlareBattle::SimulateBulletDamage(FFlareSpacecraftComponentDescription* We
 		for(int FragmentIndex = 0; FragmentIndex < FragmentCount; FragmentIndex++)
 		{
 			float FragmentPowerEffet = FMath::FRandRange(0.f, 2.f);
-			ApplyDamage(Target, FragmentPowerEffet * WeaponDescription->WeaponCharacteristics.ExplosionPower, EFlareDamage::DAM_HighExplosive, DamageSource);
+			ApplyDamage(TargetIndex, FragmentPowerEffet * WeaponDescription->WeaponCharacteristics.ExplosionPower, EFlareDamage::DAM_HighExplosive, DamageSource);
 		}
 	}
 }
 
-void UFlareBattle::SimulateBombDamage(FFlareSpacecraftComponentDescription* WeaponDescription, UFlareSimulatedSpacecraft* Target, UFlareCompany* DamageSource)
+void UFlareBattle::SimulateBombDamage(FFlareSpacecraftComponentDescription* WeaponDescription, int32 TargetIndex, UFlareCompany* DamageSource)
 {
+	UFlareSimulatedSpacecraft* Target = Combatants[TargetIndex].Spacecraft;
+
 	// Apply damage
-	ApplyDamage(Target, WeaponDescription->WeaponCharacteristics.ExplosionPower,
+	ApplyDamage(TargetIndex, WeaponDescription->WeaponCharacteristics.ExplosionPower,
 		SpacecraftHelper::GetWeaponDamageType(WeaponDescription->WeaponCharacteristics.DamageType),
 		DamageSource);
 
@@ -591,11 +626,14 @@ void UFlareBattle::SimulateBombDamage(FFlareSpacecraftComponentDescription* Weap
 	{
 		FLOGV("UFlareBattle::SimulateBombDamage : salvaging %s for %s", *Target->GetImmatriculation().ToString(), *DamageSource->GetCompanyName().ToString());
 		Target->SetHarpooned(DamageSource);
+		UpdateCombatantState(Combatants[TargetIndex]);
 	}
 }
 
-void UFlareBattle::ApplyDamage(UFlareSimulatedSpacecraft* Target, float Energy, EFlareDamage::Type DamageType, UFlareCompany* DamageSource)
+void UFlareBattle::ApplyDamage(int32 TargetIndex, float Energy, EFlareDamage::Type DamageType, UFlareCompany* DamageSource)
 {
+	FFlareBattleCombatant& Combatant = Combatants[TargetIndex];
+	UFlareSimulatedSpacecraft* Target = Combatant.Spacecraft;
 
 	// Find a component and apply damages
 
@@ -606,21 +644,26 @@ void UFlareBattle::ApplyDamage(UFlareSimulatedSpacecraft* Target, float Energy,
 	}
 	else
 	{
-		ComponentIndex = GetBestTargetComponent(Target);
+		ComponentIndex = GetBestTargetComponent(TargetIndex);
 	}
 
 
 	FFlareSpacecraftComponentSave* TargetComponent = &Target->GetData().Components[ComponentIndex];
 
-	FFlareSpacecraftComponentDescription* ComponentDescription = Catalog->Get(TargetComponent->ComponentIdentifier);
+	FFlareSpacecraftComponentDescription* ComponentDescription = Combatant.ComponentDescriptions[ComponentIndex];
 
 	CombatLog::SpacecraftDamaged(Target, Energy, 0, FVector::ZeroVector, DamageType, DamageSource, "SimulatedBattle");
 	float DamageRatio = Target->GetDamageSystem()->ApplyDamage(ComponentDescription, TargetComponent, Energy, DamageType, DamageSource);
+
+	UpdateCombatantState(Combatant);
 }
 
 
-int32 UFlareBattle::GetBestTargetComponent(UFlareSimulatedSpacecraft* TargetSpacecraft)
+int32 UFlareBattle::GetBestTargetComponent(int32 TargetIndex)
 {
+	const FFlareBattleCombatant& Combatant = Combatants[TargetIndex];
+	UFlareSimulatedSpacecraft* TargetSpacecraft = Combatant.Spacecraft;
+
 	// Is armed, target the gun
 	// Else if not stranger target the orbital
 	// else target the rsc
@@ -630,14 +673,14 @@ int32 UFlareBattle::GetBestTargetComponent(UFlareSimulatedSpacecraft* TargetSpac
 	float RCSWeight = 1;
 	float InternalWeight = 1;
 
-	if (!TargetSpacecraft->GetDamageSystem()->IsDisarmed())
+	if (!Combatant.IsDisarmed)
 	{
 		WeaponWeight = 20;
 		PodWeight = 8;
 		RCSWeight = 1;
 		InternalWeight = 1;
 	}
-	else if (!TargetSpacecraft->GetDamageSystem()->IsStranded())
+	else if (!Combatant.IsStranded)
 	{
 		PodWeight = 8;
 		RCSWeight = 1;
@@ -655,7 +698,7 @@ int32 UFlareBattle::GetBestTargetComponent(UFlareSimulatedSpacecraft* TargetSpac
 	{
 		FFlareSpacecraftComponentSave* TargetComponent = &TargetSpacecraft->GetData().Components[ComponentIndex];
 
-		FFlareSpacecraftComponentDescription* ComponentDescription = Catalog->Get(TargetComponent->ComponentIdentifier);
+		FFlareSpacecraftComponentDescription* ComponentDescription = Combatant.ComponentDescriptions[ComponentIndex];
 
 		float UsageRatio = TargetSpacecraft->GetDamageSystem()->GetUsableRatio(ComponentDescription, TargetComponent);
 		float DamageRatio = TargetSpacecraft->GetDamageSystem()->GetDamageRatio(ComponentDescription, TargetComponent);
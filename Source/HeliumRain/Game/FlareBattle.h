@@ -7,6 +7,35 @@
 class UFlareSpacecraftComponentsCatalog;
 
 
+/** Flat state of a spacecraft taking part in an automatic battle */
+struct FFlareBattleCombatant
+{
+	UFlareSimulatedSpacecraft*                            Spacecraft;
+
+	/** Static data, extracted once per battle */
+	int32                                                 CompanyIndex;
+	EFlarePartSize::Type                                  Size;
+	bool                                                  IsStation;
+	bool                                                  IsMilitary;
+
+	/** Component descriptions, in spacecraft component order */
+	TArray<FFlareSpacecraftComponentDescription*>         ComponentDescriptions;
+
+	/** Turret component indices, for large ships */
+	TArray<int32>                                         Turrets;
+
+	/** Hostile combatant indices */
+	TArray<int32>                                         Targets;
+
+	/** Damage state, refreshed when the spacecraft is hit */
+	bool                                                  IsAlive;
+	bool                                                  IsDisarmed;
+	bool                                                  IsStranded;
+	bool                                                  IsUncontrollable;
+	bool                                                  IsHarpooned;
+};
+
+
 UCLASS()
 class HELIUMRAIN_API UFlareBattle : public UObject
 {
@@ -29,33 +58,48 @@ public:
 
 	bool SimulateTurn();
 
-	bool SimulateShipTurn(UFlareSimulatedSpacecraft* Ship);
+	bool SimulateShipTurn(int32 ShipIndex);
 
-	bool SimulateSmallShipTurn(UFlareSimulatedSpacecraft* Ship);
+	bool SimulateSmallShipTurn(int32 ShipIndex);
 
-	bool SimulateLargeShipTurn(UFlareSimulatedSpacecraft* Ship);
+	bool SimulateLargeShipTurn(int32 ShipIndex);
 
-	UFlareSimulatedSpacecraft* GetBestTarget(UFlareSimulatedSpacecraft* Ship, struct BattleTargetPreferences Preferences);
+	int32 GetBestTarget(int32 ShipIndex, struct BattleTargetPreferences Preferences);
 
-	bool SimulateShipAttack(UFlareSimulatedSpacecraft* Ship, int32 WeaponGroupIndex, UFlareSimulatedSpacecraft* Target);
+	bool SimulateShipAttack(int32 ShipIndex, int32 WeaponGroupIndex, int32 TargetIndex);
 
-	bool SimulateShipWeaponAttack(UFlareSimulatedSpacecraft* Ship, FFlareSpacecraftComponentDescription* WeaponDescription, FFlareSpacecraftComponentSave* Weapon, UFlareSimulatedSpacecraft* Target);
+	bool SimulateShipWeaponAttack(int32 ShipIndex, FFlareSpacecraftComponentDescription* WeaponDescription, FFlareSpacecraftComponentSave* Weapon, int32 TargetIndex);
 
-	void SimulateBulletDamage(FFlareSpacecraftComponentDescription* WeaponDescription, UFlareSimulatedSpacecraft* Target, UFlareCompany* DamageSource);
+	void SimulateBulletDamage(FFlareSpacecraftComponentDescription* WeaponDescription, int32 TargetIndex, UFlareCompany* DamageSource);
 
-	void SimulateBombDamage(FFlareSpacecraftComponentDescription* WeaponDescription, UFlareSimulatedSpacecraft* Target, UFlareCompany* DamageSource);
+	void SimulateBombDamage(FFlareSpacecraftComponentDescription* WeaponDescription, int32 TargetIndex, UFlareCompany* DamageSource);
 
-	void ApplyDamage(UFlareSimulatedSpacecraft* Target, float Energy, EFlareDamage::Type DamageType, UFlareCompany* DamageSource);
+	void ApplyDamage(int32 TargetIndex, float Energy, EFlareDamage::Type DamageType, UFlareCompany* DamageSource);
 
-	int32 GetBestTargetComponent(UFlareSimulatedSpacecraft* TargetSpacecraft);
+	int32 GetBestTargetComponent(int32 TargetIndex);
 
 protected:
 
+	/** Extract the combatants from the sector */
+	void LoadCombatants();
+
+	/** Refresh the damage state of a combatant */
+	void UpdateCombatantState(FFlareBattleCombatant& Combatant);
+
+	/** Update the fighting companies for the next turn */
+	void UpdateFightingCompanies();
+
 	UFlareSimulatedSector*                  Sector;
 	AFlareGame*                             Game;
 	UFlareCompany*                          PlayerCompany;
 	UFlareSpacecraftComponentsCatalog*      Catalog;
 
+	// Battle state
+	TArray<FFlareBattleCombatant>           Combatants;
+	TArray<UFlareCompany*>                  Companies;
+	TArray<bool>                            FightingCompanies;
+	bool                                    BattleInProgress;
+
 public:
 
 	/*----------------------------------------------------
@@ -67,5 +111,8 @@ public:
 		return Game;
 	}
 
-        bool HasBattle();
+	bool HasBattle() const
+	{
+		return BattleInProgress;
+	}
 };
@@ -0,0 +1,177 @@
+
+#include "../Flare.h"
+#include "FlareCollisionBroadphase.h"
+#include "FlareSector.h"
+#include "FlareCollider.h"
+#include "FlareAsteroid.h"
+#include "../Spacecrafts/FlareSpacecraft.h"
+
+DECLARE_CYCLE_STAT(TEXT("FlareCollisionBroadphase Update"), STAT_FlareCollisionBroadphase_Update, STATGROUP_Flare);
+
+
+// Time over which trajectories are predicted, in seconds
+#define COLLISION_BROADPHASE_HORIZON 5.f
+
+// Margin on body sizes : two bodies about to touch within the horizon get closer than sqrt(2) times their size sum
+#define COLLISION_BROADPHASE_SIZE_MARGIN 1.5f
+
+
+/*----------------------------------------------------
+	Public API
+----------------------------------------------------*/
+
+FFlareCollisionBroadphase::FFlareCollisionBroadphase()
+	: Frame(0)
+{
+}
+
+void FFlareCollisionBroadphase::Update(UFlareSector* Sector)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlareCollisionBroadphase_Update);
+
+	Frame = GFrameCounter;
+	Bodies.Reset();
+	BodyIndices.Reset();
+
+	// Spacecrafts
+	for (AFlareSpacecraft* Spacecraft : Sector->GetSpacecrafts())
+	{
+		FBox Box = Spacecraft->GetComponentsBoundingBox();
+		AddBody(Spacecraft, Spacecraft, (Box.Max + Box.Min) / 2.0, Spacecraft->Airframe->GetPhysicsLinearVelocity(), FMath::Max(Box.GetExtent().Size(), 1.0f));
+	}
+
+	// Asteroids
+	for (AFlareAsteroid* Asteroid : Sector->GetAsteroids())
+	{
+		float Size = Cast<UStaticMeshComponent>(Asteroid->GetRootComponent())->Bounds.SphereRadius;
+		AddBody(Asteroid, NULL, Asteroid->GetActorLocation(), Asteroid->GetAsteroidComponent()->GetPhysicsLinearVelocity(), Size);
+	}
+
+	// Colliders
+	TArray<AActor*> ColliderActorList;
+	UGameplayStatics::GetAllActorsOfClass(Sector->GetGame()->GetWorld(), AFlareCollider::StaticClass(), ColliderActorList);
+	for (AActor* Collider : ColliderActorList)
+	{
+		float Size = Cast<UStaticMeshComponent>(Collider->GetRootComponent())->Bounds.SphereRadius;
+		AddBody(Collider, NULL, Collider->GetActorLocation(), FVector::ZeroVector, Size);
+	}
+
+	// Sort along X
+	SortedBodies.Reset();
+	for (int32 BodyIndex = 0; BodyIndex < Bodies.Num(); BodyIndex++)
+	{
+		SortedBodies.Add(BodyIndex);
+	}
+	SortedBodies.Sort([this](const int32& A, const int32& B)
+	{
+		return Bodies[A].SweptBox.Min.X < Bodies[B].SweptBox.Min.X;
+	});
+
+	// Sweep : only pairs involving a spacecraft matter
+	Pairs.Reset();
+	for (int32 SortedIndex = 0; SortedIndex < SortedBodies.Num(); SortedIndex++)
+	{
+		const FFlareCollisionBody& Body = Bodies[SortedBodies[SortedIndex]];
+
+		for (int32 OtherSortedIndex = SortedIndex + 1; OtherSortedIndex < SortedBodies.Num(); OtherSortedIndex++)
+		{
+			const FFlareCollisionBody& OtherBody = Bodies[SortedBodies[OtherSortedIndex]];
+
+			if (OtherBody.SweptBox.Min.X > Body.SweptBox.Max.X)
+			{
+				break;
+			}
+
+			if ((Body.Spacecraft || OtherBody.Spacecraft) && Body.SweptBox.Intersect(OtherBody.SweptBox))
+			{
+				if (Body.Spacecraft)
+				{
+					Pairs.Add(TPair<int32, int32>(SortedBodies[SortedIndex], SortedBodies[OtherSortedIndex]));
+				}
+				if (OtherBody.Spacecraft)
+				{
+					Pairs.Add(TPair<int32, int32>(SortedBodies[OtherSortedIndex], SortedBodies[SortedIndex]));
+				}
+			}
+		}
+	}
+
+	// Store the candidates of each body contiguously
+	Pairs.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	CandidateStarts.SetNumZeroed(Bodies.Num() + 1);
+	Candidates.Reset();
+
+	int32 PairIndex = 0;
+	for (int32 BodyIndex = 0; BodyIndex < Bodies.Num(); BodyIndex++)
+	{
+		CandidateStarts[BodyIndex] = Candidates.Num();
+		while (PairIndex < Pairs.Num() && Pairs[PairIndex].Key == BodyIndex)
+		{
+			Candidates.Add(Pairs[PairIndex].Value);
+			PairIndex++;
+		}
+	}
+	CandidateStarts[Bodies.Num()] = Candidates.Num();
+}
+
+void FFlareCollisionBroadphase::Clear()
+{
+	Bodies.Empty();
+	BodyIndices.Empty();
+	SortedBodies.Empty();
+	CandidateStarts.Empty();
+	Candidates.Empty();
+	Pairs.Empty();
+	Frame = 0;
+}
+
+int32 FFlareCollisionBroadphase::FindBody(AActor* Actor) const
+{
+	const int32* BodyIndex = BodyIndices.Find(Actor);
+	return (BodyIndex ? *BodyIndex : INDEX_NONE);
+}
+
+int32 FFlareCollisionBroadphase::GetCandidateCount(int32 BodyIndex) const
+{
+	return CandidateStarts[BodyIndex + 1] - CandidateStarts[BodyIndex];
+}
+
+const FFlareCollisionBody& FFlareCollisionBroadphase::GetCandidate(int32 BodyIndex, int32 CandidateIndex) const
+{
+	return Bodies[Candidates[CandidateStarts[BodyIndex] + CandidateIndex]];
+}
+
+float FFlareCollisionBroadphase::GetHorizon()
+{
+	return COLLISION_BROADPHASE_HORIZON;
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+void FFlareCollisionBroadphase::AddBody(AActor* Actor, AFlareSpacecraft* Spacecraft, FVector Center, FVector Velocity, float Size)
+{
+	FFlareCollisionBody Body;
+	Body.Actor = Actor;
+	Body.Spacecraft = Spacecraft;
+	Body.ActorLocation = Actor->GetActorLocation();
+	Body.Center = Center;
+	Body.Velocity = Velocity;
+	Body.Size = Size;
+
+	// Cover both the actor location and the bounds center, at the start and the end of the horizon
+	float Radius = Size * COLLISION_BROADPHASE_SIZE_MARGIN + (Body.ActorLocation - Center).Size();
+	FVector Extent = FVector(Radius);
+	FVector EndCenter = Center + Velocity * COLLISION_BROADPHASE_HORIZON;
+
+	Body.SweptBox = FBox(Center - Extent, Center + Extent);
+	Body.SweptBox += FBox(EndCenter - Extent, EndCenter + Extent);
+
+	BodyIndices.Add(Actor, Bodies.Add(Body));
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Engine.h"
+
+
+class UFlareSector;
+class AFlareSpacecraft;
+
+
+/** A moving obstacle, as seen by the anticollision */
+struct FFlareCollisionBody
+{
+	AActor*              Actor;
+
+	/** Spacecraft, or NULL for asteroids and colliders */
+	AFlareSpacecraft*    Spacecraft;
+
+	FVector              ActorLocation;
+	FVector              Center;
+	FVector              Velocity;
+	float                Size;
+
+	/** Volume swept by the body during the prediction horizon */
+	FBox                 SweptBox;
+};
+
+
+/** Sort-and-sweep broadphase over the predicted trajectories of the active sector's obstacles, built once per frame for all ships */
+class HELIUMRAIN_API FFlareCollisionBroadphase
+{
+public:
+
+	FFlareCollisionBroadphase();
+
+	/*----------------------------------------------------
+		Public API
+	----------------------------------------------------*/
+
+	/** Rebuild the bodies and candidate pairs from the sector */
+	void Update(UFlareSector* Sector);
+
+	/** Forget everything */
+	void Clear();
+
+	/** Get the index of a body, or INDEX_NONE */
+	int32 FindBody(AActor* Actor) const;
+
+	/** Get the number of bodies whose swept volume overlaps this one */
+	int32 GetCandidateCount(int32 BodyIndex) const;
+
+	/** Get a body whose swept volume overlaps this one */
+	const FFlareCollisionBody& GetCandidate(int32 BodyIndex, int32 CandidateIndex) const;
+
+	/** Time over which trajectories are predicted, in seconds */
+	static float GetHorizon();
+
+
+	/*----------------------------------------------------
+		Getters
+	----------------------------------------------------*/
+
+	inline const TArray<FFlareCollisionBody>& GetBodies() const
+	{
+		return Bodies;
+	}
+
+	inline uint64 GetFrame() const
+	{
+		return Frame;
+	}
+
+
+protected:
+
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Add a body and compute its swept volume */
+	void AddBody(AActor* Actor, AFlareSpacecraft* Spacecraft, FVector Center, FVector Velocity, float Size);
+
+
+	/*----------------------------------------------------
+		Data
+	----------------------------------------------------*/
+
+	TArray<FFlareCollisionBody>                     Bodies;
+	TMap<AActor*, int32>                            BodyIndices;
+
+	/** Bodies sorted along X, for the sweep */
+	TArray<int32>                                   SortedBodies;
+
+	/** Candidates of each body, stored contiguously : body N owns CandidateStarts[N] to CandidateStarts[N + 1] */
+	TArray<int32>                                   CandidateStarts;
+	TArray<int32>                                   Candidates;
+	TArray<TPair<int32, int32>>                     Pairs;
+
+	uint64                                          Frame;
+
+};
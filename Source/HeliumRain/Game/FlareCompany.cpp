@@ -11,6 +11,8 @@
 #include "AI/FlareAIBehavior.h"
 
 
+DECLARE_CYCLE_STAT(TEXT("FlareCompany UpdateAssetValue"), STAT_FlareCompany_UpdateAssetValue, STATGROUP_Flare);
+
 #define LOCTEXT_NAMESPACE "FlareCompany"
 
 
@@ -20,6 +22,7 @@
 
 UFlareCompany::UFlareCompany(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, AssetValueDirty(true)
 {
 }
 
@@ -369,6 +372,8 @@ void UFlareCompany::SetHostilityTo(UFlareCompany* TargetCompany, bool Hostile)
 			}
 			Game->GetQuestManager()->OnWarStateChanged(this, TargetCompany);
 		}
+
+		Game->GetWorldEvents().Notify(EFlareWorldEvent::Companies);
 	}
 }
 
@@ -562,6 +567,8 @@ UFlareSimulatedSpacecraft* UFlareCompany::LoadSpacecraft(const FFlareSpacecraftS
 			}
 
 			CompanySpacecrafts.AddUnique((Spacecraft));
+			InvalidateCompanyValue();
+			Game->GetWorldEvents().Notify(EFlareWorldEvent::Fleets);
 		}
 	}
 	else
@@ -579,6 +586,8 @@ void UFlareCompany::DestroySpacecraft(UFlareSimulatedSpacecraft* Spacecraft)
 	CompanySpacecrafts.Remove(Spacecraft);
 	CompanyStations.Remove(Spacecraft);
 	CompanyShips.Remove(Spacecraft);
+	InvalidateCompanyValue();
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Fleets);
 	if (Spacecraft->GetCurrentFleet())
 	{
 		Spacecraft->GetCurrentFleet()->RemoveShip(Spacecraft, true);
@@ -598,6 +607,7 @@ void UFlareCompany::DestroySpacecraft(UFlareSimulatedSpacecraft* Spacecraft)
 void UFlareCompany::DiscoverSector(UFlareSimulatedSector* Sector)
 {
 	KnownSectors.AddUnique(Sector);
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Sectors);
 }
 
 void UFlareCompany::VisitSector(UFlareSimulatedSector* Sector)
@@ -610,6 +620,11 @@ void UFlareCompany::VisitSector(UFlareSimulatedSector* Sector)
 	}
 }
 
+void UFlareCompany::InvalidateCompanyValue()
+{
+	AssetValueDirty = true;
+}
+
 bool UFlareCompany::TakeMoney(int64 Amount, bool AllowDepts)
 {
 	if (Amount < 0 || (Amount > CompanyData.Money && !AllowDepts))
@@ -621,6 +636,7 @@ bool UFlareCompany::TakeMoney(int64 Amount, bool AllowDepts)
 	else
 	{
 		CompanyData.Money -= Amount;
+		Game->GetWorldEvents().Notify(EFlareWorldEvent::Money);
 		/*if (Amount > 0)
 		{
 
@@ -640,6 +656,7 @@ void UFlareCompany::GiveMoney(int64 Amount)
 	}
 
 	CompanyData.Money += Amount;
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Money);
 
 	if (this == Game->GetPC()->GetCompany() && GetGame()->GetQuestManager())
 	{
@@ -1425,26 +1442,47 @@ struct CompanyValue UFlareCompany::GetCompanyValue(UFlareSimulatedSector* Sector
 	// - value of the stock in these spacecraft
 	// - value of the resources used in factory
 
+	// Assets are only computed again after a change
+	if (AssetValueDirty)
+	{
+		UFlareCompany* UnprotectedThis = const_cast<UFlareCompany*>(this);
+		UnprotectedThis->UpdateAssetValue();
+	}
+
 	struct CompanyValue Value;
+	if (SectorFilter)
+	{
+		const struct CompanyValue* SectorValue = (IncludeIncoming ? IncomingSectorAssetValues : SectorAssetValues).Find(SectorFilter);
+		if (SectorValue)
+		{
+			Value = *SectorValue;
+		}
+	}
+	else
+	{
+		Value = AssetValue;
+	}
+
 	Value.MoneyValue = GetMoney();
-	Value.StockValue = 0;
-	Value.ShipsValue = 0;
-	Value.ArmyValue = 0;
-	Value.ArmyCurrentCombatPoints = 0;
-	Value.ArmyTotalCombatPoints = 0;
-	Value.StationsValue = 0;
+	Value.TotalValue = Value.MoneyValue + Value.StockValue + Value.SpacecraftsValue;
+
+	return Value;
+}
+
+void UFlareCompany::UpdateAssetValue()
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlareCompany_UpdateAssetValue);
+
+	AssetValue = CompanyValue();
+	SectorAssetValues.Reset();
+	IncomingSectorAssetValues.Reset();
 
 	for (int SpacecraftIndex = 0; SpacecraftIndex < CompanySpacecrafts.Num(); SpacecraftIndex++)
 	{
 		UFlareSimulatedSpacecraft* Spacecraft = CompanySpacecrafts[SpacecraftIndex];
 
-		UFlareSimulatedSector *ReferenceSector =  Spacecraft->GetCurrentSector();
-
-		if(SectorFilter && !IncludeIncoming && SectorFilter != ReferenceSector)
-		{
-			// Not in sector filter
-			continue;
-		}
+		UFlareSimulatedSector* CurrentSector = Spacecraft->GetCurrentSector();
+		UFlareSimulatedSector* ReferenceSector = CurrentSector;
 
 		if (!ReferenceSector)
 		{
@@ -1457,46 +1495,41 @@ struct CompanyValue UFlareCompany::GetCompanyValue(UFlareSimulatedSector* Sector
 				FLOGV("Spacecraft %s is lost : no current sector, no travel", *Spacecraft->GetImmatriculation().ToString());
 				continue;
 			}
-
 		}
 
-		if(SectorFilter && IncludeIncoming && SectorFilter != ReferenceSector)
-		{
-			// Not in sector filter
-			continue;
-		}
+		struct CompanyValue SpacecraftValue;
 
 		// Value of the spacecraft
 		int64 SpacecraftPrice = UFlareGameTools::ComputeSpacecraftPrice(Spacecraft->GetDescription()->Identifier, ReferenceSector, true);
 
 		if(Spacecraft->IsStation())
 		{
-			Value.StationsValue += SpacecraftPrice;
+			SpacecraftValue.StationsValue += SpacecraftPrice;
 		}
 		else
 		{
-			Value.ShipsValue += SpacecraftPrice;
+			SpacecraftValue.ShipsValue += SpacecraftPrice;
 		}
 
 		if(Spacecraft->IsMilitary())
 		{
-			Value.ArmyValue += SpacecraftPrice;
-			Value.ArmyTotalCombatPoints += Spacecraft->GetCombatPoints(false);
-			Value.ArmyCurrentCombatPoints += Spacecraft->GetCombatPoints(true);
+			SpacecraftValue.ArmyValue += SpacecraftPrice;
+			SpacecraftValue.ArmyTotalCombatPoints += Spacecraft->GetCombatPoints(false);
+			SpacecraftValue.ArmyCurrentCombatPoints += Spacecraft->GetCombatPoints(true);
 		}
 
 		// Value of the stock
-		TArray<FFlareCargo>& CargoBaySlots = Spacecraft->GetCargoBay()->GetSlots();
+		const TArray<FFlareCargo>& CargoBaySlots = Spacecraft->GetCargoBay()->GetSlots();
 		for (int CargoIndex = 0; CargoIndex < CargoBaySlots.Num(); CargoIndex++)
 		{
-			FFlareCargo& Cargo = CargoBaySlots[CargoIndex];
+			const FFlareCargo& Cargo = CargoBaySlots[CargoIndex];
 
 			if (!Cargo.Resource)
 			{
 				continue;
 			}
 
-			Value.StockValue += ReferenceSector->GetResourcePrice(Cargo.Resource, EFlareResourcePriceContext::Default) * Cargo.Quantity;
+			SpacecraftValue.StockValue += ReferenceSector->GetResourcePrice(Cargo.Resource, EFlareResourcePriceContext::Default) * Cargo.Quantity;
 		}
 
 		// Value of factory stock
@@ -1512,7 +1545,7 @@ struct CompanyValue UFlareCompany::GetCompanyValue(UFlareSimulatedSector* Sector
 				FFlareResourceDescription* Resource = Game->GetResourceCatalog()->Get(ResourceIdentifier);
 				if (Resource)
 				{
-					Value.StockValue += ReferenceSector->GetResourcePrice(Resource, EFlareResourcePriceContext::Default) * Quantity;
+					SpacecraftValue.StockValue += ReferenceSector->GetResourcePrice(Resource, EFlareResourcePriceContext::Default) * Quantity;
 				}
 				else
 				{
@@ -1520,12 +1553,19 @@ struct CompanyValue UFlareCompany::GetCompanyValue(UFlareSimulatedSector* Sector
 				}
 			}
 		}
-	}
 
-	Value.SpacecraftsValue = Value.ShipsValue + Value.StationsValue;
-	Value.TotalValue = Value.MoneyValue + Value.StockValue + Value.SpacecraftsValue;
+		SpacecraftValue.SpacecraftsValue = SpacecraftValue.ShipsValue + SpacecraftValue.StationsValue;
 
-	return Value;
+		// Ships in a sector, and ships in a sector or traveling to it
+		AssetValue.AddAssets(SpacecraftValue);
+		if (CurrentSector)
+		{
+			SectorAssetValues.FindOrAdd(CurrentSector).AddAssets(SpacecraftValue);
+		}
+		IncomingSectorAssetValues.FindOrAdd(ReferenceSector).AddAssets(SpacecraftValue);
+	}
+
+	AssetValueDirty = false;
 }
 
 UFlareSimulatedSpacecraft* UFlareCompany::FindSpacecraft(FName ShipImmatriculation, bool Destroyed)
@@ -30,6 +30,30 @@ struct CompanyValue
 
 	/** Money + Spacecrafts + Stock */
 	int64 TotalValue;
+
+	CompanyValue()
+		: MoneyValue(0)
+		, StockValue(0)
+		, ShipsValue(0)
+		, ArmyValue(0)
+		, ArmyTotalCombatPoints(0)
+		, ArmyCurrentCombatPoints(0)
+		, StationsValue(0)
+		, SpacecraftsValue(0)
+		, TotalValue(0)
+	{}
+
+	/** Add the assets of another value, money excluded */
+	void AddAssets(const CompanyValue& Other)
+	{
+		StockValue += Other.StockValue;
+		ShipsValue += Other.ShipsValue;
+		ArmyValue += Other.ArmyValue;
+		ArmyTotalCombatPoints += Other.ArmyTotalCombatPoints;
+		ArmyCurrentCombatPoints += Other.ArmyCurrentCombatPoints;
+		StationsValue += Other.StationsValue;
+		SpacecraftsValue += Other.SpacecraftsValue;
+	}
 };
 
 
@@ -173,6 +197,9 @@ public:
 	/** Set a sector visited */
 	virtual void VisitSector(UFlareSimulatedSector* Sector);
 
+	/** Mark the company value ledger as outdated after a change in spacecrafts, cargo, damage or prices */
+	void InvalidateCompanyValue();
+
 
 	/** Take a money amount from the company */
 	virtual bool TakeMoney(int64 Amount, bool AllowDepts = false);
@@ -295,6 +322,15 @@ protected:
 	int32                                   ResearchAmount;
 	TMap<FName, FFlareTechnologyDescription*> UnlockedTechnologies;
 
+	// Company value ledger, money excluded
+	struct CompanyValue                     AssetValue;
+	TMap<UFlareSimulatedSector*, struct CompanyValue> SectorAssetValues;
+	TMap<UFlareSimulatedSector*, struct CompanyValue> IncomingSectorAssetValues;
+	bool                                    AssetValueDirty;
+
+	/** Compute the value of all spacecrafts and their stock, in total and by sector */
+	void UpdateAssetValue();
+
 
 public:
 
@@ -3,6 +3,7 @@
 #include "FlareGame.h"
 #include "FlareDebrisField.h"
 #include "FlareSimulatedSector.h"
+#include "../Player/FlarePlayerController.h"
 
 #include "StaticMeshResources.h"
 
@@ -10,6 +11,16 @@
 #define LOCTEXT_NAMESPACE "FlareDebrisField"
 
 
+// Debris closer than this to the player become full physics actors, in centimeters
+#define DEBRIS_PROMOTION_DISTANCE 50000.f
+
+// Promoted debris farther than this go back to being instances, in centimeters
+#define DEBRIS_DEMOTION_DISTANCE 75000.f
+
+// Time between two promotion checks, in seconds
+#define DEBRIS_PROMOTION_PERIOD 0.5f
+
+
 /*----------------------------------------------------
 	Constructor
 ----------------------------------------------------*/
@@ -18,6 +29,9 @@ UFlareDebrisField::UFlareDebrisField(const FObjectInitializer& ObjectInitializer
 	: Super(ObjectInitializer)
 {
 	CurrentGenerationIndex = 0;
+	TimeSincePromotionCheck = 0;
+	IsPaused = false;
+	DebrisFieldActor = NULL;
 }
 
 void UFlareDebrisField::Setup(AFlareGame* GameMode, UFlareSimulatedSector* Sector)
@@ -29,7 +43,7 @@ void UFlareDebrisField::Setup(AFlareGame* GameMode, UFlareSimulatedSector* Secto
 	Game = GameMode;
 	const FFlareDebrisFieldInfo* DebrisFieldInfo = &Sector->GetDescription()->DebrisFieldInfo;
 	UFlareAsteroidCatalog* DebrisFieldMeshes = DebrisFieldInfo->DebrisCatalog;
-	TArray<AStaticMeshActor*> NewDebris;
+	DebrisField.Empty();
 
 	// Add debris
 	if (DebrisFieldInfo && DebrisFieldMeshes)
@@ -47,9 +61,11 @@ void UFlareDebrisField::Setup(AFlareGame* GameMode, UFlareSimulatedSector* Secto
 			float MaxSize = DebrisFieldInfo->MaxDebrisSize;
 			float Size = FMath::FRandRange(MinSize, MaxSize);
 
-			FName Name = FName(*(FString::Printf(TEXT("DebrisGen%dIndex%d"), CurrentGenerationIndex, Index)));
-
-			NewDebris.Add(AddDebris(Sector, DebrisFieldMeshes->Asteroids[DebrisIndex], Size, SectorScale, Name));
+			int32 ComponentIndex = GetDebrisComponent(Sector, DebrisFieldMeshes->Asteroids[DebrisIndex]);
+			if (ComponentIndex != INDEX_NONE)
+			{
+				AddDebris(Sector, ComponentIndex, Size, SectorScale);
+			}
 		}
 	}
 	else
@@ -57,36 +73,93 @@ void UFlareDebrisField::Setup(AFlareGame* GameMode, UFlareSimulatedSector* Secto
 		FLOG("UFlareDebrisField::Setup : debris catalog not available, skipping");
 	}
 
-	// Remember new debris
-	DebrisField.Empty();
-	for (int DebrisIndex = 0; DebrisIndex < NewDebris.Num(); DebrisIndex++)
-	{
-		if (NewDebris[DebrisIndex])
-		{
-			DebrisField.Add(NewDebris[DebrisIndex]);
-		}
-	}
-
+	TimeSincePromotionCheck = DEBRIS_PROMOTION_PERIOD;
 	CurrentGenerationIndex++;
 }
 
 void UFlareDebrisField::Reset()
 {
-	FLOGV("UFlareDebrisField::Reset : clearing debris field, size = %d", DebrisField.Num());
-	for (int i = 0; i < DebrisField.Num(); i++)
+	FLOGV("UFlareDebrisField::Reset : clearing debris field, size = %d, promoted = %d", DebrisField.Num(), DebrisActors.Num());
+	for (int i = 0; i < DebrisActors.Num(); i++)
+	{
+		Game->GetWorld()->DestroyActor(DebrisActors[i]);
+	}
+	for (int i = 0; i < DebrisComponents.Num(); i++)
+	{
+		DebrisComponents[i]->DestroyComponent();
+	}
+	if (DebrisFieldActor)
 	{
-		Game->GetWorld()->DestroyActor(DebrisField[i]);
+		Game->GetWorld()->DestroyActor(DebrisFieldActor);
+		DebrisFieldActor = NULL;
 	}
 	DebrisField.Empty();
+	DebrisActors.Empty();
+	DebrisComponents.Empty();
 }
 
 void UFlareDebrisField::SetWorldPause(bool Pause)
 {
-	for (int i = 0; i < DebrisField.Num(); i++)
+	IsPaused = Pause;
+
+	for (int i = 0; i < DebrisComponents.Num(); i++)
+	{
+		DebrisComponents[i]->SetHiddenInGame(Pause);
+	}
+
+	for (int i = 0; i < DebrisActors.Num(); i++)
+	{
+		DebrisActors[i]->SetActorHiddenInGame(Pause);
+		DebrisActors[i]->CustomTimeDilation = (Pause ? 0.f : 1.0);
+		Cast<UPrimitiveComponent>(DebrisActors[i]->GetRootComponent())->SetSimulatePhysics(!Pause);
+	}
+}
+
+void UFlareDebrisField::Tick(float DeltaSeconds)
+{
+	TimeSincePromotionCheck += DeltaSeconds;
+	if (IsPaused || TimeSincePromotionCheck < DEBRIS_PROMOTION_PERIOD || DebrisField.Num() == 0)
+	{
+		return;
+	}
+	TimeSincePromotionCheck = 0;
+
+	AFlareSpacecraft* PlayerShip = Game->GetPC()->GetShipPawn();
+	if (!PlayerShip)
+	{
+		return;
+	}
+
+	// Only the debris the player can interact with need to be simulated
+	FVector PlayerLocation = PlayerShip->GetActorLocation();
+	for (FFlareDebris& Debris : DebrisField)
+	{
+		if (Debris.Actor)
+		{
+			if (FVector::DistSquared(Debris.Actor->GetActorLocation(), PlayerLocation) > FMath::Square(DEBRIS_DEMOTION_DISTANCE))
+			{
+				DemoteDebris(Debris);
+			}
+		}
+		else if (FVector::DistSquared(Debris.Transform.GetLocation(), PlayerLocation) < FMath::Square(DEBRIS_PROMOTION_DISTANCE))
+		{
+			PromoteDebris(Debris);
+		}
+	}
+}
+
+
+void UFlareDebrisField::GetDebrisBounds(TArray<FSphere>& Bounds) const
+{
+	Bounds.Reset(DebrisField.Num());
+
+	for (const FFlareDebris& Debris : DebrisField)
 	{
-		DebrisField[i]->SetActorHiddenInGame(Pause);
-		DebrisField[i]->CustomTimeDilation = (Pause ? 0.f : 1.0);
-		Cast<UPrimitiveComponent>(DebrisField[i]->GetRootComponent())->SetSimulatePhysics(!Pause);
+		UStaticMesh* Mesh = DebrisComponents[Debris.ComponentIndex]->GetStaticMesh();
+		FTransform Transform = (Debris.Actor ? Debris.Actor->GetActorTransform() : Debris.Transform);
+		FBoxSphereBounds MeshBounds = Mesh->GetBounds().TransformBy(Transform);
+
+		Bounds.Add(FSphere(MeshBounds.Origin, MeshBounds.SphereRadius));
 	}
 }
 
@@ -95,58 +168,141 @@ void UFlareDebrisField::SetWorldPause(bool Pause)
 	Internals
 ----------------------------------------------------*/
 
-AStaticMeshActor* UFlareDebrisField::AddDebris(UFlareSimulatedSector* Sector, UStaticMesh* Mesh, float Size, float SectorScale, FName Name)
+void UFlareDebrisField::AddDebris(UFlareSimulatedSector* Sector, int32 ComponentIndex, float Size, float SectorScale)
 {
-	FActorSpawnParameters Params;
-	Params.Name = Name;
-	Params.Owner = Game;
-	Params.bNoFail = false;
-	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::DontSpawnIfColliding;
-
 	// Compute size, location and rotation
 	FVector Location = FMath::VRand() * SectorScale * FMath::FRandRange(0.2, 1.0);
 	FRotator Rotation = FRotator(FMath::FRandRange(0, 360), FMath::FRandRange(0, 360), FMath::FRandRange(0, 360));
 
+	// Don't place debris inside stations, asteroids or other debris
+	FBoxSphereBounds MeshBounds = DebrisComponents[ComponentIndex]->GetStaticMesh()->GetBounds();
+	FVector Center = Location + Rotation.RotateVector(MeshBounds.Origin * Size);
+	FCollisionShape Shape = FCollisionShape::MakeSphere(MeshBounds.SphereRadius * Size);
+	if (Game->GetWorld()->OverlapBlockingTestByProfile(Center, FQuat::Identity, "BlockAllDynamic", Shape))
+	{
+		return;
+	}
+
+	FFlareDebris Debris;
+	Debris.ComponentIndex = ComponentIndex;
+	Debris.Transform = FTransform(Rotation, Location, Size * FVector(1, 1, 1));
+	Debris.InstanceIndex = DebrisComponents[ComponentIndex]->AddInstanceWorldSpace(Debris.Transform);
+	Debris.Actor = NULL;
+
+	DebrisField.Add(Debris);
+}
+
+int32 UFlareDebrisField::GetDebrisComponent(UFlareSimulatedSector* Sector, UStaticMesh* Mesh)
+{
+	for (int32 ComponentIndex = 0; ComponentIndex < DebrisComponents.Num(); ComponentIndex++)
+	{
+		if (DebrisComponents[ComponentIndex]->GetStaticMesh() == Mesh)
+		{
+			return ComponentIndex;
+		}
+	}
+
+	// Components are owned by an actor, so that hits report it
+	if (!DebrisFieldActor)
+	{
+		FActorSpawnParameters Params;
+		Params.Owner = Game;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		DebrisFieldActor = Game->GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, Params);
+		if (!DebrisFieldActor)
+		{
+			FLOG("UFlareDebrisField::GetDebrisComponent : failed to spawn debris field actor")
+			return INDEX_NONE;
+		}
+	}
+
+	// Create a new component for this mesh
+	UInstancedStaticMeshComponent* DebrisComponent = NewObject<UInstancedStaticMeshComponent>(DebrisFieldActor);
+	if (!DebrisComponent)
+	{
+		FLOG("UFlareDebrisField::GetDebrisComponent : failed to create debris component")
+		return INDEX_NONE;
+	}
+
+	DebrisComponent->SetMobility(EComponentMobility::Movable);
+	DebrisComponent->SetStaticMesh(Mesh);
+	DebrisComponent->SetCollisionProfileName("BlockAllDynamic");
+	DebrisComponent->RegisterComponentWithWorld(Game->GetWorld());
+
+	// Set material
+	int32 LODCOunt = Mesh->GetNumLODs();
+	UMaterialInstanceDynamic* DebrisMaterial = UMaterialInstanceDynamic::Create(DebrisComponent->GetMaterial(0), DebrisComponent->GetWorld());
+	if (DebrisMaterial)
+	{
+		for (int32 i = 0; i < LODCOunt; i++)
+		{
+			DebrisComponent->SetMaterial(i, DebrisMaterial);
+		}
+		DebrisMaterial->SetScalarParameterValue("IceMask", Sector->GetDescription()->IsIcy);
+	}
+	else
+	{
+		FLOG("UFlareDebrisField::GetDebrisComponent : failed to set material (no material or mesh)")
+	}
+
+	return DebrisComponents.Add(DebrisComponent);
+}
+
+void UFlareDebrisField::PromoteDebris(FFlareDebris& Debris)
+{
+	// The location was checked when the field was set up, and the instance being replaced would block it
+	FActorSpawnParameters Params;
+	Params.Owner = Game;
+	Params.bNoFail = false;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
 	// Spawn
-	AStaticMeshActor* DebrisMesh = Game->GetWorld()->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Location, Rotation, Params);
+	UInstancedStaticMeshComponent* InstanceComponent = DebrisComponents[Debris.ComponentIndex];
+	AStaticMeshActor* DebrisMesh = Game->GetWorld()->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Debris.Transform.GetLocation(), Debris.Transform.Rotator(), Params);
 	if (DebrisMesh)
 	{
 		DebrisMesh->SetMobility(EComponentMobility::Movable);
-		DebrisMesh->SetActorScale3D(Size * FVector(1, 1, 1));
+		DebrisMesh->SetActorScale3D(Debris.Transform.GetScale3D());
 		DebrisMesh->SetActorEnableCollision(true);
 
 		// Setup
 		UStaticMeshComponent* DebrisComponent = DebrisMesh->GetStaticMeshComponent();
 		if (DebrisComponent)
 		{
-			DebrisComponent->SetStaticMesh(Mesh);
+			DebrisComponent->SetStaticMesh(InstanceComponent->GetStaticMesh());
 			DebrisComponent->SetSimulatePhysics(true);
 			DebrisComponent->SetCollisionProfileName("BlockAllDynamic");
 
-			int32 LODCOunt = DebrisComponent->GetStaticMesh()->GetNumLODs();
-
-			// Set material
-			UMaterialInstanceDynamic* DebrisMaterial = UMaterialInstanceDynamic::Create(DebrisComponent->GetMaterial(0), DebrisComponent->GetWorld());
-			if (DebrisMaterial)
-			{
-				for (int32 i = 0; i < LODCOunt; i++)
-				{
-					DebrisComponent->SetMaterial(i, DebrisMaterial);
-				}
-				DebrisMaterial->SetScalarParameterValue("IceMask", Sector->GetDescription()->IsIcy);
-			}
-			else
+			// Share the material of the instances
+			for (int32 i = 0; i < InstanceComponent->GetNumMaterials(); i++)
 			{
-				FLOG("UFlareDebrisField::AddDebris : failed to set material (no material or mesh)")
+				DebrisComponent->SetMaterial(i, InstanceComponent->GetMaterial(i));
 			}
 		}
+
+		// Hide the instance
+		FTransform HiddenTransform = Debris.Transform;
+		HiddenTransform.SetScale3D(FVector::ZeroVector);
+		InstanceComponent->UpdateInstanceTransform(Debris.InstanceIndex, HiddenTransform, true, true);
+
+		Debris.Actor = DebrisMesh;
+		DebrisActors.Add(DebrisMesh);
 	}
 	else
 	{
-		FLOG("UFlareDebrisField::AddDebris : failed to spawn debris")
+		FLOG("UFlareDebrisField::PromoteDebris : failed to spawn debris")
 	}
+}
+
+void UFlareDebrisField::DemoteDebris(FFlareDebris& Debris)
+{
+	// Keep the debris where the simulation left it
+	Debris.Transform = Debris.Actor->GetActorTransform();
+	DebrisComponents[Debris.ComponentIndex]->UpdateInstanceTransform(Debris.InstanceIndex, Debris.Transform, true, true);
 
-	return DebrisMesh;
+	DebrisActors.Remove(Debris.Actor);
+	Game->GetWorld()->DestroyActor(Debris.Actor);
+	Debris.Actor = NULL;
 }
 
 
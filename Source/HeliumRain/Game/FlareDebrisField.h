@@ -8,6 +8,21 @@ class AFlareGame;
 class UFlareSimulatedSector;
 
 
+/** A piece of debris, rendered as an instance until it gets close to the player */
+struct FFlareDebris
+{
+	/** Instanced component rendering the debris, and instance index in it */
+	int32                                      ComponentIndex;
+	int32                                      InstanceIndex;
+
+	/** Last known transform */
+	FTransform                                 Transform;
+
+	/** Full actor when promoted, NULL when instanced */
+	AStaticMeshActor*                          Actor;
+};
+
+
 UCLASS()
 class HELIUMRAIN_API UFlareDebrisField : public UObject
 {
@@ -28,6 +43,12 @@ public:
 	/** Toggle the game pause */
 	void SetWorldPause(bool Pause);
 
+	/** Promote debris close to the player to full physics actors, and demote distant ones */
+	void Tick(float DeltaSeconds);
+
+	/** Get the world bounds of every debris */
+	void GetDebrisBounds(TArray<FSphere>& Bounds) const;
+
 
 private:
 
@@ -36,8 +57,17 @@ private:
 	----------------------------------------------------*/
 
 	/** Add debris */
-	AStaticMeshActor* AddDebris(UFlareSimulatedSector* Sector, UStaticMesh* Mesh, float Debris, float SectorScale, FName Name);
-	
+	void AddDebris(UFlareSimulatedSector* Sector, int32 ComponentIndex, float Debris, float SectorScale);
+
+	/** Get the instanced component for a mesh */
+	int32 GetDebrisComponent(UFlareSimulatedSector* Sector, UStaticMesh* Mesh);
+
+	/** Replace an instance by a full actor */
+	void PromoteDebris(FFlareDebris& Debris);
+
+	/** Replace a full actor by an instance */
+	void DemoteDebris(FFlareDebris& Debris);
+
 
 protected:
 
@@ -46,14 +76,27 @@ protected:
     ----------------------------------------------------*/
 
 	/** Debris field */
+	TArray<FFlareDebris>                       DebrisField;
+
+	/** One instanced component per debris mesh */
 	UPROPERTY()
-	TArray<AStaticMeshActor*>                  DebrisField;
-	
+	TArray<UInstancedStaticMeshComponent*>     DebrisComponents;
+
+	/** Actor owning the instanced components, so that collisions have an actor to report */
+	UPROPERTY()
+	AActor*                                    DebrisFieldActor;
+
+	/** Debris promoted to full actors */
+	UPROPERTY()
+	TArray<AStaticMeshActor*>                  DebrisActors;
+
 	/** Game reference */
 	UPROPERTY()
 	AFlareGame*                                Game;
 
 	// Data
 	int32                                      CurrentGenerationIndex;
+	float                                      TimeSincePromotionCheck;
+	bool                                       IsPaused;
 
 };
@@ -312,6 +312,7 @@ void UFlareFleet::AddShip(UFlareSimulatedSpacecraft* Ship)
 	FleetData.ShipImmatriculations.Add(Ship->GetImmatriculation());
 	FleetShips.AddUnique(Ship);
 	Ship->SetCurrentFleet(this);
+	GetGame()->GetWorldEvents().Notify(EFlareWorldEvent::Fleets);
 }
 
 void UFlareFleet::RemoveShip(UFlareSimulatedSpacecraft* Ship, bool destroyed)
@@ -325,6 +326,7 @@ void UFlareFleet::RemoveShip(UFlareSimulatedSpacecraft* Ship, bool destroyed)
 	FleetData.ShipImmatriculations.Remove(Ship->GetImmatriculation());
 	FleetShips.Remove(Ship);
 	Ship->SetCurrentFleet(NULL);
+	GetGame()->GetWorldEvents().Notify(EFlareWorldEvent::Fleets);
 
 	if (!destroyed)
 	{
@@ -420,6 +422,7 @@ void UFlareFleet::SetCurrentSector(UFlareSimulatedSector* Sector)
 
 	CurrentSector = Sector;
 	InitShipList();
+	GetGame()->GetWorldEvents().Notify(EFlareWorldEvent::Fleets);
 }
 
 void UFlareFleet::SetCurrentTravel(UFlareTravel* Travel)
@@ -427,12 +430,25 @@ void UFlareFleet::SetCurrentTravel(UFlareTravel* Travel)
 	CurrentSector = Travel->GetTravelSector();
 	CurrentTravel = Travel;
 	InitShipList();
+	GetGame()->GetWorldEvents().Notify(EFlareWorldEvent::Fleets);
 	for (int ShipIndex = 0; ShipIndex < FleetShips.Num(); ShipIndex++)
 	{
 		FleetShips[ShipIndex]->SetSpawnMode(EFlareSpawnMode::Travel);
 	}
 }
 
+void UFlareFleet::SetCurrentTradeRoute(UFlareTradeRoute* TradeRoute)
+{
+	CurrentTradeRoute = TradeRoute;
+	GetGame()->GetWorldEvents().Notify(EFlareWorldEvent::Fleets);
+}
+
+void UFlareFleet::SetFleetName(FText Name)
+{
+	FleetData.Name = Name;
+	GetGame()->GetWorldEvents().Notify(EFlareWorldEvent::Fleets);
+}
+
 void UFlareFleet::InitShipList()
 {
 	if (!IsShipListLoaded)
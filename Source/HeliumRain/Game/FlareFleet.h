@@ -90,10 +90,7 @@ public:
 
 	void SetCurrentTravel(UFlareTravel* Travel);
 
-	virtual void SetCurrentTradeRoute(UFlareTradeRoute* TradeRoute)
-	{
-		CurrentTradeRoute = TradeRoute;
-	}
+	virtual void SetCurrentTradeRoute(UFlareTradeRoute* TradeRoute);
 
 	virtual void InitShipList();
 
@@ -129,10 +126,7 @@ public:
 
 	FText GetFleetName() const;
 
-	void SetFleetName(FText Name)
-	{
-		FleetData.Name = Name;
-	}
+	void SetFleetName(FText Name);
 
 	UFlareCompany* GetFleetCompany() const
 	{
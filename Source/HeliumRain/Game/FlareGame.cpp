@@ -366,6 +366,10 @@ void AFlareGame::Tick(float DeltaSeconds)
 
 	if (GetActiveSector() != NULL)
 	{
+		GetActiveSector()->UpdateActivation();
+		GetActiveSector()->GetPilotScheduler()->Tick(DeltaSeconds);
+		DebrisFieldSystem->Tick(DeltaSeconds);
+
 		for (int CompanyIndex = 0; CompanyIndex < GetGameWorld()->GetCompanies().Num(); CompanyIndex++)
 		{
 			GetGameWorld()->GetCompanies()[CompanyIndex]->TickAI();
@@ -930,7 +934,6 @@ void AFlareGame::OnLevelLoaded()
 		Planetarium->ResetTime();
 		Planetarium->SkipNight(UFlareGameTools::SECONDS_IN_DAY);
 		ActiveSector->Load(ActivatingSector);
-		DebrisFieldSystem->Setup(this, ActivatingSector);
 
 		GetPC()->OnSectorActivated(ActiveSector);
 	}
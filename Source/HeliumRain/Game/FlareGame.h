@@ -13,6 +13,7 @@
 #include "FlareCompany.h"
 #include "FlareWorld.h"
 #include "FlareSector.h"
+#include "FlareWorldEvents.h"
 #include "Log/FlareLogApi.h"
 
 #include "../Data/FlareSpacecraftCatalog.h"
@@ -225,6 +226,9 @@ protected:
 	float                                      AINerfRatio;
 	int64                                      AINerfRatioCacheDate;
 
+	/** Changes waiting to be sent to the menus */
+	FFlareWorldEvents                          WorldEvents;
+
 	/*----------------------------------------------------
 		Catalogs
 	----------------------------------------------------*/
@@ -436,6 +440,16 @@ public:
 		return DefaultAsteroid;
 	}
 
+	inline UFlareDebrisField* GetDebrisFieldSystem() const
+	{
+		return DebrisFieldSystem;
+	}
+
+	inline FFlareWorldEvents& GetWorldEvents()
+	{
+		return WorldEvents;
+	}
+
 	UFlareScenarioTools* GetScenarioTools()
 	{
 		return ScenarioTools;
@@ -1119,7 +1119,10 @@ void UFlareGameTools::PrintSector(FName SectorIdentifier)
 	for(int32 ResourceIndex = 0; ResourceIndex < GetGame()->GetResourceCatalog()->Resources.Num(); ResourceIndex++)
 	{
 		FFlareResourceDescription* Resource = &GetGame()->GetResourceCatalog()->Resources[ResourceIndex]->Data;
-		FLOGV("   - %s : %f credits", *Resource->Name.ToString(), Sector->GetPreciseResourcePrice(Resource) / 100.);
+		FLOGV("   - %s : %f credits (week mean %f, year mean %f)", *Resource->Name.ToString(),
+			Sector->GetPreciseResourcePrice(Resource) / 100.,
+			Sector->GetPreciseResourcePriceMean(Resource, 0, 6) / 100.,
+			Sector->GetPreciseResourcePriceMean(Resource, 0, 364) / 100.);
 	}
 
 	//People
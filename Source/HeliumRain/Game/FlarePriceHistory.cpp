@@ -0,0 +1,186 @@
+
+#include "../Flare.h"
+#include "FlarePriceHistory.h"
+
+
+// Number of days kept at full resolution, at least a month so that monthly means can be computed
+#define PRICE_HISTORY_DAILY_CAPACITY 64
+
+// Number of weekly means kept, about a year
+#define PRICE_HISTORY_WEEKLY_CAPACITY 52
+
+// Number of monthly means kept, about ten years
+#define PRICE_HISTORY_MONTHLY_CAPACITY 120
+
+
+/*----------------------------------------------------
+	Public API
+----------------------------------------------------*/
+
+FFlarePriceHistory::FFlarePriceHistory()
+	: ResourceCount(0)
+	, DayCount(0)
+{
+	Tiers[EFlarePriceResolution::Daily].Period = 1;
+	Tiers[EFlarePriceResolution::Daily].Capacity = PRICE_HISTORY_DAILY_CAPACITY;
+	Tiers[EFlarePriceResolution::Weekly].Period = 7;
+	Tiers[EFlarePriceResolution::Weekly].Capacity = PRICE_HISTORY_WEEKLY_CAPACITY;
+	Tiers[EFlarePriceResolution::Monthly].Period = 30;
+	Tiers[EFlarePriceResolution::Monthly].Capacity = PRICE_HISTORY_MONTHLY_CAPACITY;
+}
+
+void FFlarePriceHistory::Init(int32 InResourceCount)
+{
+	ResourceCount = InResourceCount;
+	DayCount = 0;
+
+	for (int32 Resolution = 0; Resolution < EFlarePriceResolution::Count; Resolution++)
+	{
+		Tiers[Resolution].Values.Reset();
+		Tiers[Resolution].Values.SetNumZeroed(ResourceCount * Tiers[Resolution].Capacity);
+	}
+}
+
+void FFlarePriceHistory::Append(const TArray<float>& Prices)
+{
+	FCHECK(Prices.Num() == ResourceCount);
+	DayCount++;
+
+	// Daily values come first, so that coarser resolutions can average them
+	for (int32 Resolution = 0; Resolution < EFlarePriceResolution::Count; Resolution++)
+	{
+		FPriceTier& Tier = Tiers[Resolution];
+		if (DayCount % Tier.Period != 0)
+		{
+			continue;
+		}
+
+		for (int32 ResourceIndex = 0; ResourceIndex < ResourceCount; ResourceIndex++)
+		{
+			float Value = Prices[ResourceIndex];
+
+			if (Resolution != EFlarePriceResolution::Daily)
+			{
+				float Sum = 0;
+				for (int32 Day = 0; Day < Tier.Period; Day++)
+				{
+					Sum += Tiers[EFlarePriceResolution::Daily].Values[GetValueIndex(ResourceIndex, EFlarePriceResolution::Daily, Day)];
+				}
+				Value = Sum / Tier.Period;
+			}
+
+			Tier.Values[GetValueIndex(ResourceIndex, Resolution, 0)] = Value;
+		}
+	}
+}
+
+float FFlarePriceHistory::GetValue(int32 ResourceIndex, int32 Age) const
+{
+	float OldestValue = 0;
+	Age = FMath::Max(Age, 0);
+
+	for (int32 Resolution = 0; Resolution < EFlarePriceResolution::Count; Resolution++)
+	{
+		const FPriceTier& Tier = Tiers[Resolution];
+		int32 Count = GetCount(Resolution);
+		if (Count == 0)
+		{
+			break;
+		}
+
+		// The newest value of a resolution ends a few days ago, finer resolutions always cover these days
+		int32 Offset = DayCount % Tier.Period;
+		int32 Index = FMath::Max(Age - Offset, 0) / Tier.Period;
+
+		if (Index < Count)
+		{
+			return Tier.Values[GetValueIndex(ResourceIndex, Resolution, Index)];
+		}
+
+		OldestValue = Tier.Values[GetValueIndex(ResourceIndex, Resolution, Count - 1)];
+	}
+
+	return OldestValue;
+}
+
+float FFlarePriceHistory::GetMean(int32 ResourceIndex, int32 StartAge, int32 EndAge) const
+{
+	float Sum = 0;
+	int32 Count = 0;
+
+	for (int32 Age = StartAge; Age <= EndAge; Age++)
+	{
+		Sum += GetValue(ResourceIndex, Age);
+		Count++;
+	}
+
+	if (Count == 0)
+	{
+		return 0;
+	}
+
+	return Sum / Count;
+}
+
+
+/*----------------------------------------------------
+	Save
+----------------------------------------------------*/
+
+void FFlarePriceHistory::SetDayCount(int32 InDayCount)
+{
+	DayCount = FMath::Max(InDayCount, 0);
+}
+
+void FFlarePriceHistory::GetSeries(int32 ResourceIndex, EFlarePriceResolution::Type Resolution, TArray<float>& Result) const
+{
+	Result.Reset();
+
+	for (int32 Index = GetCount(Resolution) - 1; Index >= 0; Index--)
+	{
+		Result.Add(Tiers[Resolution].Values[GetValueIndex(ResourceIndex, Resolution, Index)]);
+	}
+}
+
+void FFlarePriceHistory::SetSeries(int32 ResourceIndex, EFlarePriceResolution::Type Resolution, const TArray<float>& Values, float DefaultValue)
+{
+	for (int32 Index = 0; Index < GetCount(Resolution); Index++)
+	{
+		int32 SeriesIndex = Values.Num() - 1 - Index;
+		float Value = DefaultValue;
+
+		if (SeriesIndex >= 0)
+		{
+			Value = Values[SeriesIndex];
+		}
+		else if (Values.Num() > 0)
+		{
+			Value = Values[0];
+		}
+
+		Tiers[Resolution].Values[GetValueIndex(ResourceIndex, Resolution, Index)] = Value;
+	}
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+int32 FFlarePriceHistory::GetCount(int32 Resolution) const
+{
+	return FMath::Min(DayCount / Tiers[Resolution].Period, Tiers[Resolution].Capacity);
+}
+
+int32 FFlarePriceHistory::GetValueIndex(int32 ResourceIndex, int32 Resolution, int32 Index) const
+{
+	const FPriceTier& Tier = Tiers[Resolution];
+
+	int32 Slot = (DayCount / Tier.Period - 1 - Index) % Tier.Capacity;
+	if (Slot < 0)
+	{
+		Slot += Tier.Capacity;
+	}
+
+	return ResourceIndex * Tier.Capacity + Slot;
+}
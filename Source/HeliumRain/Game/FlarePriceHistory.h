@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Engine.h"
+
+
+/** Price history resolutions, from the most recent and precise to the oldest */
+namespace EFlarePriceResolution
+{
+	enum Type
+	{
+		Daily,
+		Weekly,
+		Monthly,
+		Count
+	};
+}
+
+
+/** Daily resource prices of a sector, one column per resource, old days being averaged into weekly then monthly values */
+class HELIUMRAIN_API FFlarePriceHistory
+{
+public:
+
+	FFlarePriceHistory();
+
+	/*----------------------------------------------------
+		Public API
+	----------------------------------------------------*/
+
+	/** Forget everything and store prices for a number of resources */
+	void Init(int32 InResourceCount);
+
+	/** Add the prices of a new day, one per resource */
+	void Append(const TArray<float>& Prices);
+
+	/** Get the price of a resource some days ago at the best known resolution, or the oldest known price */
+	float GetValue(int32 ResourceIndex, int32 Age) const;
+
+	/** Get the mean price of a resource between two ages, both included */
+	float GetMean(int32 ResourceIndex, int32 StartAge, int32 EndAge) const;
+
+
+	/*----------------------------------------------------
+		Save
+	----------------------------------------------------*/
+
+	/** Set the number of days stored so far, before setting the series */
+	void SetDayCount(int32 InDayCount);
+
+	/** Get the values stored for a resource at a resolution, oldest first */
+	void GetSeries(int32 ResourceIndex, EFlarePriceResolution::Type Resolution, TArray<float>& Result) const;
+
+	/** Set the values stored for a resource at a resolution, oldest first, missing old values being copied from the oldest one */
+	void SetSeries(int32 ResourceIndex, EFlarePriceResolution::Type Resolution, const TArray<float>& Values, float DefaultValue);
+
+
+	/*----------------------------------------------------
+		Getters
+	----------------------------------------------------*/
+
+	inline int32 GetDayCount() const
+	{
+		return DayCount;
+	}
+
+	inline bool IsEmpty() const
+	{
+		return DayCount == 0;
+	}
+
+
+protected:
+
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Get the number of values stored at a resolution */
+	int32 GetCount(int32 Resolution) const;
+
+	/** Get the index of a value in the column of a resource, 0 being the newest */
+	int32 GetValueIndex(int32 ResourceIndex, int32 Resolution, int32 Index) const;
+
+
+	/*----------------------------------------------------
+		Data
+	----------------------------------------------------*/
+
+	/** Values of a resolution, stored as a ring buffer per resource column */
+	struct FPriceTier
+	{
+		int32                                       Period;
+		int32                                       Capacity;
+		TArray<float>                               Values;
+	};
+
+	FPriceTier                                      Tiers[EFlarePriceResolution::Count];
+
+	int32                                           ResourceCount;
+	int32                                           DayCount;
+
+};
@@ -3,10 +3,20 @@
 #include "FlareSimulatedSector.h"
 #include "FlareSector.h"
 #include "FlareCollider.h"
+#include "FlareDebrisField.h"
 #include "../Spacecrafts/FlareShell.h"
 #include "../Spacecrafts/FlareSpacecraft.h"
 #include "../Player/FlarePlayerController.h"
 
+DECLARE_CYCLE_STAT(TEXT("FlareSector UpdateActivation"), STAT_FlareSector_UpdateActivation, STATGROUP_Flare);
+
+
+// Objects closer than this to the player ship are spawned with the sector, in centimeters
+#define SECTOR_ACTIVATION_PRIORITY_DISTANCE 200000.f
+
+// Time spent spawning the rest of the sector each frame, in milliseconds
+#define SECTOR_ACTIVATION_BUDGET_MS 4.0
+
 
 /*----------------------------------------------------
 	Constructor
@@ -17,6 +27,9 @@ UFlareSector::UFlareSector(const FObjectInitializer& ObjectInitializer)
 {
 	SectorRepartitionCache = false;
 	IsDestroyingSector = false;
+	PilotScheduler = NULL;
+	ActivationIndex = 0;
+	ActivationSafeCount = 0;
 }
 
 /*----------------------------------------------------
@@ -29,39 +42,116 @@ void UFlareSector::Load(UFlareSimulatedSector* Parent)
 	ParentSector = Parent;
 	LocalTime = Parent->GetData()->LocalTime;
 
-	// Load asteroids
+	// Setup the pilot scheduler
+	if (!PilotScheduler)
+	{
+		PilotScheduler = NewObject<UFlarePilotScheduler>(this, UFlarePilotScheduler::StaticClass());
+	}
+	PilotScheduler->Load(this);
+
+	// The player ship, when already positioned, decides what to spawn first
+	UFlareSimulatedSpacecraft* PlayerShip = Parent->GetGame()->GetPC()->GetPlayerShip();
+	bool PlayerShipSafe = false;
+	FVector PlayerLocation = FVector::ZeroVector;
+	if (PlayerShip && PlayerShip->GetCurrentSector() == ParentSector && PlayerShip->GetData().SpawnMode == EFlareSpawnMode::Safe)
+	{
+		PlayerShipSafe = true;
+		PlayerLocation = PlayerShip->GetData().Location;
+	}
+
+	FFlareSectorActivationItem Item;
+	Item.Spacecraft = NULL;
+	Item.AsteroidIndex = INDEX_NONE;
+	Item.BombIndex = INDEX_NONE;
+	Item.Distance = 0;
+
+	// Queue asteroids and safe location spacecrafts, nearest first
 	for (int i = 0 ; i < ParentSector->GetData()->AsteroidData.Num(); i++)
 	{
-		LoadAsteroid(ParentSector->GetData()->AsteroidData[i]);
+		FFlareSectorActivationItem AsteroidItem = Item;
+		AsteroidItem.AsteroidIndex = PendingAsteroids.Add(ParentSector->GetData()->AsteroidData[i]);
+		AsteroidItem.Distance = (ParentSector->GetData()->AsteroidData[i].Location - PlayerLocation).Size();
+		ActivationQueue.Add(AsteroidItem);
 	}
 
-	// Load safe location spacecrafts
 	for (int i = 0 ; i < ParentSector->GetSectorSpacecrafts().Num(); i++)
 	{
 		UFlareSimulatedSpacecraft* Spacecraft = ParentSector->GetSectorSpacecrafts()[i];
-		if (Spacecraft->GetData().SpawnMode == EFlareSpawnMode::Safe && (!Spacecraft->IsReserve() ||  Parent->GetGame()->GetPC()->GetPlayerShip() == Spacecraft))
+		if (Spacecraft->GetData().SpawnMode == EFlareSpawnMode::Safe && (!Spacecraft->IsReserve() || PlayerShip == Spacecraft))
 		{
-			LoadSpacecraft(Spacecraft);
+			FFlareSectorActivationItem SpacecraftItem = Item;
+			SpacecraftItem.Spacecraft = Spacecraft;
+			SpacecraftItem.Distance = (PlayerShip == Spacecraft ? -1 : (Spacecraft->GetData().Location - PlayerLocation).Size());
+			ActivationQueue.Add(SpacecraftItem);
 		}
 	}
 
-	SectorRepartitionCache = false;
+	ActivationQueue.Sort([](const FFlareSectorActivationItem& A, const FFlareSectorActivationItem& B)
+	{
+		return A.Distance < B.Distance;
+	});
+	ActivationSafeCount = ActivationQueue.Num();
 
-	// Load unsafe location spacecrafts
+	// Queue unsafe location spacecrafts, which are placed relative to the others : the player ship goes first
 	for (int i = 0; i < ParentSector->GetSectorSpacecrafts().Num(); i++)
 	{
 		UFlareSimulatedSpacecraft* Spacecraft = ParentSector->GetSectorSpacecrafts()[i];
-		if (Spacecraft->GetData().SpawnMode != EFlareSpawnMode::Safe && (!Spacecraft->IsReserve() ||  Parent->GetGame()->GetPC()->GetPlayerShip() == Spacecraft))
+		if (Spacecraft->GetData().SpawnMode != EFlareSpawnMode::Safe && (!Spacecraft->IsReserve() || PlayerShip == Spacecraft))
 		{
-			LoadSpacecraft(Spacecraft);
+			FFlareSectorActivationItem SpacecraftItem = Item;
+			SpacecraftItem.Spacecraft = Spacecraft;
+
+			if (Spacecraft == PlayerShip)
+			{
+				ActivationQueue.Insert(SpacecraftItem, ActivationSafeCount);
+			}
+			else
+			{
+				ActivationQueue.Add(SpacecraftItem);
+			}
 		}
 	}
 
-	// Load bombs
+	// Queue bombs
 	for (int i = 0; i < ParentSector->GetData()->BombData.Num(); i++)
 	{
-		LoadBomb(ParentSector->GetData()->BombData[i]);
+		FFlareSectorActivationItem BombItem = Item;
+		BombItem.BombIndex = PendingBombs.Add(ParentSector->GetData()->BombData[i]);
+		ActivationQueue.Add(BombItem);
 	}
+
+	// Spawn the player's surroundings now, or everything the player ship needs to be placed
+	int32 ImmediateCount = ActivationSafeCount;
+	if (PlayerShipSafe)
+	{
+		ImmediateCount = 0;
+		while (ImmediateCount < ActivationSafeCount && ActivationQueue[ImmediateCount].Distance < SECTOR_ACTIVATION_PRIORITY_DISTANCE)
+		{
+			ImmediateCount++;
+		}
+	}
+	else if (PlayerShip && PlayerShip->GetCurrentSector() == ParentSector)
+	{
+		ImmediateCount = ActivationSafeCount + 1;
+	}
+
+	if (ActivationSafeCount == 0)
+	{
+		OnSafeActivationDone();
+	}
+
+	while (ActivationIndex < ImmediateCount)
+	{
+		ProcessActivationItem(ActivationQueue[ActivationIndex]);
+		ActivationIndex++;
+
+		if (ActivationIndex == ActivationSafeCount)
+		{
+			OnSafeActivationDone();
+		}
+	}
+
+	FLOGV("UFlareSector::Load : spawned %d objects, %d left", ActivationIndex, ActivationQueue.Num() - ActivationIndex);
 }
 
 void UFlareSector::Save()
@@ -82,6 +172,19 @@ void UFlareSector::Save()
 		SectorData->AsteroidData.Add(*SectorAsteroids[i]->Save());
 	}
 
+	// Objects that were not spawned yet
+	for (int i = ActivationIndex; i < ActivationQueue.Num(); i++)
+	{
+		if (ActivationQueue[i].AsteroidIndex != INDEX_NONE)
+		{
+			SectorData->AsteroidData.Add(PendingAsteroids[ActivationQueue[i].AsteroidIndex]);
+		}
+		else if (ActivationQueue[i].BombIndex != INDEX_NONE)
+		{
+			SectorData->BombData.Add(PendingBombs[ActivationQueue[i].BombIndex]);
+		}
+	}
+
 	SectorData->LocalTime = LocalTime + GetGame()->GetPlanetarium()->GetSmoothTime();
 }
 
@@ -118,6 +221,14 @@ void UFlareSector::DestroySector()
 	SectorBombs.Empty();
 	SectorAsteroids.Empty();
 	SectorShells.Empty();
+	ActivationQueue.Empty();
+	PendingAsteroids.Empty();
+	PendingBombs.Empty();
+	ActivationIndex = 0;
+	ActivationSafeCount = 0;
+	CombatSnapshot.Clear();
+	CollisionBroadphase.Clear();
+	ShellBroadphase.Clear();
 
 	IsDestroyingSector = false;
 }
@@ -138,6 +249,8 @@ AFlareAsteroid* UFlareSector::LoadAsteroid(const FFlareAsteroidSave& AsteroidDat
 
 	// TODO Check double add
 	SectorAsteroids.Add(Asteroid);
+	CollisionBroadphase.Clear();
+	ShellBroadphase.Clear();
     return Asteroid;
 }
 
@@ -178,6 +291,9 @@ AFlareSpacecraft* UFlareSector::LoadSpacecraft(UFlareSimulatedSpacecraft* Parent
 			SectorShips.Add(Spacecraft);
 		}
 		SectorSpacecrafts.Add(Spacecraft);
+		CombatSnapshot.Clear();
+		CollisionBroadphase.Clear();
+		ShellBroadphase.Clear();
 
 		switch (ParentSpacecraft->GetData().SpawnMode)
 		{
@@ -376,6 +492,7 @@ AFlareBomb* UFlareSector::LoadBomb(const FFlareBombSave& BombData)
                 RootComponent->SetPhysicsAngularVelocity(BombData.AngularVelocity, false);
 
 				SectorBombs.Add(Bomb);
+				ShellBroadphase.Clear();
             }
             else
             {
@@ -398,6 +515,7 @@ AFlareBomb* UFlareSector::LoadBomb(const FFlareBombSave& BombData)
 void UFlareSector::RegisterBomb(AFlareBomb* Bomb)
 {
 	SectorBombs.AddUnique(Bomb);
+	ShellBroadphase.Clear();
 }
 
 void UFlareSector::UnregisterBomb(AFlareBomb* Bomb)
@@ -586,10 +704,98 @@ AFlareSpacecraft* UFlareSector::FindSpacecraft(FName Immatriculation)
 			return SectorSpacecrafts[i];
 		}
 	}
+
+	// Spawn it now if it is still waiting for activation
+	for (int i = ActivationIndex; i < ActivationQueue.Num(); i++)
+	{
+		UFlareSimulatedSpacecraft* Spacecraft = ActivationQueue[i].Spacecraft;
+		if (Spacecraft && Spacecraft->GetImmatriculation() == Immatriculation)
+		{
+			ProcessActivationItem(ActivationQueue[i]);
+			return Spacecraft->GetActive();
+		}
+	}
+
 	return NULL;
 }
 
 
+/*----------------------------------------------------
+	Activation
+----------------------------------------------------*/
+
+void UFlareSector::UpdateActivation()
+{
+	if (!IsActivating())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_FlareSector_UpdateActivation);
+	double StartTime = FPlatformTime::Seconds();
+
+	// Spawn at least one object per frame
+	do
+	{
+		ProcessActivationItem(ActivationQueue[ActivationIndex]);
+		ActivationIndex++;
+
+		if (ActivationIndex == ActivationSafeCount)
+		{
+			OnSafeActivationDone();
+		}
+	}
+	while (IsActivating() && (FPlatformTime::Seconds() - StartTime) < SECTOR_ACTIVATION_BUDGET_MS / 1000.0);
+
+	if (!IsActivating())
+	{
+		FLOGV("UFlareSector::UpdateActivation : sector activated, %d spacecrafts", SectorSpacecrafts.Num());
+		ActivationQueue.Empty();
+		PendingAsteroids.Empty();
+		PendingBombs.Empty();
+		ActivationIndex = 0;
+		ActivationSafeCount = 0;
+	}
+}
+
+float UFlareSector::GetActivationProgress() const
+{
+	return (IsActivating() ? (float)ActivationIndex / (float)ActivationQueue.Num() : 1.f);
+}
+
+void UFlareSector::ProcessActivationItem(FFlareSectorActivationItem& Item)
+{
+	if (Item.Spacecraft)
+	{
+		// The spacecraft may have left or been spawned on demand since
+		if (Item.Spacecraft->GetCurrentSector() == ParentSector && !Item.Spacecraft->IsActive())
+		{
+			LoadSpacecraft(Item.Spacecraft);
+		}
+		Item.Spacecraft = NULL;
+	}
+	else if (Item.AsteroidIndex != INDEX_NONE)
+	{
+		LoadAsteroid(PendingAsteroids[Item.AsteroidIndex]);
+		Item.AsteroidIndex = INDEX_NONE;
+	}
+	else if (Item.BombIndex != INDEX_NONE)
+	{
+		LoadBomb(PendingBombs[Item.BombIndex]);
+		Item.BombIndex = INDEX_NONE;
+	}
+}
+
+void UFlareSector::OnSafeActivationDone()
+{
+	// Unsafe spacecrafts are placed relative to the stations
+	SectorRepartitionCache = false;
+
+	// Debris avoid the asteroids and stations, which are all spawned now
+	GetGame()->GetDebrisFieldSystem()->Setup(GetGame(), ParentSector);
+}
+
+
 void UFlareSector::GenerateSectorRepartitionCache()
 {
 	if (!SectorRepartitionCache)
@@ -635,3 +841,30 @@ float UFlareSector::GetSectorRadius()
 	GenerateSectorRepartitionCache();
 	return SectorRadius;
 }
+
+const FFlareCombatSnapshot& UFlareSector::GetCombatSnapshot()
+{
+	if (CombatSnapshot.GetFrame() != GFrameCounter)
+	{
+		CombatSnapshot.Update(this);
+	}
+	return CombatSnapshot;
+}
+
+const FFlareCollisionBroadphase& UFlareSector::GetCollisionBroadphase()
+{
+	if (CollisionBroadphase.GetFrame() != GFrameCounter)
+	{
+		CollisionBroadphase.Update(this);
+	}
+	return CollisionBroadphase;
+}
+
+const FFlareShellBroadphase& UFlareSector::GetShellBroadphase()
+{
+	if (ShellBroadphase.GetFrame() != GFrameCounter)
+	{
+		ShellBroadphase.Update(this);
+	}
+	return ShellBroadphase;
+}
@@ -5,12 +5,31 @@
 #include "../Spacecrafts/FlareBomb.h"
 #include "FlareAsteroid.h"
 #include "FlareSimulatedSector.h"
+#include "../Spacecrafts/FlarePilotScheduler.h"
+#include "../Spacecrafts/FlareCombatSnapshot.h"
+#include "FlareCollisionBroadphase.h"
+#include "FlareShellBroadphase.h"
 #include "FlareSector.generated.h"
 
 class UFlareSimulatedSector;
 class AFlareGame;
 class AFlareAsteroid;
 
+
+/** An object waiting to be spawned while the sector activates */
+struct FFlareSectorActivationItem
+{
+	/** Spacecraft to spawn, or NULL */
+	UFlareSimulatedSpacecraft*     Spacecraft;
+
+	/** Index in the pending asteroid or bomb list, or INDEX_NONE */
+	int32                          AsteroidIndex;
+	int32                          BombIndex;
+
+	/** Distance to the player ship, used to spawn the surroundings first */
+	float                          Distance;
+};
+
 UCLASS()
 class HELIUMRAIN_API UFlareSector : public UObject
 {
@@ -56,8 +75,32 @@ public:
 
 	void PlaceSpacecraft(AFlareSpacecraft* Spacecraft, FVector Location);
 
+
+	/*----------------------------------------------------
+		Activation
+	----------------------------------------------------*/
+
+	/** Spawn the objects still waiting for activation, within the frame budget */
+	void UpdateActivation();
+
+	/** Check if some objects are still waiting to be spawned */
+	bool IsActivating() const
+	{
+		return ActivationIndex < ActivationQueue.Num();
+	}
+
+	/** Get the ratio of spawned objects */
+	float GetActivationProgress() const;
+
 protected:
 
+	/** Spawn an object from the activation queue */
+	void ProcessActivationItem(FFlareSectorActivationItem& Item);
+
+	/** Called when all safe objects are spawned */
+	void OnSafeActivationDone();
+
+
 	/*----------------------------------------------------
 		Protected data
 	----------------------------------------------------*/
@@ -80,6 +123,20 @@ protected:
 	UPROPERTY()
 	TArray<AFlareShell*>           SectorShells;
 
+	UPROPERTY()
+	UFlarePilotScheduler*          PilotScheduler;
+
+	FFlareCombatSnapshot           CombatSnapshot;
+	FFlareCollisionBroadphase      CollisionBroadphase;
+	FFlareShellBroadphase          ShellBroadphase;
+
+	// Activation queue
+	TArray<FFlareSectorActivationItem>   ActivationQueue;
+	TArray<FFlareAsteroidSave>           PendingAsteroids;
+	TArray<FFlareBombSave>               PendingBombs;
+	int32                                ActivationIndex;
+	int32                                ActivationSafeCount;
+
 	int64						   LocalTime;
 	bool						   SectorRepartitionCache;
 	bool                           IsDestroyingSector;
@@ -149,6 +206,20 @@ public:
 		return SectorBombs;
 	}
 
+	inline UFlarePilotScheduler* GetPilotScheduler()
+	{
+		return PilotScheduler;
+	}
+
+	/** Get the state of the sector's spacecrafts for this frame */
+	const FFlareCombatSnapshot& GetCombatSnapshot();
+
+	/** Get the predicted trajectories of the sector's obstacles for this frame */
+	const FFlareCollisionBroadphase& GetCollisionBroadphase();
+
+	/** Get the bounds shells can hit for this frame */
+	const FFlareShellBroadphase& GetShellBroadphase();
+
 	inline int64 GetLocalTime()
 	{
 		return LocalTime;
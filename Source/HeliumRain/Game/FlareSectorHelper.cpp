@@ -17,7 +17,6 @@ UFlareSimulatedSpacecraft*  SectorHelper::FindTradeStation(FlareTradeRequest Req
 	}
 
 	UFlareSimulatedSector* Sector = Request.Client->GetCurrentSector();
-	TArray<UFlareSimulatedSpacecraft*>& SectorStations = Sector->GetSectorStations();
 
 	float UnloadQuantityScoreMultiplier = 0;
 	float LoadQuantityScoreMultiplier = 0;
@@ -69,29 +68,20 @@ UFlareSimulatedSpacecraft*  SectorHelper::FindTradeStation(FlareTradeRequest Req
 	uint32 AvailableQuantity = Request.Client->GetCargoBay()->GetResourceQuantity(Request.Resource, Request.Client->GetCompany());
 	uint32 FreeSpace = Request.Client->GetCargoBay()->GetFreeSpaceForResource(Request.Resource, Request.Client->GetCompany());
 
-	for (int32 StationIndex = 0; StationIndex < SectorStations.Num(); StationIndex++)
+	// Only consider stations on the right side of the market
+	const FFlareResourceMarket& Market = Sector->GetResourceMarket(Request.Resource);
+	const TArray<FFlareMarketStation>& Candidates = (NeedOutput ? Market.SellingStations : Market.BuyingStations);
+
+	for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num(); CandidateIndex++)
 	{
-		UFlareSimulatedSpacecraft* Station = SectorStations[StationIndex];
+		UFlareSimulatedSpacecraft* Station = Candidates[CandidateIndex].Station;
+		EFlareResourcePriceContext::Type StationResourceUsage = Candidates[CandidateIndex].PriceContext;
 
 		FText Unused;
 		if(!Request.Client->CanTradeWith(Station, Unused))
 		{
 			continue;
 		}
-		EFlareResourcePriceContext::Type StationResourceUsage = Station->GetResourceUseType(Request.Resource);
-
-		if(NeedOutput && (StationResourceUsage != EFlareResourcePriceContext::FactoryOutput &&
-						  StationResourceUsage != EFlareResourcePriceContext::MaintenanceConsumption))
-		{
-			continue;
-		}
-
-		if(NeedInput && (StationResourceUsage != EFlareResourcePriceContext::FactoryInput &&
-						 StationResourceUsage != EFlareResourcePriceContext::ConsumerConsumption &&
-						 StationResourceUsage != EFlareResourcePriceContext::MaintenanceConsumption))
-		{
-			continue;
-		}
 
 		uint32 StationFreeSpace = Station->GetCargoBay()->GetFreeSpaceForResource(Request.Resource, Request.Client->GetCompany());
 		uint32 StationResourceQuantity = Station->GetCargoBay()->GetResourceQuantity(Request.Resource, Request.Client->GetCompany());
@@ -141,12 +131,12 @@ UFlareSimulatedSpacecraft*  SectorHelper::FindTradeStation(FlareTradeRequest Req
 		}
 		else
 		{
-			EFlareResourcePriceContext::Type ResourceUsage = Station->GetResourceUseType(Request.Resource);
+			int64 ResourcePrice = Sector->GetResourcePrice(Request.Resource, StationResourceUsage);
 
-			uint32 MaxBuyableQuantity = Request.Client->GetCompany()->GetMoney() / Sector->GetResourcePrice(Request.Resource, ResourceUsage);
+			uint32 MaxBuyableQuantity = Request.Client->GetCompany()->GetMoney() / ResourcePrice;
 			LoadMaxQuantity = FMath::Min(LoadMaxQuantity , MaxBuyableQuantity);
 
-			uint32 MaxSellableQuantity = Station->GetCompany()->GetMoney() / Sector->GetResourcePrice(Request.Resource, ResourceUsage);
+			uint32 MaxSellableQuantity = Station->GetCompany()->GetMoney() / ResourcePrice;
 			UnloadMaxQuantity = FMath::Min(UnloadMaxQuantity , MaxSellableQuantity);
 
 			Score += UnloadMaxQuantity * SellQuantityScoreMultiplier;
@@ -722,10 +712,10 @@ TMap<FFlareResourceDescription*, WorldHelper::FlareResourceStats> SectorHelper::
 		UFlareSimulatedSpacecraft* Spacecraft = Sector->GetSectorSpacecrafts()[SpacecraftIndex];
 
 		// Stock
-		TArray<FFlareCargo>& CargoBaySlots = Spacecraft->GetCargoBay()->GetSlots();
+		const TArray<FFlareCargo>& CargoBaySlots = Spacecraft->GetCargoBay()->GetSlots();
 		for (int CargoIndex = 0; CargoIndex < CargoBaySlots.Num(); CargoIndex++)
 		{
-			FFlareCargo& Cargo = CargoBaySlots[CargoIndex];
+			const FFlareCargo& Cargo = CargoBaySlots[CargoIndex];
 
 			if (!Cargo.Resource)
 			{
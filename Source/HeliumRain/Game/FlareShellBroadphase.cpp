@@ -0,0 +1,218 @@
+
+#include "../Flare.h"
+#include "FlareShellBroadphase.h"
+#include "FlareGame.h"
+#include "FlareSector.h"
+#include "FlareCollider.h"
+#include "FlareAsteroid.h"
+#include "FlareDebrisField.h"
+#include "../Spacecrafts/FlareSpacecraft.h"
+#include "../Spacecrafts/FlareBomb.h"
+
+DECLARE_CYCLE_STAT(TEXT("FlareShellBroadphase Update"), STAT_FlareShellBroadphase_Update, STATGROUP_Flare);
+
+
+// Margin added to every bounding sphere, in centimeters
+#define SHELL_BROADPHASE_MARGIN 100.f
+
+
+/*----------------------------------------------------
+	Public API
+----------------------------------------------------*/
+
+FFlareShellBroadphase::FFlareShellBroadphase()
+	: MaxRadius(0)
+	, Frame(0)
+{
+}
+
+void FFlareShellBroadphase::Update(UFlareSector* Sector)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlareShellBroadphase_Update);
+
+	Frame = GFrameCounter;
+	PendingBodies.Reset();
+	MaxRadius = 0;
+
+	// Bodies may move a little before the shells tick
+	float DeltaSeconds = Sector->GetGame()->GetWorld()->GetDeltaSeconds();
+
+	// Spacecrafts
+	for (AFlareSpacecraft* Spacecraft : Sector->GetSpacecrafts())
+	{
+		AddActor(Spacecraft, Spacecraft, DeltaSeconds);
+	}
+
+	// Asteroids
+	for (AFlareAsteroid* Asteroid : Sector->GetAsteroids())
+	{
+		AddActor(Asteroid, NULL, DeltaSeconds);
+	}
+
+	// Bombs
+	for (AFlareBomb* Bomb : Sector->GetBombs())
+	{
+		AddActor(Bomb, NULL, DeltaSeconds);
+	}
+
+	// Colliders
+	ColliderActors.Reset();
+	UGameplayStatics::GetAllActorsOfClass(Sector->GetGame()->GetWorld(), AFlareCollider::StaticClass(), ColliderActors);
+	for (AActor* Collider : ColliderActors)
+	{
+		AddActor(Collider, NULL, DeltaSeconds);
+	}
+
+	// Debris, either instanced or promoted to actors
+	DebrisBounds.Reset();
+	Sector->GetGame()->GetDebrisFieldSystem()->GetDebrisBounds(DebrisBounds);
+	for (const FSphere& Bounds : DebrisBounds)
+	{
+		AddSphere(NULL, NULL, Bounds.Center, Bounds.W + SHELL_BROADPHASE_MARGIN);
+	}
+
+	// Sort along X
+	PendingBodies.Sort([](const FSphereBody& A, const FSphereBody& B)
+	{
+		return A.Center.X < B.Center.X;
+	});
+
+	int32 BodyCount = PendingBodies.Num();
+	CentersX.SetNumUninitialized(BodyCount);
+	CentersY.SetNumUninitialized(BodyCount);
+	CentersZ.SetNumUninitialized(BodyCount);
+	Radii.SetNumUninitialized(BodyCount);
+	Actors.SetNumUninitialized(BodyCount);
+	Spacecrafts.SetNumUninitialized(BodyCount);
+
+	for (int32 BodyIndex = 0; BodyIndex < BodyCount; BodyIndex++)
+	{
+		const FSphereBody& Body = PendingBodies[BodyIndex];
+		CentersX[BodyIndex] = Body.Center.X;
+		CentersY[BodyIndex] = Body.Center.Y;
+		CentersZ[BodyIndex] = Body.Center.Z;
+		Radii[BodyIndex] = Body.Radius;
+		Actors[BodyIndex] = Body.Actor;
+		Spacecrafts[BodyIndex] = Body.Spacecraft;
+	}
+}
+
+void FFlareShellBroadphase::Clear()
+{
+	PendingBodies.Empty();
+	ColliderActors.Empty();
+	DebrisBounds.Empty();
+	CentersX.Empty();
+	CentersY.Empty();
+	CentersZ.Empty();
+	Radii.Empty();
+	Actors.Empty();
+	Spacecrafts.Empty();
+	MaxRadius = 0;
+	Frame = 0;
+}
+
+bool FFlareShellBroadphase::MayHit(const FVector& Start, const FVector& End, AActor* IgnoredActor) const
+{
+	FVector Direction = End - Start;
+	float LengthSquared = Direction.SizeSquared();
+	float InvLengthSquared = (LengthSquared > SMALL_NUMBER ? 1.f / LengthSquared : 0.f);
+	float MaxX = FMath::Max(Start.X, End.X) + MaxRadius;
+
+	for (int32 BodyIndex = FindFirstBody(Start, End, 0); BodyIndex < Radii.Num() && CentersX[BodyIndex] <= MaxX; BodyIndex++)
+	{
+		if (IgnoredActor && Actors[BodyIndex] == IgnoredActor)
+		{
+			continue;
+		}
+
+		if (IsNearSegment(BodyIndex, Start, Direction, InvLengthSquared, 0))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FFlareShellBroadphase::GetSpacecraftsNear(const FVector& Start, const FVector& End, float Distance, TArray<AFlareSpacecraft*>& Result) const
+{
+	FVector Direction = End - Start;
+	float LengthSquared = Direction.SizeSquared();
+	float InvLengthSquared = (LengthSquared > SMALL_NUMBER ? 1.f / LengthSquared : 0.f);
+	float MaxX = FMath::Max(Start.X, End.X) + MaxRadius + Distance;
+
+	Result.Reset();
+	for (int32 BodyIndex = FindFirstBody(Start, End, Distance); BodyIndex < Radii.Num() && CentersX[BodyIndex] <= MaxX; BodyIndex++)
+	{
+		if (Spacecrafts[BodyIndex] && IsNearSegment(BodyIndex, Start, Direction, InvLengthSquared, Distance))
+		{
+			Result.Add(Spacecrafts[BodyIndex]);
+		}
+	}
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+void FFlareShellBroadphase::AddActor(AActor* Actor, AFlareSpacecraft* Spacecraft, float DeltaSeconds)
+{
+	// Only colliding components can stop a shell
+	FBox Box = Actor->GetComponentsBoundingBox();
+	if (!Box.IsValid)
+	{
+		return;
+	}
+
+	// Also cover the actor location, which the proximity fuze measures from
+	FVector Center = Box.GetCenter();
+	float Radius = FMath::Max(Box.GetExtent().Size(), (Actor->GetActorLocation() - Center).Size());
+	Radius += Actor->GetVelocity().Size() * DeltaSeconds + SHELL_BROADPHASE_MARGIN;
+
+	AddSphere(Actor, Spacecraft, Center, Radius);
+}
+
+void FFlareShellBroadphase::AddSphere(AActor* Actor, AFlareSpacecraft* Spacecraft, FVector Center, float Radius)
+{
+	FSphereBody Body;
+	Body.Actor = Actor;
+	Body.Spacecraft = Spacecraft;
+	Body.Center = Center;
+	Body.Radius = Radius;
+
+	PendingBodies.Add(Body);
+	MaxRadius = FMath::Max(MaxRadius, Radius);
+}
+
+int32 FFlareShellBroadphase::FindFirstBody(const FVector& Start, const FVector& End, float Distance) const
+{
+	float MinX = FMath::Min(Start.X, End.X) - MaxRadius - Distance;
+
+	// Binary search on the sorted centers
+	int32 Low = 0;
+	int32 High = CentersX.Num();
+	while (Low < High)
+	{
+		int32 Middle = (Low + High) / 2;
+		if (CentersX[Middle] < MinX)
+		{
+			Low = Middle + 1;
+		}
+		else
+		{
+			High = Middle;
+		}
+	}
+
+	return Low;
+}
+
+bool FFlareShellBroadphase::IsNearSegment(int32 BodyIndex, const FVector& Start, const FVector& Direction, float InvLengthSquared, float Distance) const
+{
+	FVector Offset = FVector(CentersX[BodyIndex], CentersY[BodyIndex], CentersZ[BodyIndex]) - Start;
+	float Alpha = FMath::Clamp(FVector::DotProduct(Offset, Direction) * InvLengthSquared, 0.f, 1.f);
+
+	return (Offset - Direction * Alpha).SizeSquared() <= FMath::Square(Radii[BodyIndex] + Distance);
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Engine.h"
+
+
+class UFlareSector;
+class AFlareSpacecraft;
+
+
+/** Bounding spheres of everything a shell can hit in the active sector, built once per frame for all shells */
+class HELIUMRAIN_API FFlareShellBroadphase
+{
+public:
+
+	FFlareShellBroadphase();
+
+	/*----------------------------------------------------
+		Public API
+	----------------------------------------------------*/
+
+	/** Rebuild the bounding spheres from the sector */
+	void Update(UFlareSector* Sector);
+
+	/** Forget everything */
+	void Clear();
+
+	/** Check if a shell segment crosses the bounds of anything but the ignored actor */
+	bool MayHit(const FVector& Start, const FVector& End, AActor* IgnoredActor) const;
+
+	/** Get the spacecrafts whose bounds get within a distance of a shell segment */
+	void GetSpacecraftsNear(const FVector& Start, const FVector& End, float Distance, TArray<AFlareSpacecraft*>& Result) const;
+
+
+	/*----------------------------------------------------
+		Getters
+	----------------------------------------------------*/
+
+	inline int32 GetBodyCount() const
+	{
+		return Radii.Num();
+	}
+
+	inline uint64 GetFrame() const
+	{
+		return Frame;
+	}
+
+
+protected:
+
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Add the colliding bounds of an actor */
+	void AddActor(AActor* Actor, AFlareSpacecraft* Spacecraft, float DeltaSeconds);
+
+	/** Add a bounding sphere */
+	void AddSphere(AActor* Actor, AFlareSpacecraft* Spacecraft, FVector Center, float Radius);
+
+	/** Get the first body that may be within a distance of a segment, in X order */
+	int32 FindFirstBody(const FVector& Start, const FVector& End, float Distance) const;
+
+	/** Check if a body is within a distance of a segment */
+	bool IsNearSegment(int32 BodyIndex, const FVector& Start, const FVector& Direction, float InvLengthSquared, float Distance) const;
+
+
+	/*----------------------------------------------------
+		Data
+	----------------------------------------------------*/
+
+	/** A body waiting to be sorted */
+	struct FSphereBody
+	{
+		AActor*                                     Actor;
+		AFlareSpacecraft*                           Spacecraft;
+		FVector                                     Center;
+		float                                       Radius;
+	};
+
+	TArray<FSphereBody>                             PendingBodies;
+
+	/** Colliders and debris of the frame, kept to reuse their memory */
+	TArray<AActor*>                                 ColliderActors;
+	TArray<FSphere>                                 DebrisBounds;
+
+	/** Bodies sorted along X, one array per field so that the segment tests stream through memory */
+	TArray<float>                                   CentersX;
+	TArray<float>                                   CentersY;
+	TArray<float>                                   CentersZ;
+	TArray<float>                                   Radii;
+	TArray<AActor*>                                 Actors;
+	TArray<AFlareSpacecraft*>                       Spacecrafts;
+
+	float                                           MaxRadius;
+	uint64                                          Frame;
+
+};
@@ -12,6 +12,7 @@
 DECLARE_CYCLE_STAT(TEXT("FlareSector SimulatePriceVariation"), STAT_FlareSector_SimulatePriceVariation, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlareSector GetSectorFriendlyness"), STAT_FlareSector_GetSectorFriendlyness, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlareSector GetSectorBattleState"), STAT_FlareSector_GetSectorBattleState, STATGROUP_Flare);
+DECLARE_CYCLE_STAT(TEXT("FlareSector UpdateMarket"), STAT_FlareSector_UpdateMarket, STATGROUP_Flare);
 
 #define FLEET_SUPPLY_CONSUMPTION_STATS 50
 
@@ -27,6 +28,7 @@ UFlareSimulatedSector::UFlareSimulatedSector(const FObjectInitializer& ObjectIni
 	: Super(ObjectInitializer)
 {
 	PersistentStationIndex = 0;
+	MarketDirty = true;
 }
 
 void UFlareSimulatedSector::Load(const FFlareSectorDescription* Description, const FFlareSectorSave& Data, const FFlareSectorOrbitParameters& OrbitParameters)
@@ -49,6 +51,7 @@ void UFlareSimulatedSector::Load(const FFlareSectorDescription* Description, con
 	SectorStations.Empty();
 	SectorSpacecrafts.Empty();
 	SectorFleets.Empty();
+	InvalidateMarket();
 
 	FFlareCelestialBody* Body = Game->GetGameWorld()->GetPlanerarium()->FindCelestialBody(SectorOrbitParameters.CelestialBodyIdentifier);
 	if (Body)
@@ -365,6 +368,7 @@ UFlareSimulatedSpacecraft* UFlareSimulatedSector::CreateSpacecraft(FFlareSpacecr
 	if (Spacecraft->IsStation())
 	{
 		SectorStations.Add(Spacecraft);
+		InvalidateMarket();
 	}
 	else
 	{
@@ -460,15 +464,76 @@ void UFlareSimulatedSector::RetireFleet(UFlareFleet* Fleet)
 
 int UFlareSimulatedSector::RemoveSpacecraft(UFlareSimulatedSpacecraft* Spacecraft)
 {
-	SectorStations.Remove(Spacecraft);
+	if (SectorStations.Remove(Spacecraft) > 0)
+	{
+		InvalidateMarket();
+	}
 	SectorShips.Remove(Spacecraft);
 	return SectorSpacecrafts.Remove(Spacecraft);
 }
 
+void UFlareSimulatedSector::InvalidateMarket()
+{
+	MarketDirty = true;
+}
+
+void UFlareSimulatedSector::UpdateMarket()
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlareSector_UpdateMarket);
+
+	ResourceMarkets.Empty();
+
+	for (int32 ResourceIndex = 0; ResourceIndex < Game->GetResourceCatalog()->Resources.Num(); ResourceIndex++)
+	{
+		FFlareResourceDescription* Resource = &Game->GetResourceCatalog()->Resources[ResourceIndex]->Data;
+		FFlareResourceMarket& Market = ResourceMarkets.Add(Resource);
+
+		for (int32 StationIndex = 0; StationIndex < SectorStations.Num(); StationIndex++)
+		{
+			FFlareMarketStation Entry;
+			Entry.Station = SectorStations[StationIndex];
+			Entry.PriceContext = Entry.Station->GetResourceUseType(Resource);
+
+			if (Entry.PriceContext == EFlareResourcePriceContext::FactoryInput ||
+				Entry.PriceContext == EFlareResourcePriceContext::ConsumerConsumption ||
+				Entry.PriceContext == EFlareResourcePriceContext::MaintenanceConsumption)
+			{
+				Market.BuyingStations.Add(Entry);
+			}
+
+			if (Entry.PriceContext == EFlareResourcePriceContext::FactoryOutput ||
+				Entry.PriceContext == EFlareResourcePriceContext::MaintenanceConsumption)
+			{
+				Market.SellingStations.Add(Entry);
+			}
+		}
+	}
+
+	MarketDirty = false;
+}
+
+
 /*----------------------------------------------------
 	Getters
 ----------------------------------------------------*/
 
+const FFlareResourceMarket& UFlareSimulatedSector::GetResourceMarket(FFlareResourceDescription* Resource)
+{
+	if (MarketDirty)
+	{
+		UpdateMarket();
+	}
+
+	FFlareResourceMarket* Market = ResourceMarkets.Find(Resource);
+	if (!Market)
+	{
+		// Resource outside the catalog
+		return ResourceMarkets.Add(Resource);
+	}
+
+	return *Market;
+}
+
 
 FText UFlareSimulatedSector::GetSectorDescription() const
 {
@@ -962,23 +1027,77 @@ uint32 UFlareSimulatedSector::GetResourceCount(UFlareCompany* Company, FFlareRes
 
 void UFlareSimulatedSector::LoadResourcePrices()
 {
+	UFlareResourceCatalog* ResourceCatalog = Game->GetResourceCatalog();
+	TArray<FFlareFloatBuffer*> SavedPrices;
+	int32 SavedPriceDays = 0;
+
 	ResourcePrices.Empty();
-	LastResourcePrices.Empty();
+	PriceHistory.Init(ResourceCatalog->Resources.Num());
+	PriceHistory.SetDayCount(SectorData.PriceHistoryDays);
+	SavedPrices.SetNumZeroed(ResourceCatalog->Resources.Num());
+
 	for (int PriceIndex = 0; PriceIndex < SectorData.ResourcePrices.Num(); PriceIndex++)
 	{
 		FFFlareResourcePrice* ResourcePrice = &SectorData.ResourcePrices[PriceIndex];
-		FFlareResourceDescription* Resource = Game->GetResourceCatalog()->Get(ResourcePrice->ResourceIdentifier);
+		FFlareResourceDescription* Resource = ResourceCatalog->Get(ResourcePrice->ResourceIdentifier);
+		int32 ResourceIndex = ResourceCatalog->GetResourceIndex(Resource);
+		if (ResourceIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
 		float Price = ResourcePrice->Price;
 		ResourcePrices.Add(Resource, Price);
-		FFlareFloatBuffer* Prices = &ResourcePrice->Prices;
-		Prices->Resize(50);
-		LastResourcePrices.Add(Resource, *Prices);
+
+		PriceHistory.SetSeries(ResourceIndex, EFlarePriceResolution::Daily, ResourcePrice->DailyPrices, Price);
+		PriceHistory.SetSeries(ResourceIndex, EFlarePriceResolution::Weekly, ResourcePrice->WeeklyPrices, Price);
+		PriceHistory.SetSeries(ResourceIndex, EFlarePriceResolution::Monthly, ResourcePrice->MonthlyPrices, Price);
+
+		SavedPrices[ResourceIndex] = &ResourcePrice->Prices;
+		SavedPriceDays = FMath::Max(SavedPriceDays, ResourcePrice->Prices.Values.Num());
+	}
+
+	// Resources missing from the save keep their current price
+	for (int32 ResourceIndex = 0; ResourceIndex < SavedPrices.Num(); ResourceIndex++)
+	{
+		if (!SavedPrices[ResourceIndex])
+		{
+			float Price = GetPreciseResourcePrice(&ResourceCatalog->Resources[ResourceIndex]->Data);
+			PriceHistory.SetSeries(ResourceIndex, EFlarePriceResolution::Daily, TArray<float>(), Price);
+			PriceHistory.SetSeries(ResourceIndex, EFlarePriceResolution::Weekly, TArray<float>(), Price);
+			PriceHistory.SetSeries(ResourceIndex, EFlarePriceResolution::Monthly, TArray<float>(), Price);
+		}
+	}
+
+	// Old saves only have the last daily prices, replay them
+	if (PriceHistory.IsEmpty() && SavedPriceDays > 0)
+	{
+		TArray<float> Prices;
+		Prices.SetNumZeroed(ResourceCatalog->Resources.Num());
+
+		for (int32 Age = SavedPriceDays - 1; Age >= 0; Age--)
+		{
+			for (int32 ResourceIndex = 0; ResourceIndex < Prices.Num(); ResourceIndex++)
+			{
+				if (SavedPrices[ResourceIndex] && SavedPrices[ResourceIndex]->Values.Num() > 0)
+				{
+					Prices[ResourceIndex] = SavedPrices[ResourceIndex]->GetValue(Age);
+				}
+				else
+				{
+					Prices[ResourceIndex] = GetPreciseResourcePrice(&ResourceCatalog->Resources[ResourceIndex]->Data);
+				}
+			}
+
+			PriceHistory.Append(Prices);
+		}
 	}
 }
 
 void UFlareSimulatedSector::SaveResourcePrices()
 {
 	SectorData.ResourcePrices.Empty();
+	SectorData.PriceHistoryDays = PriceHistory.GetDayCount();
 
 	for(int32 ResourceIndex = 0; ResourceIndex < Game->GetResourceCatalog()->Resources.Num(); ResourceIndex++)
 	{
@@ -988,11 +1107,10 @@ void UFlareSimulatedSector::SaveResourcePrices()
 			FFFlareResourcePrice Price;
 			Price.ResourceIdentifier = Resource->Identifier;
 			Price.Price = ResourcePrices[Resource];
-			if (LastResourcePrices.Contains(Resource))
-			{
-				Price.Prices = LastResourcePrices[Resource];
-				SectorData.ResourcePrices.Add(Price);
-			}
+			PriceHistory.GetSeries(ResourceIndex, EFlarePriceResolution::Daily, Price.DailyPrices);
+			PriceHistory.GetSeries(ResourceIndex, EFlarePriceResolution::Weekly, Price.WeeklyPrices);
+			PriceHistory.GetSeries(ResourceIndex, EFlarePriceResolution::Monthly, Price.MonthlyPrices);
+			SectorData.ResourcePrices.Add(Price);
 		}
 	}
 }
@@ -1317,39 +1435,50 @@ float UFlareSimulatedSector::GetPreciseResourcePrice(FFlareResourceDescription*
 	}
 	else
 	{
-		if (!LastResourcePrices.Contains(Resource))
+		int32 ResourceIndex = Game->GetResourceCatalog()->GetResourceIndex(Resource);
+		if (PriceHistory.IsEmpty() || ResourceIndex == INDEX_NONE)
 		{
-			FFlareFloatBuffer Prices;
-			Prices.Init(50);
-			Prices.Append(GetPreciseResourcePrice(Resource, 0));
-			LastResourcePrices.Add(Resource, Prices);
+			return GetPreciseResourcePrice(Resource, 0);
 		}
 
-		return LastResourcePrices[Resource].GetValue(Age);
+		return PriceHistory.GetValue(ResourceIndex, Age);
+	}
+
+}
+
+float UFlareSimulatedSector::GetPreciseResourcePriceMean(FFlareResourceDescription* Resource, int32 StartAge, int32 EndAge)
+{
+	int32 ResourceIndex = Game->GetResourceCatalog()->GetResourceIndex(Resource);
+	if (PriceHistory.IsEmpty() || ResourceIndex == INDEX_NONE)
+	{
+		return GetPreciseResourcePrice(Resource, 0);
 	}
 
+	return PriceHistory.GetMean(ResourceIndex, StartAge, EndAge);
 }
 
 void UFlareSimulatedSector::SwapPrices()
 {
+	TArray<float> Prices;
+
 	for(int32 ResourceIndex = 0; ResourceIndex < Game->GetResourceCatalog()->Resources.Num(); ResourceIndex++)
 	{
 		FFlareResourceDescription* Resource = &Game->GetResourceCatalog()->Resources[ResourceIndex]->Data;
-
-		if (!LastResourcePrices.Contains(Resource))
-		{
-			FFlareFloatBuffer Prices;
-			Prices.Init(50);
-			LastResourcePrices.Add(Resource, Prices);
-		}
-
-		LastResourcePrices[Resource].Append(GetPreciseResourcePrice(Resource, 0));
+		Prices.Add(GetPreciseResourcePrice(Resource, 0));
 	}
+
+	PriceHistory.Append(Prices);
 }
 
 void UFlareSimulatedSector::SetPreciseResourcePrice(FFlareResourceDescription* Resource, float NewPrice)
 {
 	ResourcePrices[Resource] = FMath::Clamp(NewPrice, (float) Resource->MinPrice, (float) Resource->MaxPrice);
+
+	// Stock and spacecrafts are valued at local prices
+	for (UFlareCompany* Company : Game->GetGameWorld()->GetCompanies())
+	{
+		Company->InvalidateCompanyValue();
+	}
 }
 
 
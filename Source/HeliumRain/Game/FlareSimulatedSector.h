@@ -3,6 +3,7 @@
 
 #include "Object.h"
 #include "FlareAsteroid.h"
+#include "FlarePriceHistory.h"
 #include "../Data/FlareAsteroidCatalog.h"
 #include "../Spacecrafts/FlareBomb.h"
 #include "../Economy/FlarePeople.h"
@@ -251,8 +252,21 @@ struct FFFlareResourcePrice
 	UPROPERTY(EditAnywhere, Category = Save)
 	float Price;
 
+	/** Last daily prices, from old saves only */
 	UPROPERTY(EditAnywhere, Category = Save)
 	FFlareFloatBuffer Prices;
+
+	/** Daily prices, oldest first */
+	UPROPERTY(EditAnywhere, Category = Save)
+	TArray<float> DailyPrices;
+
+	/** Weekly mean prices, oldest first */
+	UPROPERTY(EditAnywhere, Category = Save)
+	TArray<float> WeeklyPrices;
+
+	/** Monthly mean prices, oldest first */
+	UPROPERTY(EditAnywhere, Category = Save)
+	TArray<float> MonthlyPrices;
 };
 
 /** Sector save data */
@@ -292,6 +306,10 @@ struct FFlareSectorSave
 	UPROPERTY(VisibleAnywhere, Category = Save)
 	TArray<FFFlareResourcePrice> ResourcePrices;
 
+	/** Number of days in the price history */
+	UPROPERTY(VisibleAnywhere, Category = Save)
+	int32 PriceHistoryDays;
+
 	UPROPERTY(VisibleAnywhere, Category = Save)
 	bool IsTravelSector;
 
@@ -303,6 +321,25 @@ struct FFlareSectorSave
 };
 
 
+/** Station trading a resource, with the price context it trades at */
+struct FFlareMarketStation
+{
+	UFlareSimulatedSpacecraft* Station;
+
+	EFlareResourcePriceContext::Type PriceContext;
+};
+
+/** Stations buying and selling a resource in a sector */
+struct FFlareResourceMarket
+{
+	/** Stations using the resource as input or consumption */
+	TArray<FFlareMarketStation> BuyingStations;
+
+	/** Stations producing the resource, or selling it for maintenance */
+	TArray<FFlareMarketStation> SellingStations;
+};
+
+
 /** Spawn settings for a station */
 USTRUCT()
 struct FFlareStationSpawnParameters
@@ -407,6 +444,9 @@ public:
 	/** Get the balance of forces as a text */
 	FText GetSectorBalanceText(bool ActiveOnly);
 
+	/** Mark the market index as outdated after a station or factory change */
+	void InvalidateMarket();
+
 
 protected:
 
@@ -434,7 +474,16 @@ protected:
 	FFlareSectorOrbitParameters             SectorOrbitParameters;
 	const FFlareSectorDescription*          SectorDescription;
 	TMap<FFlareResourceDescription*, float> ResourcePrices;
-	TMap<FFlareResourceDescription*, FFlareFloatBuffer> LastResourcePrices;
+
+	// Price history, one column per resource in catalog order
+	FFlarePriceHistory                      PriceHistory;
+
+	// Market index, rebuilt on demand
+	TMap<FFlareResourceDescription*, FFlareResourceMarket> ResourceMarkets;
+	bool                                    MarketDirty;
+
+	/** Rebuild the market index from the sector stations */
+	void UpdateMarket();
 
 public:
 
@@ -519,6 +568,9 @@ public:
 
 	float GetPreciseResourcePrice(FFlareResourceDescription* Resource, int32 Age = 0);
 
+	/** Get the mean price of a resource between two ages in days, both included */
+	float GetPreciseResourcePriceMean(FFlareResourceDescription* Resource, int32 StartAge, int32 EndAge);
+
 	void SwapPrices();
 
 	void SetPreciseResourcePrice(FFlareResourceDescription* Resource, float NewPrice);
@@ -559,4 +611,7 @@ public:
 	bool IsPlayerBattleInProgress();
 
 	int32 GetCompanyCapturePoints(UFlareCompany* Company) const;
+
+	/** Get the stations trading a resource in this sector */
+	const FFlareResourceMarket& GetResourceMarket(FFlareResourceDescription* Resource);
 };
@@ -340,6 +340,12 @@ void UFlareTradeRoute::SetTargetSector(UFlareSimulatedSector* Sector)
 }
 
 
+void UFlareTradeRoute::SetTradeRouteName(FText NewName)
+{
+	TradeRouteData.Name = NewName;
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Fleets);
+}
+
 void UFlareTradeRoute::AssignFleet(UFlareFleet* Fleet)
 {
 	UFlareTradeRoute* OldTradeRoute = Fleet->GetCurrentTradeRoute();
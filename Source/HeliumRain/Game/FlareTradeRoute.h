@@ -174,10 +174,7 @@ public:
 
 	void SkipCurrentOperation();
 
-    virtual void SetTradeRouteName(FText NewName)
-    {
-        TradeRouteData.Name = NewName;
-    }
+	virtual void SetTradeRouteName(FText NewName);
 
 	void SetPaused(bool Paused)
 	{
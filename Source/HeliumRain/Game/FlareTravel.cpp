@@ -384,6 +384,7 @@ void UFlareTravel::InitTravelSector(FFlareSectorSave& NewSectorData)
 	NewSectorData.Identifier = TEXT("Travel");
 	NewSectorData.LocalTime = 0;
 	NewSectorData.IsTravelSector = true;
+	NewSectorData.PriceHistoryDays = 0;
 
 	// Init population
 	NewSectorData.PeopleData.Population = 0;
@@ -10,6 +10,7 @@
 
 #include "../Data/FlareSectorCatalogEntry.h"
 #include "../Player/FlarePlayerController.h"
+#include "../Player/FlareMenuManager.h"
 
 #define LOCTEXT_NAMESPACE "FlareWorld"
 
@@ -64,6 +65,7 @@ void UFlareWorld::Load(const FFlareWorldSave& Data)
 			NewSectorData.Identifier = SectorDescription->Identifier;
 			NewSectorData.LocalTime = 0;
 			NewSectorData.IsTravelSector = false;
+			NewSectorData.PriceHistoryDays = 0;
 
 			// Init population
 			NewSectorData.PeopleData.Population = 0;
@@ -407,6 +409,10 @@ void UFlareWorld::Simulate()
 	UFlareCompany* PlayerCompany = Game->GetPC()->GetCompany();
 	Game->GetPC()->MarkAsBusy();
 
+	// Notifications of the day are merged and shown at the end
+	AFlareMenuManager* MenuManager = Game->GetPC()->GetMenuManager();
+	MenuManager->BeginNotificationBatch();
+
 	/**
 	 *  End previous day
 	 */
@@ -602,6 +608,9 @@ void UFlareWorld::Simulate()
 	FLOGV("** Simulate day %d done in %.6fs", WorldData.Date-1, EndTs- StartTs);
 
 	Game->GetQuestManager()->OnNextDay();
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Day);
+
+	MenuManager->EndNotificationBatch();
 
 	GameLog::DaySimulated(WorldData.Date);
 }
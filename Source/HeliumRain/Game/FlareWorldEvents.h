@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Engine.h"
+
+
+/** Parts of the world shown by menus, as flags */
+namespace EFlareWorldEvent
+{
+	enum Type
+	{
+		None =        0,
+		Money =       1 << 0,
+		Cargo =       1 << 1,
+		Fleets =      1 << 2,
+		Sectors =     1 << 3,
+		Day =         1 << 4,
+		Spacecrafts = 1 << 5,
+		Companies =   1 << 6,
+		All =         Money | Cargo | Fleets | Sectors | Day | Spacecrafts | Companies
+	};
+}
+
+/** Sent with the EFlareWorldEvent flags of everything that changed since the last frame */
+DECLARE_MULTICAST_DELEGATE_OneParam(FFlareWorldChangedEvent, int32);
+
+
+/** Collect world changes as they happen, so that menus handle them once per frame */
+class HELIUMRAIN_API FFlareWorldEvents
+{
+public:
+
+	FFlareWorldEvents()
+		: PendingEvents(EFlareWorldEvent::None)
+		, Revision(0)
+	{
+	}
+
+	/** Record a change */
+	inline void Notify(EFlareWorldEvent::Type Event)
+	{
+		PendingEvents |= Event;
+		Revision++;
+	}
+
+	/** Get a counter that changes with every recorded change */
+	inline uint32 GetRevision() const
+	{
+		return Revision;
+	}
+
+	/** Get the changes recorded since the last call, and forget them */
+	inline int32 Consume()
+	{
+		int32 Events = PendingEvents;
+		PendingEvents = EFlareWorldEvent::None;
+		return Events;
+	}
+
+
+protected:
+
+	int32                                           PendingEvents;
+	uint32                                          Revision;
+
+};
+
+
+/** Text built from world data, only built again when the world changed or when asked for another object */
+class HELIUMRAIN_API FFlareCachedText
+{
+public:
+
+	FFlareCachedText()
+		: Object(NULL)
+		, Revision(0)
+		, IsValid(false)
+	{
+	}
+
+	/** Get the text for an object, calling Generator if it is out of date */
+	template<typename GeneratorType>
+	const FText& Get(const FFlareWorldEvents& Events, const void* InObject, GeneratorType Generator)
+	{
+		if (!IsValid || Object != InObject || Revision != Events.GetRevision())
+		{
+			Text = Generator();
+			Object = InObject;
+			Revision = Events.GetRevision();
+			IsValid = true;
+		}
+
+		return Text;
+	}
+
+	/** Build the text again on the next call, for changes that aren't world events */
+	inline void Invalidate()
+	{
+		IsValid = false;
+	}
+
+
+protected:
+
+	const void*                                     Object;
+	uint32                                          Revision;
+	bool                                            IsValid;
+	FText                                           Text;
+
+};
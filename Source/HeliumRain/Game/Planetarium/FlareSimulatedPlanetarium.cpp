@@ -4,6 +4,12 @@
 
 const FPreciseVector FPreciseVector::ZeroVector = FPreciseVector();
 
+DECLARE_CYCLE_STAT(TEXT("FlareSimulatedPlanetarium GetSnapShot"), STAT_FlareSimulatedPlanetarium_GetSnapShot, STATGROUP_Flare);
+
+
+// Gravitational constant
+#define PLANETARIUM_GRAVITATIONAL_CONSTANT 6.674e-11
+
 
 #define LOCTEXT_NAMESPACE "UFlareSimulatedPlanetarium"
 
@@ -14,6 +20,9 @@ const FPreciseVector FPreciseVector::ZeroVector = FPreciseVector();
 
 UFlareSimulatedPlanetarium::UFlareSimulatedPlanetarium(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, SnapshotValid(false)
+	, SnapshotTime(0)
+	, SnapshotSmoothTime(0)
 {
 }
 
@@ -87,12 +96,43 @@ void UFlareSimulatedPlanetarium::Load()
 		Nema.Sattelites.Add(Adena);
 	}
 	Sun.Sattelites.Add(Nema);
+
+	// Compute the orbits once the tree won't move anymore
+	Orbits.Empty();
+	OrbitIndices.Empty();
+	IndexCelestialBody(&Sun, INDEX_NONE);
+	SnapshotValid = false;
+}
+
+void UFlareSimulatedPlanetarium::IndexCelestialBody(FFlareCelestialBody* Body, int32 ParentIndex)
+{
+	FFlareCelestialBodyOrbit Orbit;
+	Orbit.Body = Body;
+	Orbit.ParentIndex = ParentIndex;
+	Orbit.RevolutionTime = 0;
+	Orbit.AngularVelocity = 0;
+	Orbit.RotationPeriod = (Body->RotationVelocity != 0 ? (int64) (360 / Body->RotationVelocity) : 0);
+
+	if (ParentIndex != INDEX_NONE)
+	{
+		Orbit.RevolutionTime = ComputeRevolutionTime(Orbits[ParentIndex].Body->Mass, Body->Mass, Body->OrbitDistance);
+		Orbit.AngularVelocity = 360. / (double) Orbit.RevolutionTime;
+	}
+
+	int32 OrbitIndex = Orbits.Add(Orbit);
+	OrbitIndices.Add(Body->Identifier, OrbitIndex);
+
+	for (int SatteliteIndex = 0; SatteliteIndex < Body->Sattelites.Num(); SatteliteIndex++)
+	{
+		IndexCelestialBody(&Body->Sattelites[SatteliteIndex], OrbitIndex);
+	}
 }
 
 
 FFlareCelestialBody* UFlareSimulatedPlanetarium::FindCelestialBody(FName BodyIdentifier)
 {
-	return FindCelestialBody(&Sun, BodyIdentifier);
+	const int32* OrbitIndex = OrbitIndices.Find(BodyIdentifier);
+	return (OrbitIndex ? Orbits[*OrbitIndex].Body : NULL);
 }
 
 FFlareCelestialBody* UFlareSimulatedPlanetarium::FindCelestialBody(FFlareCelestialBody* Body, FName BodyIdentifier)
@@ -117,12 +157,13 @@ FFlareCelestialBody* UFlareSimulatedPlanetarium::FindCelestialBody(FFlareCelesti
 
 FFlareCelestialBody* UFlareSimulatedPlanetarium::FindParent(FFlareCelestialBody* Body)
 {
-	if (&Sun == Body)
+	const int32* OrbitIndex = (Body ? OrbitIndices.Find(Body->Identifier) : NULL);
+	if (!OrbitIndex || Orbits[*OrbitIndex].ParentIndex == INDEX_NONE)
 	{
 		return NULL;
 	}
 
-	return FindParent(Body, &Sun);
+	return Orbits[Orbits[*OrbitIndex].ParentIndex].Body;
 }
 
 FFlareCelestialBody* UFlareSimulatedPlanetarium::FindParent(FFlareCelestialBody* Body, FFlareCelestialBody* Root)
@@ -163,53 +204,70 @@ float UFlareSimulatedPlanetarium::GetLightRatio(FFlareCelestialBody* Body, doubl
 	return 0.5 + FMath::Acos(Body->Radius / (Body->Radius + OrbitDistance)) / PI;
 }
 
-FFlareCelestialBody UFlareSimulatedPlanetarium::GetSnapShot(int64 Time, float SmoothTime)
+const FFlareCelestialBody& UFlareSimulatedPlanetarium::GetSnapShot(int64 Time, float SmoothTime)
 {
-	ComputeCelestialBodyLocation(NULL, &Sun, Time, SmoothTime);
-	return Sun;
-}
+	if (SnapshotValid && Time == SnapshotTime && SmoothTime == SnapshotSmoothTime)
+	{
+		return Sun;
+	}
 
-FPreciseVector UFlareSimulatedPlanetarium::GetRelativeLocation(FFlareCelestialBody* ParentBody, int64 Time, float SmoothTime, double OrbitDistance, double Mass, double InitialPhase)
-{
-	// TODO extract the constant
-	double G = 6.674e-11; // Gravitational constant
+	SCOPE_CYCLE_COUNTER(STAT_FlareSimulatedPlanetarium_GetSnapShot);
 
-	double MassSum = ParentBody->Mass + Mass;
-	double OrbitalVelocity = FPreciseMath::Sqrt(G * ((MassSum) / (1000 * OrbitDistance)));
+	// Parents come first, so their location is always ready for their sattelites
+	for (int32 OrbitIndex = 0; OrbitIndex < Orbits.Num(); OrbitIndex++)
+	{
+		const FFlareCelestialBodyOrbit& Orbit = Orbits[OrbitIndex];
+		FFlareCelestialBody* Body = Orbit.Body;
 
-	double OrbitalCircumference = 2 * PI * 1000 * OrbitDistance;
-	int64 RevolutionTime = (int64) (OrbitalCircumference / OrbitalVelocity);
+		if (Orbit.ParentIndex != INDEX_NONE)
+		{
+			Body->RelativeLocation = ComputeOrbitLocation(Orbit.RevolutionTime, Orbit.AngularVelocity, Time, SmoothTime, Body->OrbitDistance, 0);
+			Body->AbsoluteLocation = Orbits[Orbit.ParentIndex].Body->AbsoluteLocation + Body->RelativeLocation;
+		}
 
-	double CurrentRevolutionTime = fmod(((double) (Time % RevolutionTime) + SmoothTime), (double) RevolutionTime);
+		if (Orbit.RotationPeriod != 0)
+		{
+			Body->RotationAngle = FPreciseMath::UnwindDegrees(Body->RotationVelocity * (Time % Orbit.RotationPeriod)) + Body->RotationVelocity * SmoothTime;
+		}
+		else
+		{
+			Body->RotationAngle = 0;
+		}
+	}
 
-	double Phase = (360 * CurrentRevolutionTime / (double) RevolutionTime) + InitialPhase;
+	SnapshotValid = true;
+	SnapshotTime = Time;
+	SnapshotSmoothTime = SmoothTime;
 
+	return Sun;
+}
 
-	FPreciseVector RelativeLocation = OrbitDistance * FPreciseVector(FPreciseMath::Cos(FPreciseMath::DegreesToRadians(Phase)),
-			0,
-			FPreciseMath::Sin(FPreciseMath::DegreesToRadians(Phase)));
+FPreciseVector UFlareSimulatedPlanetarium::GetRelativeLocation(FFlareCelestialBody* ParentBody, int64 Time, float SmoothTime, double OrbitDistance, double Mass, double InitialPhase)
+{
+	int64 RevolutionTime = ComputeRevolutionTime(ParentBody->Mass, Mass, OrbitDistance);
+	return ComputeOrbitLocation(RevolutionTime, 360. / (double) RevolutionTime, Time, SmoothTime, OrbitDistance, InitialPhase);
+}
 
+int64 UFlareSimulatedPlanetarium::ComputeRevolutionTime(double ParentMass, double Mass, double OrbitDistance)
+{
+	double MassSum = ParentMass + Mass;
+	double OrbitalVelocity = FPreciseMath::Sqrt(PLANETARIUM_GRAVITATIONAL_CONSTANT * ((MassSum) / (1000 * OrbitDistance)));
 
-	return RelativeLocation;
+	double OrbitalCircumference = 2 * PI * 1000 * OrbitDistance;
+	return (int64) (OrbitalCircumference / OrbitalVelocity);
 }
 
-
-void UFlareSimulatedPlanetarium::ComputeCelestialBodyLocation(FFlareCelestialBody* ParentBody, FFlareCelestialBody* Body, int64 Time, float SmoothTime)
+FPreciseVector UFlareSimulatedPlanetarium::ComputeOrbitLocation(int64 RevolutionTime, double AngularVelocity, int64 Time, float SmoothTime, double OrbitDistance, double InitialPhase)
 {
-	if (ParentBody)
+	double CurrentRevolutionTime = (double) (Time % RevolutionTime) + SmoothTime;
+	if (CurrentRevolutionTime >= RevolutionTime)
 	{
-		Body->RelativeLocation = GetRelativeLocation(ParentBody, Time, SmoothTime, Body->OrbitDistance, Body->Mass, 0);
-		Body->AbsoluteLocation = ParentBody->AbsoluteLocation + Body->RelativeLocation;
+		CurrentRevolutionTime = fmod(CurrentRevolutionTime, (double) RevolutionTime);
 	}
 
-	int64 RotationPeriod = 360/Body->RotationVelocity;
+	double Phase = FPreciseMath::DegreesToRadians(AngularVelocity * CurrentRevolutionTime + InitialPhase);
 
-	Body->RotationAngle = FPreciseMath::UnwindDegrees(Body->RotationVelocity * (Time % RotationPeriod)) + Body->RotationVelocity * SmoothTime;
-	for (int SatteliteIndex = 0; SatteliteIndex < Body->Sattelites.Num(); SatteliteIndex++)
-	{
-		FFlareCelestialBody* CelestialBody = &Body->Sattelites[SatteliteIndex];
-		ComputeCelestialBodyLocation(Body, CelestialBody, Time, SmoothTime);
-	}
+	return OrbitDistance * FPreciseVector(FPreciseMath::Cos(Phase), 0, FPreciseMath::Sin(Phase));
 }
 
 AFlareGame* UFlareSimulatedPlanetarium::GetGame() const
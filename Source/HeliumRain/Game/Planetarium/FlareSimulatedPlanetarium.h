@@ -219,6 +219,25 @@ struct FFlareCelestialBody
 
 };
 
+/** Orbital constants of a celestial body, computed once at load */
+struct FFlareCelestialBodyOrbit
+{
+	/** Body in the planetarium tree */
+	FFlareCelestialBody* Body;
+
+	/** Index of the parent orbit, parents always come before their sattelites */
+	int32 ParentIndex;
+
+	/** Time for a full revolution around the parent. In s */
+	int64 RevolutionTime;
+
+	/** Orbital angular velocity. In degrees/s */
+	double AngularVelocity;
+
+	/** Time for a full self rotation, 0 if the body doesn't rotate. In s */
+	int64 RotationPeriod;
+};
+
 
 UCLASS()
 class HELIUMRAIN_API UFlareSimulatedPlanetarium : public UObject
@@ -231,8 +250,8 @@ public:
 	virtual void Load();
 
 
-	/** Load the planetarium */
-	virtual FFlareCelestialBody GetSnapShot(int64 Time, float SmoothTime);
+	/** Get the planetarium at a given time, computed again only when the time changes */
+	virtual const FFlareCelestialBody& GetSnapShot(int64 Time, float SmoothTime);
 
 	/** Get relative location of a body orbiting around its parent */
 	virtual FPreciseVector GetRelativeLocation(FFlareCelestialBody* ParentBody, int64 Time, float SmoothTime, double OrbitDistance, double Mass, double InitialPhase);
@@ -256,7 +275,14 @@ public:
 
 protected:
 
-	void ComputeCelestialBodyLocation(FFlareCelestialBody* ParentBody, FFlareCelestialBody* Body, int64 time, float SmoothTime);
+	/** Add a body and its sattelites to the flat orbit list */
+	void IndexCelestialBody(FFlareCelestialBody* Body, int32 ParentIndex);
+
+	/** Get the time for a body to orbit its parent */
+	static int64 ComputeRevolutionTime(double ParentMass, double Mass, double OrbitDistance);
+
+	/** Get the location of a body on its orbit */
+	static FPreciseVector ComputeOrbitLocation(int64 RevolutionTime, double AngularVelocity, int64 Time, float SmoothTime, double OrbitDistance, double InitialPhase);
 
 	/*----------------------------------------------------
 		Protected data
@@ -266,6 +292,15 @@ protected:
 
 	FFlareCelestialBody           Sun;
 
+	// Flat orbit list, indexed by body identifier
+	TArray<FFlareCelestialBodyOrbit> Orbits;
+	TMap<FName, int32>            OrbitIndices;
+
+	// Time of the current snapshot
+	bool                          SnapshotValid;
+	int64                         SnapshotTime;
+	float                         SnapshotSmoothTime;
+
 public:
 
 	/*----------------------------------------------------
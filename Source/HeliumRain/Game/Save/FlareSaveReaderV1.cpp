@@ -811,6 +811,16 @@ void UFlareSaveReaderV1::LoadSector(const TSharedPtr<FJsonObject> Object, FFlare
 		}
 	}
 
+	FString PriceHistoryDays;
+	if(Object->TryGetStringField(TEXT("PriceHistoryDays"), PriceHistoryDays))
+	{
+		Data->PriceHistoryDays = FCString::Atoi(*PriceHistoryDays);
+	}
+	else
+	{
+		Data->PriceHistoryDays = 0;
+	}
+
 	if(!Object->TryGetBoolField(TEXT("IsTravelSector"), Data->IsTravelSector))
 	{
 		Data->IsTravelSector = false;
@@ -876,7 +886,15 @@ void UFlareSaveReaderV1::LoadResourcePrice(const TSharedPtr<FJsonObject> Object,
 {
 	LoadFName(Object, "ResourceIdentifier", &Data->ResourceIdentifier);
 	LoadFloat(Object, "Price", &Data->Price);
-	LoadFloatBuffer(Object, "Prices", &Data->Prices);
+	LoadRoundedFloatArray(Object, "DailyPrices", &Data->DailyPrices);
+	LoadRoundedFloatArray(Object, "WeeklyPrices", &Data->WeeklyPrices);
+	LoadRoundedFloatArray(Object, "MonthlyPrices", &Data->MonthlyPrices);
+
+	// Old saves
+	if (Object->HasField(TEXT("Prices")))
+	{
+		LoadFloatBuffer(Object, "Prices", &Data->Prices);
+	}
 }
 
 
@@ -1004,6 +1022,20 @@ void UFlareSaveReaderV1::LoadFloatArray(TSharedPtr< FJsonObject > Object, FStrin
 	}
 }
 
+void UFlareSaveReaderV1::LoadRoundedFloatArray(TSharedPtr< FJsonObject > Object, FString Key, TArray<float>* Data)
+{
+	FString DataString;
+	if(Object->TryGetStringField(Key, DataString))
+	{
+		TArray<FString> Values;
+		DataString.ParseIntoArray(Values, TEXT(","));
+		for (const FString& Value : Values)
+		{
+			Data->Add(FCString::Atoi(*Value));
+		}
+	}
+}
+
 static bool ParseTransform(const FString& DataString, FTransform* Data)
 {
 	TArray<FString> Values;
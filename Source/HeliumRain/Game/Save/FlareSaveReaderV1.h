@@ -79,6 +79,7 @@ public:
 	void LoadFText(TSharedPtr< FJsonObject > Object, FString Key, FText* Data);
 	void LoadFNameArray(TSharedPtr< FJsonObject > Object, FString Key, TArray<FName>* Data);
 	void LoadFloatArray(TSharedPtr< FJsonObject > Object, FString Key, TArray<float>* Data);
+	void LoadRoundedFloatArray(TSharedPtr< FJsonObject > Object, FString Key, TArray<float>* Data);
 	void LoadTransform(TSharedPtr< FJsonObject > Object, FString Key, FTransform* Data);
 	bool LoadVector(TSharedPtr< FJsonObject > Object, FString Key, FVector* Data);
 	void LoadRotator(TSharedPtr< FJsonObject > Object, FString Key, FRotator* Data);
@@ -657,6 +657,7 @@ TSharedRef<FJsonObject> UFlareSaveWriter::SaveSector(FFlareSectorSave* Data)
 		ResourcePrices.Add(MakeShareable(new FJsonValueObject(SaveResourcePrice(&Data->ResourcePrices[i]))));
 	}
 	JsonObject->SetArrayField("ResourcePrices", ResourcePrices);
+	JsonObject->SetStringField("PriceHistoryDays", FormatInt32(Data->PriceHistoryDays));
 
 	JsonObject->SetBoolField("IsTravelSector", Data->IsTravelSector);
 
@@ -726,7 +727,9 @@ TSharedRef<FJsonObject> UFlareSaveWriter::SaveResourcePrice(FFFlareResourcePrice
 
 	JsonObject->SetStringField("ResourceIdentifier", Data->ResourceIdentifier.ToString());
 	SaveFloat(JsonObject,"Price", Data->Price);
-	JsonObject->SetObjectField("Prices", SaveFloatBuffer(&Data->Prices));
+	JsonObject->SetStringField("DailyPrices", FormatRoundedFloatArray(Data->DailyPrices));
+	JsonObject->SetStringField("WeeklyPrices", FormatRoundedFloatArray(Data->WeeklyPrices));
+	JsonObject->SetStringField("MonthlyPrices", FormatRoundedFloatArray(Data->MonthlyPrices));
 
 
 	return JsonObject;
@@ -140,6 +140,16 @@ public:
 				FixFloat(Data.GetScale3D().Z));
 	}
 
+	inline static FString FormatRoundedFloatArray(const TArray<float>& Data)
+	{
+		TArray<FString> Values;
+		for (float Value : Data)
+		{
+			Values.Add(FString::FromInt(FMath::RoundToInt(FixFloat(Value))));
+		}
+		return FString::Join(Values, TEXT(","));
+	}
+
 	inline static float FixFloat(float value)
 	{
 		if(FMath::IsNaN(value))
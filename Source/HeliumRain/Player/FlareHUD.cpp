@@ -9,6 +9,15 @@
 #include "../Economy/FlareCargoBay.h"
 #include "../Game/AI/FlareCompanyAI.h"
 #include "../Game/FlareGameUserSettings.h"
+#include "../Game/FlareAllocationStats.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("FlareHUD Tick allocations"), STAT_FlareHUD_TickAllocations, STATGROUP_Flare);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FlareHUD Draw allocations"), STAT_FlareHUD_DrawAllocations, STATGROUP_Flare);
+DECLARE_CYCLE_STAT(TEXT("FlareHUD UpdateDesignators"), STAT_FlareHUD_UpdateDesignators, STATGROUP_Flare);
+
+
+// Designators projected further than this out of the viewport are not drawn, in pixels
+#define DESIGNATOR_SCREEN_MARGIN 300
 
 
 #define LOCTEXT_NAMESPACE "FlareNavigationHUD"
@@ -31,6 +40,9 @@ AFlareHUD::AFlareHUD(const class FObjectInitializer& PCIP)
 	, GameThreadTime(0)
 	, RenderThreadTime(0)
 	, GPUFrameTime(0)
+	, ObjectiveSpacecraftsFrame(0)
+	, ProjectionValid(false)
+	, ProjectionFOV(0)
 {
 	// Load content (general icons)
 	static ConstructorHelpers::FObjectFinder<UTexture2D> HUDReticleIconObj         (TEXT("/Game/Gameplay/HUD/TX_Reticle.TX_Reticle"));
@@ -244,6 +256,7 @@ void AFlareHUD::SignalHit(AFlareSpacecraft* HitSpacecraft, EFlareDamage::Type Da
 
 void AFlareHUD::DrawHUD()
 {
+	SCOPE_FLARE_ALLOCATION_COUNTER(STAT_FlareHUD_DrawAllocations);
 	Super::DrawHUD();
 	AFlarePlayerController* PC = Cast<AFlarePlayerController>(GetOwner());
 
@@ -310,8 +323,13 @@ void AFlareHUD::DrawHUD()
 				// Speed indication
 				FVector ShipSmoothedVelocity = PlayerShip->GetSmoothedLinearVelocity() * 100;
 				int32 SpeedMS = (ShipSmoothedVelocity.Size() + 10.) / 100.0f;
-				FString VelocityText = FString::FromInt(PlayerShip->IsMovingForward() ? SpeedMS : -SpeedMS) + FString(" m/s");
-				FlareDrawText(VelocityText, FVector2D(0, 70), HUDNosePowerColor, true);
+				SpeedMS = (PlayerShip->IsMovingForward() ? SpeedMS : -SpeedMS);
+				if (VelocityText.Key != SpeedMS)
+				{
+					VelocityText.Key = SpeedMS;
+					VelocityText.Text = FString::FromInt(SpeedMS) + FString(" m/s");
+				}
+				FlareDrawText(VelocityText.Text, FVector2D(0, 70), HUDNosePowerColor, true);
 			}
 		}
 	}
@@ -325,6 +343,7 @@ void AFlareHUD::DrawHUD()
 
 void AFlareHUD::DrawHUDTexture(UCanvas* TargetCanvas, int32 Width, int32 Height)
 {
+	SCOPE_FLARE_ALLOCATION_COUNTER(STAT_FlareHUD_DrawAllocations);
 	CurrentViewportSize = FVector2D(Width, Height);
 	CurrentCanvas = TargetCanvas;
 	IsDrawingHUD = true;
@@ -337,6 +356,7 @@ void AFlareHUD::DrawHUDTexture(UCanvas* TargetCanvas, int32 Width, int32 Height)
 
 void AFlareHUD::Tick(float DeltaSeconds)
 {
+	SCOPE_FLARE_ALLOCATION_COUNTER(STAT_FlareHUD_TickAllocations);
 	Super::Tick(DeltaSeconds);
 	AFlarePlayerController* PC = Cast<AFlarePlayerController>(GetOwner());
 	AFlareSpacecraft* PlayerShip = PC->GetShipPawn();
@@ -645,11 +665,11 @@ void AFlareHUD::DrawCockpitEquipment(AFlareSpacecraft* PlayerShip)
 
 		// Cargo bay slots
 		uint32 MaxCargoBayCount = 8;
-		TArray<FFlareCargo>& CargoBaySlots = CargoBay->GetSlots();
+		const TArray<FFlareCargo>& CargoBaySlots = CargoBay->GetSlots();
 		for (int CargoIndex = 0; CargoIndex < CargoBaySlots.Num(); CargoIndex++)
 		{
 			// Create text
-			FFlareCargo& Cargo = CargoBaySlots[CargoIndex];
+			const FFlareCargo& Cargo = CargoBaySlots[CargoIndex];
 			FText CargoSlotResourceText = Cargo.Resource ? Cargo.Resource->Acronym : LOCTEXT("CargoBaySlotEmpty", "Empty slot");
 			FText CargoBaySlotText = FText::Format(LOCTEXT("CargoBaySlotFormat", "{0} ({1}/{2})"),
 				CargoSlotResourceText, FText::AsNumber(Cargo.Quantity), FText::AsNumber(CargoBay->GetSlotCapacity()));
@@ -704,12 +724,17 @@ void AFlareHUD::DrawCockpitTarget(AFlareSpacecraft* PlayerShip)
 		AFlareSpacecraft* TargetShip = PlayerShip->GetCurrentTarget();
 		if (TargetShip && TargetShip->IsValidLowLevel())
 		{
-			FText ShipText = FText::Format(LOCTEXT("CurrentTargetFormat", "Targeting {0}"),
-				UFlareGameTools::DisplaySpacecraftName(TargetShip->GetParent()));
+			int64 TargetKey = reinterpret_cast<PTRINT>(TargetShip->GetParent());
+			if (TargetNameText.Key != TargetKey)
+			{
+				TargetNameText.Key = TargetKey;
+				TargetNameText.Text = FText::Format(LOCTEXT("CurrentTargetFormat", "Targeting {0}"),
+					UFlareGameTools::DisplaySpacecraftName(TargetShip->GetParent())).ToString();
+			}
 
 			// Get target color
 			FLinearColor TargetColor;
-			if (PC->GetCurrentObjective() && PC->GetCurrentObjective()->TargetSpacecrafts.Find(TargetShip->GetParent()) != INDEX_NONE)
+			if (IsObjectiveSpacecraft(PC, TargetShip))
 			{
 				TargetColor = Theme.ObjectiveColor;
 			}
@@ -723,9 +748,9 @@ void AFlareHUD::DrawCockpitTarget(AFlareSpacecraft* PlayerShip)
 			}
 
 			// Draw
-			FlareDrawText(ShipText.ToString(), CurrentPos, TargetColor, false);
+			FlareDrawText(TargetNameText.Text, CurrentPos, TargetColor, false);
 			CurrentPos += FVector2D(InstrumentSize.X, 0) * 0.8;
-			DrawHUDDesignatorStatus(CurrentPos, IconSize, TargetShip);
+			DrawHUDDesignatorStatus(CurrentPos, IconSize, GetDesignatorStatus(TargetShip));
 			CurrentPos -= FVector2D(InstrumentSize.X, 0) * 0.8;
 		}
 		CurrentPos += InstrumentLine;
@@ -1000,33 +1025,25 @@ void AFlareHUD::DrawHUDInternal()
 		DrawHUDIconRotated(CurrentViewportSize / 2 + MousePosDelta, IconSize, HUDCombatMouseIcon, PointerColor, MousePosDelta3D.Rotation().Yaw);
 	}
 
-	// Iterate on all 'other' ships to show designators, markings, etc
-	for (int SpacecraftIndex = 0; SpacecraftIndex < ActiveSector->GetSpacecrafts().Num(); SpacecraftIndex ++)
+	// Show designators, markings, etc on all 'other' ships that may draw something
+	UpdateDesignators(PC, PlayerShip, ActiveSector);
+	bool PlayerAlive = PlayerShip->GetParent()->GetDamageSystem()->IsAlive();
+	for (const FFlareHUDDesignator& Designator : Designators)
 	{
-		AFlareSpacecraft* Spacecraft = ActiveSector->GetSpacecrafts()[SpacecraftIndex];
-		if (Spacecraft != PlayerShip)
-		{
-			// Draw designators
-			bool ShouldDrawSearchMarker = DrawHUDDesignator(Spacecraft);
+		// Draw designators
+		bool ShouldDrawSearchMarker = DrawHUDDesignator(Designator);
 
-			// Draw docking guides
-			bool Highlighted = (PlayerShip && Spacecraft == PlayerShip->GetCurrentTarget());
-			if (Highlighted)
-			{
-				DrawDockingHelper(Spacecraft);
-			}
-
-			bool IsObjective = (PC->GetCurrentObjective() && PC->GetCurrentObjective()->TargetSpacecrafts.Find(Spacecraft->GetParent()) != INDEX_NONE);
+		// Draw docking guides
+		if (Designator.Highlighted)
+		{
+			DrawDockingHelper(Designator.Spacecraft);
+		}
 
-			// Draw search markers for alive ships or highlighted stations when not in external camera
-			if (!IsExternalCamera && ShouldDrawSearchMarker
-				&& PlayerShip->GetParent()->GetDamageSystem()->IsAlive()
-				&& Spacecraft->GetParent()->GetDamageSystem()->IsAlive()
-				&& (Highlighted || IsObjective || !Spacecraft->IsStation())
-			)
-			{
-				DrawSearchArrow(Spacecraft->GetActorLocation(), GetHostilityColor(PC, Spacecraft), Highlighted, FocusDistance);
-			}
+		// Draw search markers for alive ships or highlighted stations when not in external camera
+		if (!IsExternalCamera && ShouldDrawSearchMarker && PlayerAlive && Designator.Alive
+			&& (Designator.Highlighted || Designator.Objective || !Designator.Spacecraft->IsStation()))
+		{
+			DrawSearchArrow(Designator.Location, Designator.Color, Designator.Highlighted, FocusDistance);
 		}
 	}
 
@@ -1039,6 +1056,7 @@ void AFlareHUD::DrawHUDInternal()
 	if (PC->HasObjective() && PC->GetCurrentObjective()->TargetList.Num() > 0)
 	{
 		FVector2D ScreenPosition;
+		ObjectiveDistanceTexts.SetNum(PC->GetCurrentObjective()->TargetList.Num());
 
 		for (int TargetIndex = 0; TargetIndex < PC->GetCurrentObjective()->TargetList.Num(); TargetIndex++)
 		{
@@ -1058,7 +1076,7 @@ void AFlareHUD::DrawHUDInternal()
 
 						// Draw distance
 						float Distance = FMath::Max(0.f, ((ObjectiveLocation - PlayerShip->GetActorLocation()).Size() - Target->Radius) / 100);
-						FString ObjectiveText = FormatDistance(Distance);
+						const FString& ObjectiveText = GetDistanceText(ObjectiveDistanceTexts[TargetIndex], Distance);
 						FVector2D CenterScreenPosition = ScreenPosition - CurrentViewportSize / 2 + FVector2D(0, IconSize);
 						FlareDrawText(ObjectiveText, CenterScreenPosition, (Target->Active ? HudColorObjective : HudColorNeutral));
 					}
@@ -1256,126 +1274,172 @@ void AFlareHUD::DrawSearchArrow(FVector TargetLocation, FLinearColor Color, bool
 	}
 }
 
-bool AFlareHUD::DrawHUDDesignator(AFlareSpacecraft* Spacecraft)
+void AFlareHUD::UpdateDesignators(AFlarePlayerController* PC, AFlareSpacecraft* PlayerShip, UFlareSector* ActiveSector)
 {
-	// Calculation data
-	FVector2D ScreenPosition;
-	AFlarePlayerController* PC = Cast<AFlarePlayerController>(GetOwner());
-	FVector PlayerLocation = PC->GetShipPawn()->GetActorLocation();
-	FVector TargetLocation = Spacecraft->GetActorLocation();
-	bool ScreenPositionValid = false;
+	SCOPE_CYCLE_COUNTER(STAT_FlareHUD_UpdateDesignators);
 
-	if (ProjectWorldLocationToCockpit(TargetLocation, ScreenPosition) && Spacecraft != ContextMenuSpacecraft)
-	{
-		ScreenPositionValid = true;
+	FVector PlayerLocation = PlayerShip->GetActorLocation();
+	AFlareSpacecraft* CurrentTarget = PlayerShip->GetCurrentTarget();
+	Designators.Reset();
 
-		// Compute apparent size in screenspace
-		float ShipSize = 2 * Spacecraft->GetMeshScale();
-		float Distance = (TargetLocation - PlayerLocation).Size();
-		float ApparentAngle = FMath::RadiansToDegrees(FMath::Atan(ShipSize / Distance));
-		float Size = (ApparentAngle / PC->PlayerCameraManager->GetFOVAngle()) * CurrentViewportSize.X;
-		FVector2D ObjectSize = FMath::Min(0.66f * Size, 300.0f) * FVector2D(1, 1);
+	// Cull first : spacecrafts out of the screen only get a search arrow when close enough, the target always stays
+	for (AFlareSpacecraft* Spacecraft : ActiveSector->GetSpacecrafts())
+	{
+		if (Spacecraft == PlayerShip)
+		{
+			continue;
+		}
 
-		// Draw the HUD designator
-		if (Spacecraft->GetParent()->GetDamageSystem()->IsAlive())
+		FFlareHUDDesignator Designator;
+		Designator.Spacecraft = Spacecraft;
+		Designator.Location = Spacecraft->GetActorLocation();
+		Designator.Distance = (Designator.Location - PlayerLocation).Size();
+		Designator.Highlighted = (Spacecraft == CurrentTarget);
+		Designator.ScreenPositionValid = (Spacecraft != ContextMenuSpacecraft && ProjectWorldLocationToCockpit(Designator.Location, Designator.ScreenPosition));
+		Designator.OnScreen = Designator.ScreenPositionValid
+			&& Designator.ScreenPosition.X > -DESIGNATOR_SCREEN_MARGIN && Designator.ScreenPosition.X < CurrentViewportSize.X + DESIGNATOR_SCREEN_MARGIN
+			&& Designator.ScreenPosition.Y > -DESIGNATOR_SCREEN_MARGIN && Designator.ScreenPosition.Y < CurrentViewportSize.Y + DESIGNATOR_SCREEN_MARGIN;
+
+		if (Designator.OnScreen || Designator.Highlighted || Designator.Distance < FocusDistance)
 		{
-			float CornerSize = 8;
-			AFlareSpacecraft* PlayerShip = PC->GetShipPawn();
-			FVector2D CenterPos = ScreenPosition - ObjectSize / 2;
-			FLinearColor Color = GetHostilityColor(PC, Spacecraft);
-
-			// Draw designator corners
-			bool Highlighted = (PlayerShip && Spacecraft == PlayerShip->GetCurrentTarget());
-			bool Dangerous = PilotHelper::IsShipDangerous(Spacecraft);
-			DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(-1, -1), 0,     Color, Dangerous, Highlighted);
-			DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(-1, +1), -90,   Color, Dangerous, Highlighted);
-			DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(+1, +1), -180,  Color, Dangerous, Highlighted);
-			DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(+1, -1), -270,  Color, Dangerous, Highlighted);
-
-			// Draw the target's distance if selected
-			if (Spacecraft == PlayerShip->GetCurrentTarget())
-			{
-				FString DistanceText = FormatDistance(Distance / 100);
-				FVector2D DistanceTextPosition = ScreenPosition - (CurrentViewportSize / 2)
-					+ FVector2D(-ObjectSize.X / 2, ObjectSize.Y / 2)
-					+ FVector2D(2 * CornerSize, 3 * CornerSize);
-				FlareDrawText(DistanceText, DistanceTextPosition, Color);
-			}
+			Designators.Add(Designator);
+		}
+	}
 
-			// Draw the status for close targets or highlighted
-			if (!Spacecraft->GetParent()->IsStation() && (ObjectSize.X > 0.15 * IconSize || Highlighted))
+	// Then compute the drawing state of what is left
+	float FOV = PC->PlayerCameraManager->GetFOVAngle();
+	for (FFlareHUDDesignator& Designator : Designators)
+	{
+		AFlareSpacecraft* Spacecraft = Designator.Spacecraft;
+		Designator.Alive = Spacecraft->GetParent()->GetDamageSystem()->IsAlive();
+		Designator.Objective = IsObjectiveSpacecraft(PC, Spacecraft);
+		Designator.Color = GetHostilityColor(PC, Spacecraft);
+		Designator.ObjectSize = FVector2D::ZeroVector;
+		Designator.StatusFlags = EFlareDesignatorStatus::None;
+		Designator.Dangerous = false;
+
+		if (Designator.OnScreen && Designator.Alive)
+		{
+			// Compute apparent size in screenspace
+			float ShipSize = 2 * Spacecraft->GetMeshScale();
+			float ApparentAngle = FMath::RadiansToDegrees(FMath::Atan(ShipSize / Designator.Distance));
+			float Size = (ApparentAngle / FOV) * CurrentViewportSize.X;
+			Designator.ObjectSize = FMath::Min(0.66f * Size, 300.0f) * FVector2D(1, 1);
+
+			// Status for close targets or highlighted
+			Designator.Dangerous = PilotHelper::IsShipDangerous(Spacecraft);
+			if (!Spacecraft->GetParent()->IsStation() && (Designator.ObjectSize.X > 0.15 * IconSize || Designator.Highlighted))
 			{
-				int32 NumberOfIcons = Spacecraft->GetParent()->IsMilitary() ? 3 : 2;
-				FVector2D StatusPos = CenterPos;
-				StatusPos.X += 0.5 * (ObjectSize.X - NumberOfIcons * IconSize);
-				StatusPos.Y -= (IconSize + 0.5 * CornerSize);
-				DrawHUDDesignatorStatus(StatusPos, IconSize, Spacecraft);
+				Designator.StatusFlags = GetDesignatorStatus(Spacecraft);
 			}
 		}
 	}
+}
+
+bool AFlareHUD::DrawHUDDesignator(const FFlareHUDDesignator& Designator)
+{
+	// Calculation data
+	AFlarePlayerController* PC = Cast<AFlarePlayerController>(GetOwner());
+	AFlareSpacecraft* PlayerShip = PC->GetShipPawn();
+	AFlareSpacecraft* Spacecraft = Designator.Spacecraft;
+	FVector2D ScreenPosition = Designator.ScreenPosition;
+	FVector2D ObjectSize = Designator.ObjectSize;
 
-	if (Spacecraft != ContextMenuSpacecraft && Spacecraft->GetParent()->GetDamageSystem()->IsAlive())
+	// Draw the HUD designator
+	if (Designator.OnScreen && Designator.Alive)
 	{
-		AFlareSpacecraft* PlayerShip = PC->GetShipPawn();
-		float Distance = (TargetLocation - PlayerLocation).Size();
+		float CornerSize = 8;
+		FVector2D CenterPos = ScreenPosition - ObjectSize / 2;
+
+		// Draw designator corners
+		DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(-1, -1), 0,     Designator.Color, Designator.Dangerous, Designator.Highlighted);
+		DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(-1, +1), -90,   Designator.Color, Designator.Dangerous, Designator.Highlighted);
+		DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(+1, +1), -180,  Designator.Color, Designator.Dangerous, Designator.Highlighted);
+		DrawHUDDesignatorCorner(ScreenPosition, ObjectSize, CornerSize, FVector2D(+1, -1), -270,  Designator.Color, Designator.Dangerous, Designator.Highlighted);
+
+		// Draw the target's distance if selected
+		if (Designator.Highlighted)
+		{
+			FVector2D DistanceTextPosition = ScreenPosition - (CurrentViewportSize / 2)
+				+ FVector2D(-ObjectSize.X / 2, ObjectSize.Y / 2)
+				+ FVector2D(2 * CornerSize, 3 * CornerSize);
+			FlareDrawText(GetDistanceText(TargetDistanceText, Designator.Distance / 100), DistanceTextPosition, Designator.Color);
+		}
 
-		// Combat helper
-		if (Spacecraft == PlayerShip->GetCurrentTarget()
-		 && PlayerShip && PlayerShip->GetWeaponsSystem()->GetActiveWeaponType() != EFlareWeaponGroupType::WG_NONE)
+		// Draw the status
+		if (Designator.StatusFlags != EFlareDesignatorStatus::None)
 		{
-			FFlareWeaponGroup* WeaponGroup = PlayerShip->GetWeaponsSystem()->GetActiveWeaponGroup();
-			if (WeaponGroup)
+			int32 NumberOfIcons = Spacecraft->GetParent()->IsMilitary() ? 3 : 2;
+			FVector2D StatusPos = CenterPos;
+			StatusPos.X += 0.5 * (ObjectSize.X - NumberOfIcons * IconSize);
+			StatusPos.Y -= (IconSize + 0.5 * CornerSize);
+			DrawHUDDesignatorStatus(StatusPos, IconSize, Designator.StatusFlags);
+		}
+	}
+
+	// Combat helper
+	if (Spacecraft != ContextMenuSpacecraft && Designator.Alive && Designator.Highlighted
+	 && PlayerShip->GetWeaponsSystem()->GetActiveWeaponType() != EFlareWeaponGroupType::WG_NONE)
+	{
+		FFlareWeaponGroup* WeaponGroup = PlayerShip->GetWeaponsSystem()->GetActiveWeaponGroup();
+		if (WeaponGroup)
+		{
+			FVector2D HelperScreenPosition;
+			FVector AmmoIntersectionLocation;
+			float AmmoVelocity = WeaponGroup->Weapons[0]->GetAmmoVelocity();
+			float Range = 100 * WeaponGroup->Weapons[0]->GetDescription()->WeaponCharacteristics.GunCharacteristics.AmmoRange;
+			float InterceptTime = Spacecraft->GetAimPosition(PlayerShip, AmmoVelocity, 0.0, &AmmoIntersectionLocation);
+
+			if (InterceptTime > 0 && ProjectWorldLocationToCockpit(AmmoIntersectionLocation, HelperScreenPosition) && (Range == 0 || Designator.Distance < Range))
 			{
-				FVector2D HelperScreenPosition;
-				FVector AmmoIntersectionLocation;
-				float AmmoVelocity = WeaponGroup->Weapons[0]->GetAmmoVelocity();
-				float Range = 100 * WeaponGroup->Weapons[0]->GetDescription()->WeaponCharacteristics.GunCharacteristics.AmmoRange;
-				float InterceptTime = Spacecraft->GetAimPosition(PlayerShip, AmmoVelocity, 0.0, &AmmoIntersectionLocation);
+				FLinearColor HUDAimHelperColor = Designator.Color;
 
-				if (InterceptTime > 0 && ProjectWorldLocationToCockpit(AmmoIntersectionLocation, HelperScreenPosition) && (Range == 0 || Distance < Range))
+				// Draw aiming helper for ships
+				if (!Spacecraft->IsStation())
 				{
-					FLinearColor HUDAimHelperColor = GetHostilityColor(PC, Spacecraft);
-
-					// Draw aiming helper for ships
-					if (!Spacecraft->IsStation())
+					DrawHUDIcon(HelperScreenPosition, IconSize, HUDAimHelperIcon, HUDAimHelperColor, true);
+					if (Designator.ScreenPositionValid)
 					{
-						DrawHUDIcon(HelperScreenPosition, IconSize, HUDAimHelperIcon, HUDAimHelperColor, true);
-						if (ScreenPositionValid)
-						{
-							FlareDrawLine(ScreenPosition, HelperScreenPosition, HUDAimHelperColor);
-						}
+						FlareDrawLine(ScreenPosition, HelperScreenPosition, HUDAimHelperColor);
 					}
+				}
 
-					// Snip helpers
-					float ZoomAlpha = PC->GetShipPawn()->GetStateManager()->GetCombatZoomAlpha();
-					if (ScreenPositionValid && !Spacecraft->IsStation() && Spacecraft->GetSize() == EFlarePartSize::L && ZoomAlpha > 0
-						&& PlayerShip->GetWeaponsSystem()->GetActiveWeaponType() == EFlareWeaponGroupType::WG_GUN)
-					{
-						FVector2D AimOffset = ScreenPosition - HelperScreenPosition;
-						UTexture2D* NoseIcon = (PlayerHitSpacecraft != NULL) ? HUDAimHitIcon : HUDAimIcon;
+				// Snip helpers
+				float ZoomAlpha = PlayerShip->GetStateManager()->GetCombatZoomAlpha();
+				if (Designator.ScreenPositionValid && !Spacecraft->IsStation() && Spacecraft->GetSize() == EFlarePartSize::L && ZoomAlpha > 0
+					&& PlayerShip->GetWeaponsSystem()->GetActiveWeaponType() == EFlareWeaponGroupType::WG_GUN)
+				{
+					FVector2D AimOffset = ScreenPosition - HelperScreenPosition;
+					UTexture2D* NoseIcon = (PlayerHitSpacecraft != NULL) ? HUDAimHitIcon : HUDAimIcon;
 
-						FLinearColor AimOffsetColor = HudColorFriendly;
-						AimOffsetColor.A = ZoomAlpha * 0.5;
+					FLinearColor AimOffsetColor = HudColorFriendly;
+					AimOffsetColor.A = ZoomAlpha * 0.5;
 
-						DrawHUDIcon(AimOffset + CurrentViewportSize / 2, IconSize *0.75 , NoseIcon, AimOffsetColor, true);
-						FlareDrawLine(CurrentViewportSize / 2, AimOffset + CurrentViewportSize / 2, AimOffsetColor);
-					}
-					
-					// Bomber UI (time display)
-					EFlareWeaponGroupType::Type WeaponType = PlayerShip->GetWeaponsSystem()->GetActiveWeaponType();
-					if (WeaponType == EFlareWeaponGroupType::WG_BOMB)
+					DrawHUDIcon(AimOffset + CurrentViewportSize / 2, IconSize *0.75 , NoseIcon, AimOffsetColor, true);
+					FlareDrawLine(CurrentViewportSize / 2, AimOffset + CurrentViewportSize / 2, AimOffsetColor);
+				}
+				
+				// Bomber UI (time display)
+				EFlareWeaponGroupType::Type WeaponType = PlayerShip->GetWeaponsSystem()->GetActiveWeaponType();
+				if (WeaponType == EFlareWeaponGroupType::WG_BOMB)
+				{
+					int32 Seconds = InterceptTime;
+					int32 Tenths = (InterceptTime - Seconds) * 10;
+					if (TargetTimeText.Key != 10 * Seconds + Tenths)
 					{
-						FString TimeText = FString::FromInt(InterceptTime) + FString(".") + FString::FromInt( (InterceptTime - (int) InterceptTime ) *10) + FString(" s");
-						FVector2D TimePosition = ScreenPosition - CurrentViewportSize / 2 - FVector2D(42,0);
-						FlareDrawText(TimeText, TimePosition, HUDAimHelperColor);
+						TargetTimeText.Key = 10 * Seconds + Tenths;
+						TargetTimeText.Text = FString::FromInt(Seconds) + FString(".") + FString::FromInt(Tenths) + FString(" s");
 					}
+
+					FVector2D TimePosition = ScreenPosition - CurrentViewportSize / 2 - FVector2D(42,0);
+					FlareDrawText(TargetTimeText.Text, TimePosition, HUDAimHelperColor);
 				}
 			}
 		}
 	}
 
 	// Tell the HUD to draw the search marker only if we are outside this
-	if (ScreenPositionValid)
+	if (Designator.ScreenPositionValid)
 	{
 		return !IsInScreen(ScreenPosition);
 	}
@@ -1409,26 +1473,52 @@ void AFlareHUD::DrawHUDDesignatorCorner(FVector2D Position, FVector2D ObjectSize
 		Rotation);
 }
 
-void AFlareHUD::DrawHUDDesignatorStatus(FVector2D Position, float DesignatorIconSize, AFlareSpacecraft* Ship)
+int32 AFlareHUD::GetDesignatorStatus(AFlareSpacecraft* Ship) const
 {
 	UFlareSimulatedSpacecraftDamageSystem* DamageSystem = Ship->GetParent()->GetDamageSystem();
+	int32 StatusFlags = EFlareDesignatorStatus::None;
 
 	if (DamageSystem->IsStranded())
 	{
-		Position = DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDPropulsionIcon);
+		StatusFlags |= EFlareDesignatorStatus::Stranded;
 	}
 
 	if (DamageSystem->IsUncontrollable())
 	{
-		Position = DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDRCSIcon);
+		StatusFlags |= EFlareDesignatorStatus::Uncontrollable;
 	}
 
 	if (Ship->GetParent()->IsMilitary() && DamageSystem->IsDisarmed())
 	{
-		DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDWeaponIcon);
+		StatusFlags |= EFlareDesignatorStatus::Disarmed;
 	}
 
 	if (Ship->GetParent()->IsHarpooned() && Ship->GetParent()->GetCompany()->GetPlayerHostility() != EFlareHostility::Owned)
+	{
+		StatusFlags |= EFlareDesignatorStatus::Harpooned;
+	}
+
+	return StatusFlags;
+}
+
+void AFlareHUD::DrawHUDDesignatorStatus(FVector2D Position, float DesignatorIconSize, int32 StatusFlags)
+{
+	if (StatusFlags & EFlareDesignatorStatus::Stranded)
+	{
+		Position = DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDPropulsionIcon);
+	}
+
+	if (StatusFlags & EFlareDesignatorStatus::Uncontrollable)
+	{
+		Position = DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDRCSIcon);
+	}
+
+	if (StatusFlags & EFlareDesignatorStatus::Disarmed)
+	{
+		DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDWeaponIcon);
+	}
+
+	if (StatusFlags & EFlareDesignatorStatus::Harpooned)
 	{
 		DrawHUDDesignatorStatusIcon(Position, DesignatorIconSize, HUDHarpoonedIcon);
 	}
@@ -1567,7 +1657,7 @@ void AFlareHUD::DrawHUDIconRotated(FVector2D Position, float DesignatorIconSize,
 		EBlendMode::BLEND_Translucent, 1.0f, false, Rotation, FVector2D::UnitVector / 2);
 }
 
-void AFlareHUD::FlareDrawText(FString Text, FVector2D Position, FLinearColor Color, bool Center, bool Large)
+void AFlareHUD::FlareDrawText(const FString& Text, FVector2D Position, FLinearColor Color, bool Center, bool Large)
 {
 	if (CurrentCanvas)
 	{
@@ -1690,7 +1780,7 @@ bool AFlareHUD::IsInScreen(FVector2D ScreenPosition) const
 
 FLinearColor AFlareHUD::GetHostilityColor(AFlarePlayerController* PC, AFlareSpacecraft* Target)
 {
-	if (PC->GetCurrentObjective() && PC->GetCurrentObjective()->TargetSpacecrafts.Find(Target->GetParent()) != INDEX_NONE)
+	if (IsObjectiveSpacecraft(PC, Target))
 	{
 		return HudColorObjective;
 	}
@@ -1711,21 +1801,87 @@ FLinearColor AFlareHUD::GetHostilityColor(AFlarePlayerController* PC, AFlareSpac
 	}
 }
 
+bool AFlareHUD::IsObjectiveSpacecraft(AFlarePlayerController* PC, AFlareSpacecraft* Target)
+{
+	// Objective targets are gathered once per frame
+	if (ObjectiveSpacecraftsFrame != GFrameCounter)
+	{
+		ObjectiveSpacecraftsFrame = GFrameCounter;
+		ObjectiveSpacecrafts.Reset();
+
+		if (PC->GetCurrentObjective())
+		{
+			ObjectiveSpacecrafts.Append(PC->GetCurrentObjective()->TargetSpacecrafts);
+		}
+	}
+
+	return ObjectiveSpacecrafts.Contains(Target->GetParent());
+}
+
+const FString& AFlareHUD::GetDistanceText(FFlareHUDCachedText& Cache, float Distance)
+{
+	// Same rounding as FormatDistance
+	int32 Meters = Distance;
+	int64 Key = (Meters < 1000 ? Meters : (Meters < 10000 ? (Meters / 100) * 100 : (Meters / 1000) * 1000));
+
+	if (Cache.Key != Key)
+	{
+		Cache.Key = Key;
+		Cache.Text = FormatDistance(Distance);
+	}
+
+	return Cache.Text;
+}
+
 bool AFlareHUD::ProjectWorldLocationToCockpit(FVector World, FVector2D& Cockpit)
+{
+	if (UpdateProjection())
+	{
+		return FSceneView::ProjectWorldToScreen(World, ProjectionRect, ProjectionMatrix, Cockpit);
+	}
+	else
+	{
+		return false;
+	}
+}
+
+bool AFlareHUD::UpdateProjection()
 {
 	AFlarePlayerController* PC = Cast<AFlarePlayerController>(GetOwner());
+	ULocalPlayer* LocalPlayer = (PC ? PC->GetLocalPlayer() : NULL);
+
+	if (!LocalPlayer || !LocalPlayer->ViewportClient || !LocalPlayer->ViewportClient->Viewport || !PC->PlayerCameraManager)
+	{
+		ProjectionValid = false;
+		return false;
+	}
+
+	// Keep the projection while the view is the same
+	FVector CameraLocation = PC->PlayerCameraManager->GetCameraLocation();
+	FRotator CameraRotation = PC->PlayerCameraManager->GetCameraRotation();
+	float CameraFOV = PC->PlayerCameraManager->GetFOVAngle();
+	FIntPoint ViewportSizeXY = LocalPlayer->ViewportClient->Viewport->GetSizeXY();
 
-	FVector2D Screen;
-	if (PC->ProjectWorldLocationToScreen(World, Screen))
+	if (ProjectionValid && CameraLocation == ProjectionLocation && CameraRotation == ProjectionRotation
+	 && CameraFOV == ProjectionFOV && ViewportSizeXY == ProjectionViewportSize)
 	{
-		Cockpit = Screen;
 		return true;
 	}
-	else
+
+	// Same computation as APlayerController::ProjectWorldLocationToScreen
+	FSceneViewProjectionData ProjectionData;
+	ProjectionValid = LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, eSSP_FULL, ProjectionData);
+	if (ProjectionValid)
 	{
-		return false;
+		ProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
+		ProjectionRect = ProjectionData.GetConstrainedViewRect();
+		ProjectionLocation = CameraLocation;
+		ProjectionRotation = CameraRotation;
+		ProjectionFOV = CameraFOV;
+		ProjectionViewportSize = ViewportSizeXY;
 	}
 
+	return ProjectionValid;
 }
 
 bool AFlareHUD::IsFlyingMilitaryShip() const
@@ -10,6 +10,52 @@
 class SFlareHUDMenu;
 class SFlareMouseMenu;
 class UFlareWeapon;
+class UFlareSector;
+class UFlareSimulatedSpacecraft;
+
+
+/** Damage status icons shown over a designator */
+namespace EFlareDesignatorStatus
+{
+	enum Type
+	{
+		None =           0,
+		Stranded =       1 << 0,
+		Uncontrollable = 1 << 1,
+		Disarmed =       1 << 2,
+		Harpooned =      1 << 3
+	};
+}
+
+/** Everything needed to draw the designator of a spacecraft, computed once per frame */
+struct FFlareHUDDesignator
+{
+	AFlareSpacecraft*                       Spacecraft;
+	FVector                                 Location;
+	float                                   Distance;
+	FVector2D                               ScreenPosition;
+	FVector2D                               ObjectSize;
+	FLinearColor                            Color;
+	int32                                   StatusFlags;
+	bool                                    ScreenPositionValid;
+	bool                                    OnScreen;
+	bool                                    Alive;
+	bool                                    Highlighted;
+	bool                                    Objective;
+	bool                                    Dangerous;
+};
+
+/** A formatted string, kept until the value it displays changes */
+struct FFlareHUDCachedText
+{
+	FFlareHUDCachedText()
+		: Key(MIN_int64)
+	{
+	}
+
+	int64                                   Key;
+	FString                                 Text;
+};
 
 
 /** Navigation HUD */
@@ -132,14 +178,20 @@ protected:
 	/** Draw a search arrow */
 	void DrawSearchArrow(FVector TargetLocation, FLinearColor Color, bool Highlighted, float MaxDistance = 10000000);
 
+	/** Build the list of designators to draw this frame, culling those that would draw nothing */
+	void UpdateDesignators(AFlarePlayerController* PC, AFlareSpacecraft* PlayerShip, UFlareSector* ActiveSector);
+
 	/** Draw a designator block around a spacecraft */
-	bool DrawHUDDesignator(AFlareSpacecraft* Spacecraft);
+	bool DrawHUDDesignator(const FFlareHUDDesignator& Designator);
 
 	/** Draw a designator corner */
 	void DrawHUDDesignatorCorner(FVector2D Position, FVector2D ObjectSize, float IconSize, FVector2D MainOffset, float Rotation, FLinearColor HudColor, bool Dangerous, bool Highlighted);
 
+	/** Get the EFlareDesignatorStatus flags of a ship */
+	int32 GetDesignatorStatus(AFlareSpacecraft* Ship) const;
+
 	/** Draw a status block for the ship */
-	void DrawHUDDesignatorStatus(FVector2D Position, float IconSize, AFlareSpacecraft* Ship);
+	void DrawHUDDesignatorStatus(FVector2D Position, float IconSize, int32 StatusFlags);
 
 	/** Draw a docking helper around a station */
 	void DrawDockingHelper(AFlareSpacecraft* Spacecraft);
@@ -154,7 +206,7 @@ protected:
 	void DrawHUDIconRotated(FVector2D Position, float IconSize, UTexture2D* Texture, FLinearColor Color = FLinearColor::White, float Rotation = 0);
 
 	/** Print a text with a shadow */
-	void FlareDrawText(FString Text, FVector2D Position, FLinearColor Color = FLinearColor::White, bool Center = true, bool Large = false);
+	void FlareDrawText(const FString& Text, FVector2D Position, FLinearColor Color = FLinearColor::White, bool Center = true, bool Large = false);
 
 	/** Draw a texture */
 	void FlareDrawTexture(UTexture* Texture, float ScreenX, float ScreenY, float ScreenW, float ScreenH, float TextureU, float TextureV, float TextureUWidth, float TextureVHeight, FLinearColor TintColor = FLinearColor::White, EBlendMode BlendMode = BLEND_Translucent, float Scale = 1.f, bool bScalePosition = false, float Rotation = 0.f, FVector2D RotPivot = FVector2D::ZeroVector);
@@ -171,11 +223,20 @@ protected:
 	/** Get the appropriate hostility color */
 	FLinearColor GetHostilityColor(AFlarePlayerController* PC, AFlareSpacecraft* Target);
 
+	/** Is this spacecraft a target of the current objective */
+	bool IsObjectiveSpacecraft(AFlarePlayerController* PC, AFlareSpacecraft* Target);
+
+	/** Get a distance text, formatted again only when the displayed value changes */
+	const FString& GetDistanceText(FFlareHUDCachedText& Cache, float Distance);
+
 	/** Is the player flying a military ship */
 	bool IsFlyingMilitaryShip() const;
 	
 	/** Convert a world location to cockpit-space */
 	bool ProjectWorldLocationToCockpit(FVector World, FVector2D& Cockpit);
+
+	/** Compute the view projection again if the camera or viewport changed */
+	bool UpdateProjection();
 	
 
 protected:
@@ -223,6 +284,27 @@ protected:
 	FVector2D                               CurrentViewportSize;
 	UCanvas*                                CurrentCanvas;
 
+	// Designators
+	TArray<FFlareHUDDesignator>             Designators;
+	TSet<UFlareSimulatedSpacecraft*>        ObjectiveSpacecrafts;
+	uint64                                  ObjectiveSpacecraftsFrame;
+
+	// Projection
+	bool                                    ProjectionValid;
+	FMatrix                                 ProjectionMatrix;
+	FIntRect                                ProjectionRect;
+	FVector                                 ProjectionLocation;
+	FRotator                                ProjectionRotation;
+	float                                   ProjectionFOV;
+	FIntPoint                               ProjectionViewportSize;
+
+	// Text cache
+	FFlareHUDCachedText                     VelocityText;
+	FFlareHUDCachedText                     TargetDistanceText;
+	FFlareHUDCachedText                     TargetTimeText;
+	FFlareHUDCachedText                     TargetNameText;
+	TArray<FFlareHUDCachedText>             ObjectiveDistanceTexts;
+
 	// Hit target
 	AFlareSpacecraft*                       PlayerHitSpacecraft;
 	EFlareDamage::Type                      PlayerDamageType;
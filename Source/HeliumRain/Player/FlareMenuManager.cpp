@@ -181,6 +181,17 @@ void AFlareMenuManager::Tick(float DeltaSeconds)
 			Fader->SetVisibility(EVisibility::Hidden);
 		}
 	}
+
+	// Send the world changes of this frame to the open menu
+	AFlareGame* Game = (GetPC() ? GetGame() : NULL);
+	if (Game)
+	{
+		int32 Events = Game->GetWorldEvents().Consume();
+		if (Events != EFlareWorldEvent::None && MenuIsOpen && CurrentMenu.Key != EFlareMenu::MENU_None)
+		{
+			WorldChanged.Broadcast(Events);
+		}
+	}
 }
 
 
@@ -335,6 +346,12 @@ void AFlareMenuManager::Reload()
 {
 	if (MenuIsOpen)
 	{
+		if (IsMenuUpdatedByEvents(CurrentMenu.Key))
+		{
+			FLOGV("AFlareMenuManager::Reload : '%s' updates itself", *GetMenuName(CurrentMenu.Key).ToString());
+			return;
+		}
+
 		FLOGV("AFlareMenuManager::Reload : reloading to '%s'", *GetMenuName(CurrentMenu.Key).ToString());
 		OpenMenu(CurrentMenu.Key, CurrentMenu.Value, false, true);
 	}
@@ -352,7 +369,8 @@ void AFlareMenuManager::Notify(FText Text, FText Info, FName Tag, EFlareNotifica
 {
 	if (MainOverlay.IsValid())
 	{
-		if (!UFlareGameTools::FastFastForward)
+		// Batched notifications stop fast forward when the batch ends
+		if (!UFlareGameTools::FastFastForward && !Notifier->IsBatching())
 		{
 			OrbitMenu->RequestStopFastForward();
 		}
@@ -360,6 +378,33 @@ void AFlareMenuManager::Notify(FText Text, FText Info, FName Tag, EFlareNotifica
 	}
 }
 
+void AFlareMenuManager::BeginNotificationBatch()
+{
+	if (Notifier.IsValid())
+	{
+		Notifier->BeginBatch();
+	}
+}
+
+void AFlareMenuManager::EndNotificationBatch()
+{
+	EFlareNotification::Type MainType;
+
+	if (Notifier.IsValid() && Notifier->EndBatch(MainType))
+	{
+		if (!UFlareGameTools::FastFastForward)
+		{
+			OrbitMenu->RequestStopFastForward();
+		}
+		GetPC()->PlayNotificationSound(MainType);
+	}
+}
+
+bool AFlareMenuManager::IsNotificationBatchActive() const
+{
+	return (Notifier.IsValid() && Notifier->IsBatching());
+}
+
 void AFlareMenuManager::ClearNotifications(FName Tag)
 {
 	if (MainOverlay.IsValid())
@@ -1090,6 +1135,22 @@ FString AFlareMenuManager::GetKeyNameFromActionName(FName ActionName)
 	return LOCTEXT("NoKey", "No Key").ToString();
 }
 
+bool AFlareMenuManager::IsMenuUpdatedByEvents(EFlareMenu::Type MenuType)
+{
+	switch (MenuType)
+	{
+		case EFlareMenu::MENU_Orbit:
+		case EFlareMenu::MENU_Company:
+		case EFlareMenu::MENU_Sector:
+		case EFlareMenu::MENU_Fleet:
+		case EFlareMenu::MENU_WorldEconomy:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
 bool AFlareMenuManager::IsUIOpen() const
 {
 	return IsMenuOpen() || IsOverlayOpen() || Confirmation->IsOpen();
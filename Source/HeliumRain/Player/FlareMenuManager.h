@@ -5,6 +5,7 @@
 #include "../UI/Components/FlareMainOverlay.h"
 #include "../UI/Components/FlareSpacecraftOrderOverlay.h"
 #include "../UI/Components/FlareConfirmationOverlay.h"
+#include "../Game/FlareWorldEvents.h"
 #include "FlareMenuManager.generated.h"
 
 
@@ -90,9 +91,15 @@ public:
 	/** Return to the previous menu */
 	void Back();
 
-	/** Reload the current menu with the same parameters */
+	/** Reload the current menu with the same parameters, unless it updates itself from world events */
 	void Reload();
 
+	/** Event sent once per frame to the open menu, with the EFlareWorldEvent flags of what changed */
+	FFlareWorldChangedEvent& OnWorldChanged()
+	{
+		return WorldChanged;
+	}
+
 	/** Show a notification to the user */
 	void Notify(FText Text, FText Info, FName Tag, EFlareNotification::Type Type, bool Pinned = false, EFlareMenu::Type TargetMenu = EFlareMenu::MENU_None, FFlareMenuParameterData TargetInfo = FFlareMenuParameterData());
 
@@ -102,6 +109,15 @@ public:
 	/** Remove all notifications from the screen */
 	void FlushNotifications();
 
+	/** Queue notifications until the batch ends, merging similar ones */
+	void BeginNotificationBatch();
+
+	/** Show the most important notifications of the batch */
+	void EndNotificationBatch();
+
+	/** Check if notifications are being queued */
+	bool IsNotificationBatchActive() const;
+
 	/** Show the confirmation overlay */
 	void Confirm(FText Title, FText Text, FSimpleDelegate OnConfirmed);
 
@@ -241,6 +257,9 @@ public:
 	/** Get the key bound to this action */
 	static FString GetKeyNameFromActionName(FName ActionName);
 
+	/** Does this menu refresh itself from world events instead of being reloaded */
+	static bool IsMenuUpdatedByEvents(EFlareMenu::Type MenuType);
+
 	/** Is UI visible */
 	UFUNCTION(BlueprintCallable, Category = "Flare")
 	bool IsUIOpen() const;
@@ -355,6 +374,7 @@ protected:
 	TFlareMenuData                          CurrentMenu;
 	TFlareMenuData                          NextMenu;
 	TArray<TFlareMenuData>                  MenuHistory;
+	FFlareWorldChangedEvent                 WorldChanged;
 
 	// Menu tools
 	TSharedPtr<SBorder>                     Fader;
@@ -622,7 +622,15 @@ void AFlarePlayerController::Notify(FText Title, FText Info, FName Tag, EFlareNo
 	// Notify
 	MenuManager->Notify(Title, Info, Tag, Type, Pinned, TargetMenu, TargetInfo);
 
-	// Play sound
+	// Batched notifications play a single sound when shown
+	if (!MenuManager->IsNotificationBatchActive())
+	{
+		PlayNotificationSound(Type);
+	}
+}
+
+void AFlarePlayerController::PlayNotificationSound(EFlareNotification::Type Type)
+{
 	USoundCue* NotifSound = NULL;
 	switch (Type)
 	{
@@ -933,8 +941,10 @@ void AFlarePlayerController::CheckSectorStateChanges(UFlareSimulatedSector* Sect
 		return;
 	}
 
+	GetGame()->GetWorldEvents().Notify(EFlareWorldEvent::Sectors);
+
 	// Fight in progress with player fleet
-	else if (BattleState.HasDanger && Sector == GetPlayerShip()->GetCurrentSector())
+	if (BattleState.HasDanger && Sector == GetPlayerShip()->GetCurrentSector())
 	{
 		FString NotificationIdStr;
 		NotificationIdStr += "battle-state-fight-";
@@ -1134,6 +1144,8 @@ void AFlarePlayerController::NotifyDockingComplete(AFlareSpacecraft* DockStation
 		SetExternalCamera(true);
 	}
 
+	GetGame()->GetWorldEvents().Notify(EFlareWorldEvent::Fleets);
+
 	// Reload if we were in a real menu
 	EFlareMenu::Type CurrentMenu = MenuManager->GetCurrentMenu();
 	if (CurrentMenu != EFlareMenu::MENU_None && CurrentMenu != EFlareMenu::MENU_ReloadSector && CurrentMenu != EFlareMenu::MENU_FastForwardSingle)
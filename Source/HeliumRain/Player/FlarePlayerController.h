@@ -119,6 +119,9 @@ public:
 	/** Show a notification to the user */
 	void Notify(FText Text, FText Info, FName Tag, EFlareNotification::Type Type = EFlareNotification::NT_Info, bool Pinned = false, EFlareMenu::Type TargetMenu = EFlareMenu::MENU_None, FFlareMenuParameterData TargetInfo = FFlareMenuParameterData());
 
+	/** Play the sound of a notification type */
+	void PlayNotificationSound(EFlareNotification::Type Type);
+
 	/** Setup the cockpit */
 	void SetupCockpit();
 
@@ -771,7 +771,7 @@ UFlareQuestGenerated* UFlareQuestGeneratedResourceSale::Create(UFlareQuestGenera
 
 		// Check if have too much stock there is another distant station
 
-		for (FFlareCargo& Slot : CandidateStation->GetCargoBay()->GetSlots())
+		for (const FFlareCargo& Slot : CandidateStation->GetCargoBay()->GetSlots())
 		{
 			if (Slot.Lock != EFlareResourceLock::Output)
 			{
@@ -818,7 +818,7 @@ UFlareQuestGenerated* UFlareQuestGeneratedResourceSale::Create(UFlareQuestGenera
 	int32 BestResourceQuantity = 0;
 	FFlareResourceDescription* BestResource = NULL;
 
-	for (FFlareCargo& Slot : Station->GetCargoBay()->GetSlots())
+	for (const FFlareCargo& Slot : Station->GetCargoBay()->GetSlots())
 	{
 		if (Slot.Lock != EFlareResourceLock::Output)
 		{
@@ -950,7 +950,7 @@ UFlareQuestGenerated* UFlareQuestGeneratedResourcePurchase::Create(UFlareQuestGe
 
 		// Check if have too low stock there is another distant station
 
-		for (FFlareCargo& Slot : CandidateStation->GetCargoBay()->GetSlots())
+		for (const FFlareCargo& Slot : CandidateStation->GetCargoBay()->GetSlots())
 		{
 			if (Slot.Lock != EFlareResourceLock::Input)
 			{
@@ -997,7 +997,7 @@ UFlareQuestGenerated* UFlareQuestGeneratedResourcePurchase::Create(UFlareQuestGe
 	int32 BestResourceQuantity = 0;
 	FFlareResourceDescription* BestResource = NULL;
 
-	for (FFlareCargo& Slot : Station->GetCargoBay()->GetSlots())
+	for (const FFlareCargo& Slot : Station->GetCargoBay()->GetSlots())
 	{
 		if (Slot.Lock != EFlareResourceLock::Input)
 		{
@@ -1134,7 +1134,7 @@ UFlareQuestGenerated* UFlareQuestGeneratedResourceTrade::Create(UFlareQuestGener
 
 		// Check if have too much stock there is another distant station
 
-		for (FFlareCargo& Slot : CandidateStation->GetCargoBay()->GetSlots())
+		for (const FFlareCargo& Slot : CandidateStation->GetCargoBay()->GetSlots())
 		{
 			if (Slot.Lock != EFlareResourceLock::Output)
 			{
@@ -1182,7 +1182,7 @@ UFlareQuestGenerated* UFlareQuestGeneratedResourceTrade::Create(UFlareQuestGener
 				continue;
 			}
 
-			for (FFlareCargo& Slot : CandidateStation->GetCargoBay()->GetSlots())
+			for (const FFlareCargo& Slot : CandidateStation->GetCargoBay()->GetSlots())
 			{
 				if (Slot.Lock != EFlareResourceLock::Input)
 				{
@@ -0,0 +1,139 @@
+
+#include "../Flare.h"
+#include "FlareCombatSnapshot.h"
+#include "FlareSpacecraft.h"
+#include "FlareShipPilot.h"
+#include "FlareBomb.h"
+#include "../Game/FlareGame.h"
+#include "../Game/FlareWorld.h"
+#include "../Game/FlareCompany.h"
+#include "../Game/FlareSector.h"
+
+DECLARE_CYCLE_STAT(TEXT("FlareCombatSnapshot Update"), STAT_FlareCombatSnapshot_Update, STATGROUP_Flare);
+
+
+// Companies that fit in a hostility mask
+#define COMBAT_SNAPSHOT_MAX_MASKED_COMPANIES 64
+
+
+/*----------------------------------------------------
+	Public API
+----------------------------------------------------*/
+
+FFlareCombatSnapshot::FFlareCombatSnapshot()
+	: Frame(0)
+{
+}
+
+void FFlareCombatSnapshot::Update(UFlareSector* Sector)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlareCombatSnapshot_Update);
+
+	Frame = GFrameCounter;
+	Entries.Reset();
+	EntryIndices.Reset();
+
+	// Build the hostility table
+	Companies = Sector->GetGame()->GetGameWorld()->GetCompanies();
+	HostileMasks.SetNumZeroed(Companies.Num());
+
+	for (int32 CompanyIndex = 0; CompanyIndex < Companies.Num(); CompanyIndex++)
+	{
+		uint64 Mask = 0;
+		for (int32 OtherIndex = 0; OtherIndex < Companies.Num() && OtherIndex < COMBAT_SNAPSHOT_MAX_MASKED_COMPANIES; OtherIndex++)
+		{
+			if (Companies[CompanyIndex]->GetWarState(Companies[OtherIndex]) == EFlareHostility::Hostile)
+			{
+				Mask |= (uint64(1) << OtherIndex);
+			}
+		}
+		HostileMasks[CompanyIndex] = Mask;
+	}
+
+	// Build the spacecraft entries
+	float SectorLimits = Sector->GetSectorLimits();
+	Entries.Reserve(Sector->GetSpacecrafts().Num());
+
+	for (AFlareSpacecraft* Spacecraft : Sector->GetSpacecrafts())
+	{
+		UFlareSimulatedSpacecraft* Parent = Spacecraft->GetParent();
+		UFlareSimulatedSpacecraftDamageSystem* DamageSystem = Parent->GetDamageSystem();
+
+		FFlareCombatSnapshotEntry Entry;
+		Entry.Spacecraft = Spacecraft;
+		Entry.PilotTarget = (Spacecraft->GetPilot() ? Spacecraft->GetPilot()->GetTargetShip() : NULL);
+		Entry.Location = Spacecraft->GetActorLocation();
+		Entry.Velocity = Spacecraft->GetLinearVelocity();
+		Entry.Radius = Spacecraft->GetMeshScale();
+		Entry.CompanyIndex = Companies.Find(Parent->GetCompany());
+		Entry.IncomingBombCount = 0;
+		Entry.Flags = 0;
+
+		bool Military = Parent->IsMilitary();
+		bool Disarmed = DamageSystem->IsDisarmed();
+
+		Entry.Flags |= (DamageSystem->IsAlive() ? EFlareCombatSnapshotFlags::Alive : 0);
+		Entry.Flags |= (Parent->GetSize() == EFlarePartSize::L ? EFlareCombatSnapshotFlags::Large : 0);
+		Entry.Flags |= (Parent->IsStation() ? EFlareCombatSnapshotFlags::Station : 0);
+		Entry.Flags |= (Military ? EFlareCombatSnapshotFlags::Military : 0);
+		Entry.Flags |= (Military && !Disarmed ? EFlareCombatSnapshotFlags::Dangerous : 0);
+		Entry.Flags |= (DamageSystem->GetSubsystemHealth(EFlareSubsystem::SYS_Weapon) > 0 ? EFlareCombatSnapshotFlags::WeaponsOperational : 0);
+		Entry.Flags |= (DamageSystem->IsStranded() ? EFlareCombatSnapshotFlags::Stranded : 0);
+		Entry.Flags |= (DamageSystem->IsUncontrollable() ? EFlareCombatSnapshotFlags::Uncontrollable : 0);
+		Entry.Flags |= (Disarmed ? EFlareCombatSnapshotFlags::Disarmed : 0);
+		Entry.Flags |= (Parent->IsHarpooned() ? EFlareCombatSnapshotFlags::Harpooned : 0);
+		Entry.Flags |= (Entry.Location.Size() > SectorLimits ? EFlareCombatSnapshotFlags::OutOfLimits : 0);
+
+		EntryIndices.Add(Spacecraft, Entries.Add(Entry));
+	}
+
+	// Count incoming bombs
+	for (AFlareBomb* Bomb : Sector->GetBombs())
+	{
+		if (Bomb->IsActive() && Bomb->GetTargetSpacecraft())
+		{
+			int32* EntryIndex = EntryIndices.Find(Bomb->GetTargetSpacecraft());
+			if (EntryIndex)
+			{
+				Entries[*EntryIndex].IncomingBombCount++;
+			}
+		}
+	}
+}
+
+void FFlareCombatSnapshot::Clear()
+{
+	Entries.Empty();
+	EntryIndices.Empty();
+	Companies.Empty();
+	HostileMasks.Empty();
+	Frame = 0;
+}
+
+const FFlareCombatSnapshotEntry* FFlareCombatSnapshot::Find(AFlareSpacecraft* Spacecraft) const
+{
+	const int32* EntryIndex = EntryIndices.Find(Spacecraft);
+	return (EntryIndex ? &Entries[*EntryIndex] : NULL);
+}
+
+int32 FFlareCombatSnapshot::GetCompanyIndex(UFlareCompany* Company) const
+{
+	return Companies.Find(Company);
+}
+
+bool FFlareCombatSnapshot::IsHostile(int32 CompanyIndex, const FFlareCombatSnapshotEntry& Entry) const
+{
+	if (CompanyIndex == INDEX_NONE || Entry.CompanyIndex == INDEX_NONE)
+	{
+		return false;
+	}
+	else if (Entry.CompanyIndex < COMBAT_SNAPSHOT_MAX_MASKED_COMPANIES)
+	{
+		return (HostileMasks[CompanyIndex] & (uint64(1) << Entry.CompanyIndex)) != 0;
+	}
+	else
+	{
+		// Too many companies for the mask
+		return Companies[CompanyIndex]->GetWarState(Companies[Entry.CompanyIndex]) == EFlareHostility::Hostile;
+	}
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Engine.h"
+
+
+class UFlareSector;
+class UFlareCompany;
+class AFlareSpacecraft;
+
+
+/** Spacecraft state flags */
+namespace EFlareCombatSnapshotFlags
+{
+	enum Type
+	{
+		Alive =              1 << 0,
+		Large =              1 << 1,
+		Station =            1 << 2,
+		Military =           1 << 3,
+		Dangerous =          1 << 4,
+		WeaponsOperational = 1 << 5,
+		Stranded =           1 << 6,
+		Uncontrollable =     1 << 7,
+		Disarmed =           1 << 8,
+		Harpooned =          1 << 9,
+		OutOfLimits =        1 << 10
+	};
+}
+
+
+/** Compact state of a spacecraft, as seen by target selection */
+struct FFlareCombatSnapshotEntry
+{
+	AFlareSpacecraft*    Spacecraft;
+
+	/** Target of the spacecraft's pilot, if any */
+	AFlareSpacecraft*    PilotTarget;
+
+	FVector              Location;
+	FVector              Velocity;
+	float                Radius;
+
+	/** Index of the owner in the world company list */
+	int32                CompanyIndex;
+
+	/** Active bombs currently homing on this spacecraft */
+	int32                IncomingBombCount;
+
+	/** Combination of EFlareCombatSnapshotFlags */
+	uint32               Flags;
+
+	inline bool HasFlag(EFlareCombatSnapshotFlags::Type Flag) const
+	{
+		return (Flags & Flag) != 0;
+	}
+};
+
+
+/** State of every spacecraft in the active sector, built once per frame so that pilots and turrets can score targets without chasing actors */
+class HELIUMRAIN_API FFlareCombatSnapshot
+{
+public:
+
+	FFlareCombatSnapshot();
+
+	/*----------------------------------------------------
+		Public API
+	----------------------------------------------------*/
+
+	/** Rebuild the snapshot from the sector's spacecrafts */
+	void Update(UFlareSector* Sector);
+
+	/** Forget everything */
+	void Clear();
+
+	/** Get the entry of a spacecraft, or NULL if it was spawned after the snapshot */
+	const FFlareCombatSnapshotEntry* Find(AFlareSpacecraft* Spacecraft) const;
+
+	/** Get the index of a company in the snapshot, or INDEX_NONE */
+	int32 GetCompanyIndex(UFlareCompany* Company) const;
+
+	/** Check if the owner of an entry is at war with a company */
+	bool IsHostile(int32 CompanyIndex, const FFlareCombatSnapshotEntry& Entry) const;
+
+
+	/*----------------------------------------------------
+		Getters
+	----------------------------------------------------*/
+
+	inline const TArray<FFlareCombatSnapshotEntry>& GetEntries() const
+	{
+		return Entries;
+	}
+
+	inline uint64 GetFrame() const
+	{
+		return Frame;
+	}
+
+
+protected:
+
+	/*----------------------------------------------------
+		Data
+	----------------------------------------------------*/
+
+	TArray<FFlareCombatSnapshotEntry>               Entries;
+	TMap<AFlareSpacecraft*, int32>                  EntryIndices;
+
+	/** Companies, and for each one the set of hostile company indices */
+	TArray<UFlareCompany*>                          Companies;
+	TArray<uint64>                                  HostileMasks;
+
+	uint64                                          Frame;
+
+};
@@ -2,7 +2,7 @@
 #include "../Game/FlareCompany.h"
 #include "../Game/FlareSector.h"
 #include "../Game/FlareGame.h"
-#include "../Game/FlareCollider.h"
+#include "../Game/FlareCollisionBroadphase.h"
 #include "FlareRCS.h"
 #include "FlareOrbitalEngine.h"
 #include "FlareWeapon.h"
@@ -81,55 +81,21 @@ bool PilotHelper::FindMostDangerousCollision(AFlareSpacecraft* Ship, AFlareSpace
 {
 	SCOPE_CYCLE_COUNTER(STAT_PilotHelper_AnticollisionCorrection);
 
-	typedef TPair<AActor*, FVector> TFlareCollisionCandidate;
-
 	UFlareSector* ActiveSector = Ship->GetGame()->GetActiveSector();
-	TArray<TFlareCollisionCandidate> Candidates;
-	TFlareCollisionCandidate Candidate;
-
-	// Select dangerous ships
-	for (auto SpacecraftCandidate : ActiveSector->GetSpacecrafts())
-	{
-		if (SpacecraftCandidate != Ship
-		 && SpacecraftCandidate != SpacecraftToIgnore
-		 && !Ship->GetDockingSystem()->IsGrantedShip(SpacecraftCandidate)
-		 && !Ship->GetDockingSystem()->IsDockedShip(SpacecraftCandidate))
-		{
-			Candidate.Key = SpacecraftCandidate;
-			Candidate.Value = SpacecraftCandidate->Airframe->GetPhysicsLinearVelocity();
-			Candidates.Add(Candidate);
-		}
-	}
+	const FFlareCollisionBroadphase& Broadphase = ActiveSector->GetCollisionBroadphase();
 
-	// Select dangerous asteroids
-	for (auto AsteroidCandidate : ActiveSector->GetAsteroids())
-	{
-		Candidate.Key = AsteroidCandidate;
-		Candidate.Value = AsteroidCandidate->GetAsteroidComponent()->GetPhysicsLinearVelocity();
-		Candidates.Add(Candidate);
-	}
-
-	// Select dangerous colliders
-	TArray<AActor*> ColliderActorList;
-	UGameplayStatics::GetAllActorsOfClass(Ship->GetWorld(), AFlareCollider::StaticClass(), ColliderActorList);
-	for (auto ColliderCandidate : ColliderActorList)
-	{
-		Candidate.Key = Cast<AFlareCollider>(ColliderCandidate);
-		Candidate.Value = FVector::ZeroVector;
-		Candidates.Add(Candidate);
-	}
-
-	// No candidate found, return
-	if (Candidates.Num() == 0)
+	// Only obstacles whose predicted trajectory crosses ours are candidates
+	int32 ShipIndex = Broadphase.FindBody(Ship);
+	if (ShipIndex == INDEX_NONE || Broadphase.GetCandidateCount(ShipIndex) == 0)
 	{
 		return false;
 	}
 
 	// Input data for danger processing
-	FBox ShipBox = Ship->GetComponentsBoundingBox();
-	FVector CurrentVelocity = Ship->GetLinearVelocity() * 100;
-	FVector CurrentLocation = (ShipBox.Max + ShipBox.Min) / 2.0;
-	float CurrentSize = FMath::Max(ShipBox.GetExtent().Size(), 1.0f);
+	const FFlareCollisionBody& ShipBody = Broadphase.GetBodies()[ShipIndex];
+	FVector CurrentVelocity = ShipBody.Velocity;
+	FVector CurrentLocation = ShipBody.Center;
+	float CurrentSize = ShipBody.Size;
 	float MaxRelevanceDistance = 200 * CurrentSize;
 
 	// Output data
@@ -138,11 +104,21 @@ bool PilotHelper::FindMostDangerousCollision(AFlareSpacecraft* Ship, AFlareSpace
 	*MostDangerousInterCollisionTravelTime = 0;
 
 	// Process all candidates
-	for (auto SelectedCandidate : Candidates)
+	for (int32 CandidateIndex = 0; CandidateIndex < Broadphase.GetCandidateCount(ShipIndex); CandidateIndex++)
 	{
-		if ((SelectedCandidate.Key->GetActorLocation() - CurrentLocation).Size() < MaxRelevanceDistance)
+		const FFlareCollisionBody& Candidate = Broadphase.GetCandidate(ShipIndex, CandidateIndex);
+
+		if (Candidate.Spacecraft
+		 && (Candidate.Spacecraft == SpacecraftToIgnore
+		  || Ship->GetDockingSystem()->IsGrantedShip(Candidate.Spacecraft)
+		  || Ship->GetDockingSystem()->IsDockedShip(Candidate.Spacecraft)))
 		{
-			CheckRelativeDangerosity(SelectedCandidate.Key, CurrentLocation, CurrentSize, SelectedCandidate.Value, CurrentVelocity,
+			continue;
+		}
+
+		if ((Candidate.ActorLocation - CurrentLocation).Size() < MaxRelevanceDistance)
+		{
+			CheckRelativeDangerosity(Candidate, CurrentLocation, CurrentSize, CurrentVelocity,
 				MostDangerousCandidateActor, MostDangerousLocation, MostDangerousHitTime, MostDangerousInterCollisionTravelTime);
 		}
 	}
@@ -287,40 +263,46 @@ bool PilotHelper::IsSectorExitImminent(AFlareSpacecraft* Ship, float PreventionD
 
 AFlareSpacecraft* PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, struct TargetPreferences Preferences)
 {
-	SCOPE_CYCLE_COUNTER(STAT_PilotHelper_GetBestTarget);
-
 	if (!Ship || !Ship->GetGame()->GetActiveSector())
 	{
 		return NULL;
 	}
 
+	//FLOGV("GetBestTarget for %s", *Ship->GetImmatriculation().ToString());
+
+	const FFlareCombatSnapshot& Snapshot = Ship->GetGame()->GetActiveSector()->GetCombatSnapshot();
+	return GetBestTarget(Snapshot, Snapshot.GetCompanyIndex(Ship->GetParent()->GetCompany()), Preferences);
+}
+
+AFlareSpacecraft* PilotHelper::GetBestTarget(const FFlareCombatSnapshot& Snapshot, int32 CompanyIndex, const struct TargetPreferences& Preferences)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PilotHelper_GetBestTarget);
+
 	AFlareSpacecraft* BestTarget = NULL;
 	float BestScore = 0;
 
-	//FLOGV("GetBestTarget for %s", *Ship->GetImmatriculation().ToString());
-
-	for (int32 SpacecraftIndex = 0; SpacecraftIndex < Ship->GetGame()->GetActiveSector()->GetSpacecrafts().Num(); SpacecraftIndex++)
+	for (const FFlareCombatSnapshotEntry& Candidate : Snapshot.GetEntries())
 	{
-		AFlareSpacecraft* ShipCandidate = Ship->GetGame()->GetActiveSector()->GetSpacecrafts()[SpacecraftIndex];
+		AFlareSpacecraft* ShipCandidate = Candidate.Spacecraft;
 
 		if (Preferences.IgnoreList.Contains(ShipCandidate))
 		{
 			continue;
 		}
 
-		if (Ship->GetParent()->GetCompany()->GetWarState(ShipCandidate->GetCompany()) != EFlareHostility::Hostile)
+		if (!Snapshot.IsHostile(CompanyIndex, Candidate))
 		{
 			// Ignore not hostile ships
 			continue;
 		}
 
-		if (!ShipCandidate->GetParent()->GetDamageSystem()->IsAlive())
+		if (!Candidate.HasFlag(EFlareCombatSnapshotFlags::Alive))
 		{
 			// Ignore destroyed ships
 			continue;
 		}
 
-		if (ShipCandidate->GetActorLocation().Size() > ShipCandidate->GetGame()->GetActiveSector()->GetSectorLimits())
+		if (Candidate.HasFlag(EFlareCombatSnapshotFlags::OutOfLimits))
 		{
 			// Ignore out limit ships
 			continue;
@@ -334,17 +316,16 @@ AFlareSpacecraft* PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, struct Targ
 
 		StateScore = Preferences.TargetStateWeight;
 
-		if (ShipCandidate->GetParent()->GetSize() == EFlarePartSize::L)
+		if (Candidate.HasFlag(EFlareCombatSnapshotFlags::Large))
 		{
 			StateScore *= Preferences.IsLarge;
 		}
-
-		if (ShipCandidate->GetParent()->GetSize() == EFlarePartSize::S)
+		else
 		{
 			StateScore *= Preferences.IsSmall;
 		}
 
-		if (ShipCandidate->GetParent()->IsStation())
+		if (Candidate.HasFlag(EFlareCombatSnapshotFlags::Station))
 		{
 			StateScore *= Preferences.IsStation;
 		}
@@ -353,7 +334,7 @@ AFlareSpacecraft* PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, struct Targ
 			StateScore *= Preferences.IsNotStation;
 		}
 
-		if (ShipCandidate->GetParent()->IsMilitary())
+		if (Candidate.HasFlag(EFlareCombatSnapshotFlags::Military))
 		{
 			StateScore *= Preferences.IsMilitary;
 		}
@@ -362,7 +343,7 @@ AFlareSpacecraft* PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, struct Targ
 			StateScore *= Preferences.IsNotMilitary;
 		}
 
-		if (IsShipDangerous(ShipCandidate))
+		if (Candidate.HasFlag(EFlareCombatSnapshotFlags::Dangerous))
 		{
 			StateScore *= Preferences.IsDangerous;
 		}
@@ -371,7 +352,7 @@ AFlareSpacecraft* PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, struct Targ
 			StateScore *= Preferences.IsNotDangerous;
 		}
 
-		if (ShipCandidate->GetParent()->GetDamageSystem()->IsStranded())
+		if (Candidate.HasFlag(EFlareCombatSnapshotFlags::Stranded))
 		{
 			StateScore *= Preferences.IsStranded;
 		}
@@ -380,11 +361,11 @@ AFlareSpacecraft* PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, struct Targ
 			StateScore *= Preferences.IsNotStranded;
 		}
 
-		if (ShipCandidate->GetParent()->GetDamageSystem()->IsUncontrollable() && ShipCandidate->GetParent()->GetDamageSystem()->IsDisarmed())
+		if (Candidate.HasFlag(EFlareCombatSnapshotFlags::Uncontrollable) && Candidate.HasFlag(EFlareCombatSnapshotFlags::Disarmed))
 		{
-			if (ShipCandidate->IsMilitary())
+			if (Candidate.HasFlag(EFlareCombatSnapshotFlags::Military))
 			{
-				if (ShipCandidate->GetSize() == EFlarePartSize::S)
+				if (!Candidate.HasFlag(EFlareCombatSnapshotFlags::Large))
 				{
 					StateScore *= Preferences.IsUncontrollableSmallMilitary;
 				}
@@ -403,18 +384,14 @@ AFlareSpacecraft* PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, struct Targ
 			StateScore *= Preferences.IsNotUncontrollable;
 		}
 
-		int BombCount = 0;
 		// Divise by 25 the stateScore per current incoming missile
-		for (AFlareBomb* Bomb : Ship->GetGame()->GetActiveSector()->GetBombs())
+		int BombCount = Candidate.IncomingBombCount;
+		for (int BombIndex = 0; BombIndex < BombCount; BombIndex++)
 		{
-			if (Bomb->GetTargetSpacecraft() == ShipCandidate && Bomb->IsActive())
-			{
-				BombCount++;
-				StateScore /= 25;
-			}
+			StateScore /= 25;
 		}
 
-		if (IsShipDangerous(ShipCandidate))
+		if (Candidate.HasFlag(EFlareCombatSnapshotFlags::Dangerous))
 		{
 			if(BombCount > 1)
 			{
@@ -430,8 +407,8 @@ AFlareSpacecraft* PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, struct Targ
 		}
 
 
-		if(ShipCandidate->GetParent()->IsHarpooned()) {
-			if(ShipCandidate->GetParent()->GetDamageSystem()->IsUncontrollable())
+		if(Candidate.HasFlag(EFlareCombatSnapshotFlags::Harpooned)) {
+			if(Candidate.HasFlag(EFlareCombatSnapshotFlags::Uncontrollable))
 			{
 				// Never target harponned uncontrollable ships
 				continue;
@@ -444,7 +421,7 @@ AFlareSpacecraft* PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, struct Targ
 			StateScore *=  Preferences.LastTargetWeight;
 		}
 
-		float Distance = (Preferences.BaseLocation - ShipCandidate->GetActorLocation()).Size();
+		float Distance = (Preferences.BaseLocation - Candidate.Location).Size();
 		if (Distance >= Preferences.MaxDistance)
 		{
 			DistanceScore = 0.f;
@@ -454,7 +431,7 @@ AFlareSpacecraft* PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, struct Targ
 			DistanceScore = Preferences.DistanceWeight * (1.f - (Distance / Preferences.MaxDistance));
 		}
 
-		if (Preferences.AttackTarget && IsShipDangerous(ShipCandidate) && ShipCandidate->GetPilot()->GetTargetShip() == Preferences.AttackTarget)
+		if (Preferences.AttackTarget && Candidate.HasFlag(EFlareCombatSnapshotFlags::Dangerous) && Candidate.PilotTarget == Preferences.AttackTarget)
 		{
 			AttackTargetScore = Preferences.AttackTargetWeight;
 		}
@@ -463,7 +440,7 @@ AFlareSpacecraft* PilotHelper::GetBestTarget(AFlareSpacecraft* Ship, struct Targ
 			AttackTargetScore = 0.0f;
 		}
 
-		FVector Direction = (ShipCandidate->GetActorLocation() - Preferences.BaseLocation).GetUnsafeNormal();
+		FVector Direction = (Candidate.Location - Preferences.BaseLocation).GetUnsafeNormal();
 
 
 		float Alignement = FVector::DotProduct(Preferences.PreferredDirection, Direction);
@@ -517,10 +494,10 @@ UFlareSpacecraftComponent* PilotHelper::GetBestTargetComponent(AFlareSpacecraft*
 	// Else if not stranger target the orbital
 	// else target the rsc
 
-	float WeaponWeight = 1;
-	float PodWeight = 1;
-	float RCSWeight = 1;
-	float InternalWeight = 1;
+	int32 WeaponWeight = 1;
+	int32 PodWeight = 1;
+	int32 RCSWeight = 1;
+	int32 InternalWeight = 1;
 
 	if (!TargetSpacecraft->GetParent()->GetDamageSystem()->IsDisarmed())
 	{
@@ -541,69 +518,72 @@ UFlareSpacecraftComponent* PilotHelper::GetBestTargetComponent(AFlareSpacecraft*
 		InternalWeight = 1;
 	}
 
-	TArray<UFlareSpacecraftComponent*> ComponentSelection;
+	// Pick a component with a probability proportional to its weight
+	TArray<UFlareSpacecraftComponent*, TInlineAllocator<64>> Components;
+	TargetSpacecraft->GetComponents(Components);
 
-	TArray<UActorComponent*> Components = TargetSpacecraft->GetComponentsByClass(UFlareSpacecraftComponent::StaticClass());
+	int32 TotalWeight = 0;
 	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
 	{
-		UFlareSpacecraftComponent* Component = Cast<UFlareSpacecraftComponent>(Components[ComponentIndex]);
+		TotalWeight += GetTargetComponentWeight(Components[ComponentIndex], WeaponWeight, PodWeight, RCSWeight, InternalWeight);
+	}
 
-		if (Component->GetDescription() && !Component->IsBroken() )
+	if (TotalWeight == 0)
+	{
+		return NULL;
+	}
+
+	int32 SelectedWeight = FMath::RandRange(0, TotalWeight - 1);
+	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+	{
+		SelectedWeight -= GetTargetComponentWeight(Components[ComponentIndex], WeaponWeight, PodWeight, RCSWeight, InternalWeight);
+		if (SelectedWeight < 0)
 		{
+			return Components[ComponentIndex];
+		}
+	}
 
-			UFlareRCS* RCS = Cast<UFlareRCS>(Component);
-			if (RCS)
-			{
-				for (int32 i = 0; i < RCSWeight; i++)
-				{
-					ComponentSelection.Add(Component);
-				}
-			}
+	return NULL;
+}
 
-			UFlareOrbitalEngine* OrbitalEngine = Cast<UFlareOrbitalEngine>(Component);
-			if (OrbitalEngine)
-			{
-				for (int32 i = 0; i < PodWeight; i++)
-				{
-					ComponentSelection.Add(Component);
-				}
-			}
+int32 PilotHelper::GetTargetComponentWeight(UFlareSpacecraftComponent* Component, int32 WeaponWeight, int32 PodWeight, int32 RCSWeight, int32 InternalWeight)
+{
+	int32 Weight = 0;
 
-			UFlareWeapon* Weapon = Cast<UFlareWeapon>(Component);
-			if (Weapon)
-			{
-				for (int32 i = 0; i < WeaponWeight; i++)
-				{
-					ComponentSelection.Add(Component);
-				}
-			}
+	if (Component->GetDescription() && !Component->IsBroken())
+	{
+		if (Cast<UFlareRCS>(Component))
+		{
+			Weight += RCSWeight;
+		}
 
-			if (Component->GetDescription()->Type == EFlarePartType::InternalComponent)
-			{
-				for (int32 i = 0; i < InternalWeight; i++)
-				{
-					ComponentSelection.Add(Component);
-				}
-			}
+		if (Cast<UFlareOrbitalEngine>(Component))
+		{
+			Weight += PodWeight;
 		}
-	}
 
-	if (ComponentSelection.Num() == 0)
-	{
-		return NULL;
+		if (Cast<UFlareWeapon>(Component))
+		{
+			Weight += WeaponWeight;
+		}
+
+		if (Component->GetDescription()->Type == EFlarePartType::InternalComponent)
+		{
+			Weight += InternalWeight;
+		}
 	}
 
-	int32 ComponentIndex = FMath::RandRange(0, ComponentSelection.Num() - 1);
-	return ComponentSelection[ComponentIndex];
+	return Weight;
 }
 
-bool PilotHelper::CheckRelativeDangerosity(AActor* CandidateActor, FVector CurrentLocation, float CurrentSize, FVector TargetVelocity, FVector CurrentVelocity, AActor** MostDangerousCandidateActor, FVector*MostDangerousLocation, float* MostDangerousHitTime, float* MostDangerousInterCollisionTravelTime)
+bool PilotHelper::CheckRelativeDangerosity(const FFlareCollisionBody& Candidate, FVector CurrentLocation, float CurrentSize, FVector CurrentVelocity, AActor** MostDangerousCandidateActor, FVector*MostDangerousLocation, float* MostDangerousHitTime, float* MostDangerousInterCollisionTravelTime)
 {
 	SCOPE_CYCLE_COUNTER(STAT_PilotHelper_CheckRelativeDangerosity);
-	//FLOGV("PilotHelper::CheckRelativeDangerosity for %s, ship size %f", *CandidateActor->GetName(), CurrentSize);
+	//FLOGV("PilotHelper::CheckRelativeDangerosity for %s, ship size %f", *Candidate.Actor->GetName(), CurrentSize);
 
-	FVector CandidateLocation = CandidateActor->GetActorLocation();
-	FVector DeltaVelocity = TargetVelocity - CurrentVelocity;
+	AActor* CandidateActor = Candidate.Actor;
+	FVector CandidateLocation = Candidate.ActorLocation;
+	FVector DeltaVelocity = Candidate.Velocity - CurrentVelocity;
 	FVector DeltaLocation = CandidateLocation - CurrentLocation;
 
 	// Eliminate obvious not-dangerous candidates based on velocity
@@ -613,17 +593,8 @@ bool PilotHelper::CheckRelativeDangerosity(AActor* CandidateActor, FVector Curre
 	}
 	
 	// Get the object size & location
-	float CandidateSize;
-	if (CandidateActor->IsA(AFlareCollider::StaticClass()) || CandidateActor->IsA(AFlareAsteroid::StaticClass()))
-	{
-		CandidateSize = Cast<UStaticMeshComponent>(CandidateActor->GetRootComponent())->Bounds.SphereRadius;
-	}
-	else
-	{
-		FBox CandidateBox = CandidateActor->GetComponentsBoundingBox();
-		CandidateSize = FMath::Max(CandidateBox.GetExtent().Size(), 1.0f);
-		CandidateLocation = (CandidateBox.Max + CandidateBox.Min) / 2.0;
-	}
+	float CandidateSize = Candidate.Size;
+	CandidateLocation = Candidate.Center;
 
 	// Minimum distance highter than object size sum : not dangerous
 	float MinDistance = FVector::CrossProduct(DeltaLocation, -DeltaVelocity).Size() / DeltaVelocity.Size();
@@ -652,7 +623,7 @@ bool PilotHelper::CheckRelativeDangerosity(AActor* CandidateActor, FVector Curre
 	float InterCollisionTravelTime = SizeSum / DeltaVelocity.Size();
 
 	// Time to minimum distance is high : not dangerous
-	if (TimeToMinDistance > 5.f + InterCollisionTravelTime)
+	if (TimeToMinDistance > FFlareCollisionBroadphase::GetHorizon() + InterCollisionTravelTime)
 	{
 		return false;
 	}
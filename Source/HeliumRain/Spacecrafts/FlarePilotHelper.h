@@ -6,6 +6,8 @@ class UFlareCompany;
 class UFlareSector;
 class UFlareSpacecraftComponent;
 class AFlareSpacecraft;
+class FFlareCombatSnapshot;
+struct FFlareCollisionBody;
 
 struct PilotHelper
 {
@@ -56,15 +58,21 @@ struct PilotHelper
 
 	static AFlareSpacecraft* GetBestTarget(AFlareSpacecraft* Ship, struct TargetPreferences Preferences);
 
+	/** Score the snapshot's spacecrafts for a company. Only reads the snapshot, so it may run on any thread. */
+	static AFlareSpacecraft* GetBestTarget(const FFlareCombatSnapshot& Snapshot, int32 CompanyIndex, const struct TargetPreferences& Preferences);
+
 	static UFlareSpacecraftComponent* GetBestTargetComponent(AFlareSpacecraft* TargetSpacecraft);
 
+	/** Get how likely a component is to be picked as a target */
+	static int32 GetTargetComponentWeight(UFlareSpacecraftComponent* Component, int32 WeaponWeight, int32 PodWeight, int32 RCSWeight, int32 InternalWeight);
+
 	/** Return true if the ship is dangerous */
 	static bool IsShipDangerous(AFlareSpacecraft* ShipCandidate);
 
 private:
 
 	/** Check if CandidateActor is dangerous on the player's trajectory */
-	static bool CheckRelativeDangerosity(AActor* CandidateActor, FVector CurrentLocation, float CurrentSize, FVector TargetVelocity, FVector CurrentVelocity,
+	static bool CheckRelativeDangerosity(const FFlareCollisionBody& Candidate, FVector CurrentLocation, float CurrentSize, FVector CurrentVelocity,
 		AActor** MostDangerousCandidateActor, FVector*MostDangerousLocation, float* MostDangerousHitTime, float* MostDangerousInterCollisionTravelTime);
 
 };
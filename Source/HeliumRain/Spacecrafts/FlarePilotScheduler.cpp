@@ -0,0 +1,254 @@
+
+#include "../Flare.h"
+#include "FlarePilotScheduler.h"
+#include "FlareSpacecraft.h"
+#include "FlareShipPilot.h"
+#include "FlareTurret.h"
+#include "FlareTurretPilot.h"
+#include "FlareCombatSnapshot.h"
+#include "../Game/FlareGame.h"
+#include "../Game/FlareSector.h"
+#include "../Player/FlarePlayerController.h"
+
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("FlarePilotScheduler Tick"), STAT_FlarePilotScheduler_Tick, STATGROUP_Flare);
+DECLARE_CYCLE_STAT(TEXT("FlarePilotScheduler Decision phase"), STAT_FlarePilotScheduler_DecisionPhase, STATGROUP_Flare);
+
+
+// Number of ships whose pilots may decide each frame, so that behavior doesn't depend on the machine speed
+#define PILOT_SCHEDULER_SHIPS_PER_FRAME 8
+
+// Pilots waiting longer than this get to decide over the per-frame count, in seconds
+#define PILOT_SCHEDULER_MAX_DELAY 1.0f
+
+// Hard limit of ships whose pilots may decide each frame, overdue ones included
+#define PILOT_SCHEDULER_MAX_SHIPS_PER_FRAME 32
+
+// Distance at which a ship's priority is halved, in centimeters
+#define PILOT_SCHEDULER_DISTANCE_SCALE 500000.f
+
+// Priority bonus for ships currently fighting
+#define PILOT_SCHEDULER_COMBAT_FACTOR 3.f
+
+
+/*----------------------------------------------------
+	Public API
+----------------------------------------------------*/
+
+UFlarePilotScheduler::UFlarePilotScheduler(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, Sector(NULL)
+	, FrameCounter(0)
+{
+}
+
+void UFlarePilotScheduler::Load(UFlareSector* ParentSector)
+{
+	Sector = ParentSector;
+	Schedules.Empty();
+	SortedShips.Empty();
+	Decisions.Empty();
+}
+
+void UFlarePilotScheduler::Tick(float DeltaSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlarePilotScheduler_Tick);
+
+	FrameCounter++;
+
+	// Update the schedules
+	AFlareSpacecraft* PlayerShip = Sector->GetGame()->GetPC()->GetShipPawn();
+	SortedShips.Reset();
+
+	for (AFlareSpacecraft* Ship : Sector->GetSpacecrafts())
+	{
+		FFlarePilotSchedule* Schedule = Schedules.Find(Ship);
+		if (!Schedule)
+		{
+			// New ships decide right away
+			FFlarePilotSchedule NewSchedule;
+			NewSchedule.TimeSinceLastDecision = PILOT_SCHEDULER_MAX_DELAY;
+			NewSchedule.Granted = false;
+			Schedule = &Schedules.Add(Ship, NewSchedule);
+		}
+		else if (Schedule->Granted)
+		{
+			Schedule->TimeSinceLastDecision = 0;
+		}
+		else
+		{
+			Schedule->TimeSinceLastDecision += DeltaSeconds;
+		}
+
+		Schedule->Granted = false;
+		Schedule->LastSeenFrame = FrameCounter;
+
+		if (Ship->GetParent()->GetDamageSystem()->IsAlive())
+		{
+			FFlarePilotScheduleEntry Entry;
+			Entry.Ship = Ship;
+			Entry.Priority = ComputePriority(Ship, *Schedule, PlayerShip);
+			Entry.TimeSinceLastDecision = Schedule->TimeSinceLastDecision;
+			Entry.Overdue = (Schedule->TimeSinceLastDecision >= PILOT_SCHEDULER_MAX_DELAY);
+			Entry.Granted = false;
+			SortedShips.Add(Entry);
+		}
+	}
+
+	// Forget ships that were destroyed or left the sector
+	for (auto Iterator = Schedules.CreateIterator(); Iterator; ++Iterator)
+	{
+		if (!Iterator.Key().IsValid() || Iterator.Value().LastSeenFrame != FrameCounter)
+		{
+			Iterator.RemoveCurrent();
+		}
+	}
+
+	// Overdue ships go first, oldest first, then the most urgent ones
+	SortedShips.Sort([](const FFlarePilotScheduleEntry& A, const FFlarePilotScheduleEntry& B)
+	{
+		if (A.Overdue != B.Overdue)
+		{
+			return A.Overdue;
+		}
+		else if (A.Overdue)
+		{
+			return A.TimeSinceLastDecision > B.TimeSinceLastDecision;
+		}
+		else
+		{
+			return A.Priority > B.Priority;
+		}
+	});
+
+	// Overdue ships may exceed the usual count, up to the hard limit : the others keep waiting for the next frames
+	for (int32 Index = 0; Index < SortedShips.Num() && Index < PILOT_SCHEDULER_MAX_SHIPS_PER_FRAME; Index++)
+	{
+		FFlarePilotScheduleEntry& Entry = SortedShips[Index];
+
+		if (Index < PILOT_SCHEDULER_SHIPS_PER_FRAME || Entry.Overdue)
+		{
+			Entry.Granted = true;
+			Schedules[Entry.Ship].Granted = true;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	RunDecisionPhase(DeltaSeconds);
+}
+
+bool UFlarePilotScheduler::CanDecide(AFlareSpacecraft* Ship) const
+{
+	const FFlarePilotSchedule* Schedule = Schedules.Find(Ship);
+
+	// Unknown ships were spawned this frame
+	return (Schedule ? Schedule->Granted : true);
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+void UFlarePilotScheduler::RunDecisionPhase(float DeltaSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlarePilotScheduler_DecisionPhase);
+
+	const FFlareCombatSnapshot& Snapshot = Sector->GetCombatSnapshot();
+	Decisions.Reset();
+
+	// Gather the pilots that will select a target, on the game thread
+	for (const FFlarePilotScheduleEntry& Entry : SortedShips)
+	{
+		if (!Entry.Granted)
+		{
+			continue;
+		}
+
+		AFlareSpacecraft* Ship = Entry.Ship;
+
+		int32 CompanyIndex = Snapshot.GetCompanyIndex(Ship->GetParent()->GetCompany());
+
+		UFlareShipPilot* ShipPilot = Ship->GetPilot();
+		if (ShipPilot && ShipPilot->NeedsHostileTarget())
+		{
+			FFlarePilotDecision& Decision = Decisions[Decisions.AddZeroed()];
+			Decision.ShipPilot = ShipPilot;
+			Decision.CompanyIndex = CompanyIndex;
+			ShipPilot->GetPreparedTargetPreferences(Decision.Preferences);
+		}
+
+		for (UFlareWeapon* Weapon : Ship->GetWeaponsSystem()->GetWeaponList())
+		{
+			UFlareTurret* Turret = Cast<UFlareTurret>(Weapon);
+			if (Turret && Turret->GetTurretPilot() && Turret->GetTurretPilot()->NeedsTargetSelection(DeltaSeconds))
+			{
+				FFlarePilotDecision& Decision = Decisions[Decisions.AddZeroed()];
+				Decision.TurretPilot = Turret->GetTurretPilot();
+				Decision.CompanyIndex = CompanyIndex;
+				Decision.TurretPilot->GetPreparedTargetPreferences(Decision.Preferences, Decision.SecurityRadius);
+			}
+		}
+	}
+
+	if (Decisions.Num() == 0)
+	{
+		return;
+	}
+
+	// Score targets on all cores : this only reads the snapshot and the pilots
+	ParallelFor(Decisions.Num(), [this, &Snapshot](int32 Index)
+	{
+		FFlarePilotDecision& Decision = Decisions[Index];
+
+		if (Decision.ShipPilot)
+		{
+			Decision.Target = PilotHelper::GetBestTarget(Snapshot, Decision.CompanyIndex, Decision.Preferences);
+		}
+		else
+		{
+			Decision.Target = Decision.TurretPilot->SearchTarget(Snapshot, Decision.CompanyIndex, Decision.Preferences, Decision.SecurityRadius, true);
+			if (!Decision.Target)
+			{
+				Decision.FallbackTarget = Decision.TurretPilot->SearchTarget(Snapshot, Decision.CompanyIndex, Decision.Preferences, Decision.SecurityRadius, false);
+			}
+		}
+	});
+
+	// Hand the results to the pilots, which apply them when they tick
+	for (const FFlarePilotDecision& Decision : Decisions)
+	{
+		if (Decision.ShipPilot)
+		{
+			Decision.ShipPilot->SetPreparedHostileTarget(Decision.Target);
+		}
+		else
+		{
+			Decision.TurretPilot->SetPreparedTargets(Decision.Target, Decision.FallbackTarget);
+		}
+	}
+}
+
+float UFlarePilotScheduler::ComputePriority(AFlareSpacecraft* Ship, const FFlarePilotSchedule& Schedule, AFlareSpacecraft* PlayerShip) const
+{
+	float Priority = Schedule.TimeSinceLastDecision;
+
+	// Ships near the player are watched
+	if (PlayerShip)
+	{
+		float Distance = (Ship->GetActorLocation() - PlayerShip->GetActorLocation()).Size();
+		Priority *= 1.f / (1.f + Distance / PILOT_SCHEDULER_DISTANCE_SCALE);
+	}
+
+	// Fighting ships need to react
+	if (Ship->GetCurrentTarget())
+	{
+		Priority *= PILOT_SCHEDULER_COMBAT_FACTOR;
+	}
+
+	return Priority;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Object.h"
+#include "FlarePilotHelper.h"
+#include "FlarePilotScheduler.generated.h"
+
+
+class UFlareSector;
+class AFlareSpacecraft;
+class UFlareShipPilot;
+class UFlareTurretPilot;
+
+
+/** Scheduling state of a ship's pilots */
+struct FFlarePilotSchedule
+{
+	/** Time since the pilots were last allowed to take decisions */
+	float                                     TimeSinceLastDecision;
+
+	/** The pilots may take decisions this frame */
+	bool                                      Granted;
+
+	/** Frame the ship was last seen in the sector */
+	uint64                                    LastSeenFrame;
+};
+
+/** A living ship competing for this frame's decisions */
+struct FFlarePilotScheduleEntry
+{
+	AFlareSpacecraft*                         Ship;
+
+	/** Computed each frame from distance, combat and waiting time */
+	float                                     Priority;
+
+	/** Time since the last decision, copied from the schedule */
+	float                                     TimeSinceLastDecision;
+
+	/** Waited longer than the maximum delay, served oldest first before the others */
+	bool                                      Overdue;
+
+	bool                                      Granted;
+};
+
+/** Target selection prepared for a pilot during the decision phase */
+struct FFlarePilotDecision
+{
+	/** Either a ship pilot or a turret pilot */
+	UFlareShipPilot*                          ShipPilot;
+	UFlareTurretPilot*                        TurretPilot;
+
+	int32                                     CompanyIndex;
+	PilotHelper::TargetPreferences            Preferences;
+	float                                     SecurityRadius;
+
+	/** Best target, and for turrets the best target when none is reachable */
+	AFlareSpacecraft*                         Target;
+	AFlareSpacecraft*                         FallbackTarget;
+};
+
+
+/** Spread expensive pilot decisions (target selection, threat scans) across frames, a fixed number of ships at a time */
+UCLASS()
+class HELIUMRAIN_API UFlarePilotScheduler : public UObject
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+
+	/*----------------------------------------------------
+		Public API
+	----------------------------------------------------*/
+
+	/** Setup the scheduler for a sector */
+	void Load(UFlareSector* ParentSector);
+
+	/** Grant this frame's decisions */
+	void Tick(float DeltaSeconds);
+
+	/** Check if the pilots of this ship may take expensive decisions this frame */
+	bool CanDecide(AFlareSpacecraft* Ship) const;
+
+
+protected:
+
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Compute how urgently a ship's pilots need to decide */
+	float ComputePriority(AFlareSpacecraft* Ship, const FFlarePilotSchedule& Schedule, AFlareSpacecraft* PlayerShip) const;
+
+	/** Select targets for all granted pilots in parallel, against the sector's combat snapshot */
+	void RunDecisionPhase(float DeltaSeconds);
+
+
+	/*----------------------------------------------------
+		Data
+	----------------------------------------------------*/
+
+	UFlareSector*                                       Sector;
+
+	/** Weak keys, so that destroyed ships never alias a new one */
+	TMap<TWeakObjectPtr<AFlareSpacecraft>, FFlarePilotSchedule> Schedules;
+	TArray<FFlarePilotScheduleEntry>                    SortedShips;
+	TArray<FFlarePilotDecision>                         Decisions;
+
+	uint64                                              FrameCounter;
+
+};
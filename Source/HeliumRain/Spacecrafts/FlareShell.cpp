@@ -133,11 +133,14 @@ void AFlareShell::Tick(float DeltaSeconds)
 void AFlareShell::CheckFuze(FVector ActorLocation, FVector NextActorLocation)
 {
 	FVector Center = (NextActorLocation + ActorLocation) / 2;
-	float NearThresoldSquared = FMath::Square(100000); // 1km
+	float NearThresold = 100000; // 1km
+	float NearThresoldSquared = FMath::Square(NearThresold);
 	UFlareSector* Sector = ParentWeapon->GetSpacecraft()->GetGame()->GetActiveSector();
-	for (int32 SpacecraftIndex = 0; SpacecraftIndex < Sector->GetSpacecrafts().Num(); SpacecraftIndex++)
+	Sector->GetShellBroadphase().GetSpacecraftsNear(ActorLocation, NextActorLocation, NearThresold, FuzeCandidates);
+
+	for (int32 SpacecraftIndex = 0; SpacecraftIndex < FuzeCandidates.Num(); SpacecraftIndex++)
 	{
-		AFlareSpacecraft* ShipCandidate = Sector->GetSpacecrafts()[SpacecraftIndex];
+		AFlareSpacecraft* ShipCandidate = FuzeCandidates[SpacecraftIndex];
 
 
 		if (ShipCandidate == ParentWeapon->GetSpacecraft())
@@ -565,6 +568,16 @@ float AFlareShell::ApplyDamage(AActor *ActorToDamage, UPrimitiveComponent* HitCo
 
 bool AFlareShell::Trace(const FVector& Start, const FVector& End, FHitResult& HitOut)
 {
+	// Re-initialize hit info
+	HitOut = FHitResult(ForceInit);
+
+	// Only trace the meshes when the segment crosses some bounds
+	UFlareSector* Sector = ParentWeapon->GetSpacecraft()->GetGame()->GetActiveSector();
+	if (!Sector->GetShellBroadphase().MayHit(Start, End, ParentWeapon->GetSpacecraft()))
+	{
+		return false;
+	}
+
 	// Ignore Actors
 	FCollisionQueryParams TraceParams(FName(TEXT("Shell Trace")), true, this);
 	TraceParams.bTraceComplex = true;
@@ -572,9 +585,6 @@ bool AFlareShell::Trace(const FVector& Start, const FVector& End, FHitResult& Hi
 	TraceParams.AddIgnoredActor(this);
 	TraceParams.AddIgnoredActor(ParentWeapon->GetSpacecraft());
 
-	// Re-initialize hit info
-	HitOut = FHitResult(ForceInit);
-
 	ECollisionChannel CollisionChannel = (ECollisionChannel) (ECC_WorldStatic | ECC_WorldDynamic | ECC_Pawn);
 
 	// Trace!
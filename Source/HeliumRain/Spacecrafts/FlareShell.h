@@ -90,6 +90,9 @@ protected:
 	float SecureTime;
 	float ActiveTime;
 
+	// Spacecrafts near the shell, for the proximity fuze
+	TArray<AFlareSpacecraft*> FuzeCandidates;
+
 	UFlareWeapon* ParentWeapon;
 	AFlarePlayerController* PC;
 
@@ -4,9 +4,11 @@
 #include "FlareShipPilot.h"
 #include "FlareSpacecraft.h"
 #include "FlarePilotHelper.h"
+#include "FlarePilotScheduler.h"
 
 #include "../Game/FlareCompany.h"
 #include "../Game/FlareGame.h"
+#include "../Game/FlareAllocationStats.h"
 #include "../Game/AI/FlareCompanyAI.h"
 
 #include "../Player/FlarePlayerController.h"
@@ -23,6 +25,7 @@ DECLARE_CYCLE_STAT(TEXT("FlareShipPilot Missile"), STAT_FlareShipPilot_Missile,
 DECLARE_CYCLE_STAT(TEXT("FlareShipPilot Idle"), STAT_FlareShipPilot_Idle, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlareShipPilot Flagship"), STAT_FlareShipPilot_Flagship, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlareShipPilot FindBestHostileTarget"), STAT_FlareShipPilot_FindBestHostileTarget, STATGROUP_Flare);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FlareShipPilot Tick allocations"), STAT_FlareShipPilot_TickAllocations, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlareShipPilot ExitAvoidance"), STAT_FlareShipPilot_ExitAvoidance, STATGROUP_Flare);
 
 
@@ -42,6 +45,10 @@ UFlareShipPilot::UFlareShipPilot(const class FObjectInitializer& PCIP)
 	LastPilotTargetShip = NULL;
 	PilotTargetStation = NULL;
 	PilotLastTargetStation = NULL;
+	PilotAvoidShip = NULL;
+	PreparedTargetShip = NULL;
+	PreparedTargetFrame = 0;
+	HasPreparedTarget = false;
 	SelectedWeaponGroupIndex = -1;
 	MaxFollowDistance = 0;
 	LockTarget = false;
@@ -60,6 +67,7 @@ UFlareShipPilot::UFlareShipPilot(const class FObjectInitializer& PCIP)
 void UFlareShipPilot::TickPilot(float DeltaSeconds)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FlareShipPilot_Tick);
+	SCOPE_FLARE_ALLOCATION_COUNTER(STAT_FlareShipPilot_TickAllocations);
 
 	if (Ship->IsStation())
 	{
@@ -134,7 +142,19 @@ void UFlareShipPilot::MilitaryPilot(float DeltaSeconds)
 	}
 
 	CurrentTactic = Ship->GetCompany()->GetTacticManager()->GetCurrentTacticForShipGroup(CombatGroup);
-	FindBestHostileTarget(CurrentTactic);
+
+	// Target selection is expensive : let the scheduler spread it across frames, unless the target is dead
+	UFlarePilotScheduler* Scheduler = Ship->GetGame()->GetActiveSector()->GetPilotScheduler();
+	bool TargetLost = PilotTargetShip && !PilotTargetShip->GetParent()->GetDamageSystem()->IsAlive();
+	AFlareSpacecraft* PreparedTarget = NULL;
+	if (ConsumePreparedHostileTarget(PreparedTarget))
+	{
+		SetHostileTarget(PreparedTarget);
+	}
+	else if (TargetLost || Scheduler->CanDecide(Ship))
+	{
+		FindBestHostileTarget(CurrentTactic);
+	}
 
 	bool Idle = true;
 
@@ -216,11 +236,7 @@ void UFlareShipPilot::CargoPilot(float DeltaSeconds)
 
 	TimeSinceLastDockingAttempt += DeltaSeconds;
 
-	AFlareSpacecraft* PilotAvoidShip = GetNearestHostileShip(true, EFlarePartSize::S);
-	if (!PilotAvoidShip)
-	{
-		PilotAvoidShip = GetNearestHostileShip(true, EFlarePartSize::L);
-	}
+	UpdatePilotAvoidShip();
 
 	// If enemy near, run away !
 	if (PilotAvoidShip)
@@ -286,7 +302,9 @@ void UFlareShipPilot::CargoPilot(float DeltaSeconds)
 	{
 		if (!PilotTargetStation)
 		{
-			TArray<AFlareSpacecraft*> FriendlyStations = GetFriendlyStations();
+			FMemMark Mark(FMemStack::Get());
+			TArray<AFlareSpacecraft*, TMemStackAllocator<>> FriendlyStations;
+			GetFriendlyStations(FriendlyStations);
 			if (FriendlyStations.Num() > 0)
 			{
 				int32 Index = FMath::RandHelper(FriendlyStations.Num());
@@ -934,11 +952,7 @@ void UFlareShipPilot::IdlePilot(float DeltaSeconds)
 	//UseOrbitalBoost = false;
 
 	// If there is ennemy fly away
-	AFlareSpacecraft* PilotAvoidShip = GetNearestHostileShip(true, EFlarePartSize::S);
-	if (!PilotAvoidShip)
-	{
-		PilotAvoidShip = GetNearestHostileShip(true, EFlarePartSize::L);
-	}
+	UpdatePilotAvoidShip();
 
 	// If enemy near, run away !
 	if (PilotAvoidShip)
@@ -967,10 +981,16 @@ void UFlareShipPilot::IdlePilot(float DeltaSeconds)
 	{
 		AFlareSpacecraft* LeaderShip = Ship;
 
-		TArray<AFlareSpacecraft*> Spacecrafts = Ship->GetGame()->GetActiveSector()->GetCompanySpacecrafts(Ship->GetCompany());
+		TArray<AFlareSpacecraft*>& Spacecrafts = Ship->GetGame()->GetActiveSector()->GetSpacecrafts();
 		for (int ShipIndex = 0; ShipIndex < Spacecrafts.Num() ; ShipIndex++)
 		{
 			AFlareSpacecraft* CandidateShip = Spacecrafts[ShipIndex];
+
+			if (CandidateShip->GetCompany() != Ship->GetCompany())
+			{
+				continue;
+			}
+
 			float LeaderMass = LeaderShip->GetSpacecraftMass();
 			float CandidateMass = CandidateShip->GetSpacecraftMass();
 
@@ -1135,9 +1155,14 @@ void UFlareShipPilot::FindBestHostileTarget(EFlareCombatTactic::Type Tactic)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FlareShipPilot_FindBestHostileTarget);
 
-	AFlareSpacecraft* TargetCandidate = NULL;
-
 	struct PilotHelper::TargetPreferences TargetPreferences;
+	GetHostileTargetPreferences(Tactic, TargetPreferences);
+
+	SetHostileTarget(PilotHelper::GetBestTarget(Ship, TargetPreferences));
+}
+
+void UFlareShipPilot::GetHostileTargetPreferences(EFlareCombatTactic::Type Tactic, struct PilotHelper::TargetPreferences& TargetPreferences) const
+{
 	TargetPreferences.IsLarge = 1;
 	TargetPreferences.IsSmall = 1;
 	TargetPreferences.IsStation = 0;
@@ -1190,9 +1215,10 @@ void UFlareShipPilot::FindBestHostileTarget(EFlareCombatTactic::Type Tactic)
 			TargetPreferences.AttackTargetWeight = 1.0;
 		}
 	}
+}
 
-	TargetCandidate = PilotHelper::GetBestTarget(Ship, TargetPreferences);
-
+void UFlareShipPilot::SetHostileTarget(AFlareSpacecraft* TargetCandidate)
+{
 	if (TargetCandidate)
 	{
 		bool NewTarget = false;
@@ -1240,6 +1266,61 @@ void UFlareShipPilot::FindBestHostileTarget(EFlareCombatTactic::Type Tactic)
 
 
 
+bool UFlareShipPilot::NeedsHostileTarget() const
+{
+	return !Ship->IsStation()
+		&& Ship->IsMilitary()
+		&& Ship->GetStateManager()->IsPilotMode()
+		&& Ship->GetParent()->GetDamageSystem()->IsAlive()
+		&& !Ship->GetNavigationSystem()->IsDocked()
+		&& !Ship->GetNavigationSystem()->IsAutoPilot();
+}
+
+void UFlareShipPilot::GetPreparedTargetPreferences(struct PilotHelper::TargetPreferences& TargetPreferences) const
+{
+	GetHostileTargetPreferences(CurrentTactic, TargetPreferences);
+}
+
+void UFlareShipPilot::SetPreparedHostileTarget(AFlareSpacecraft* TargetCandidate)
+{
+	PreparedTargetShip = TargetCandidate;
+	PreparedTargetFrame = GFrameCounter;
+	HasPreparedTarget = true;
+}
+
+bool UFlareShipPilot::ConsumePreparedHostileTarget(AFlareSpacecraft*& TargetCandidate)
+{
+	// Decisions are prepared either earlier this frame or at the end of the previous one
+	bool Valid = HasPreparedTarget && PreparedTargetFrame + 1 >= GFrameCounter;
+	HasPreparedTarget = false;
+
+	if (!Valid || (PreparedTargetShip && !PreparedTargetShip->GetParent()->GetDamageSystem()->IsAlive()))
+	{
+		return false;
+	}
+
+	TargetCandidate = PreparedTargetShip;
+	return true;
+}
+
+void UFlareShipPilot::UpdatePilotAvoidShip()
+{
+	// Look for threats when the scheduler allows it
+	UFlarePilotScheduler* Scheduler = Ship->GetGame()->GetActiveSector()->GetPilotScheduler();
+	if (Scheduler->CanDecide(Ship))
+	{
+		PilotAvoidShip = GetNearestHostileShip(true, EFlarePartSize::S);
+		if (!PilotAvoidShip)
+		{
+			PilotAvoidShip = GetNearestHostileShip(true, EFlarePartSize::L);
+		}
+	}
+	else if (PilotAvoidShip && !PilotAvoidShip->GetParent()->GetDamageSystem()->IsAlive())
+	{
+		PilotAvoidShip = NULL;
+	}
+}
+
 int32 UFlareShipPilot::GetPreferedWeaponGroup() const
 {
 	return SelectedWeaponGroupIndex;
@@ -1275,11 +1356,7 @@ FVector UFlareShipPilot::ExitAvoidance(AFlareSpacecraft* TargetShip, FVector Ini
 
 		FVector CurrentVelocityAxis = CurrentVelocity.GetUnsafeNormal();
 
-		// TODO Cache
-		TArray<UActorComponent*> Engines = Ship->GetComponentsByClass(UFlareEngine::StaticClass());
-
-
-		FVector Acceleration = Ship->GetNavigationSystem()->GetTotalMaxThrustInAxis(Engines, CurrentVelocityAxis, false) / Ship->GetSpacecraftMass();
+		FVector Acceleration = Ship->GetNavigationSystem()->GetTotalMaxThrustInAxis(CurrentVelocityAxis, false) / Ship->GetSpacecraftMass();
 		float AccelerationInAngleAxis =  FMath::Abs(FVector::DotProduct(Acceleration, CurrentVelocityAxis));
 
 		TimeToStop= (CurrentVelocity.Size() / (AccelerationInAngleAxis));
@@ -1377,39 +1454,41 @@ AFlareSpacecraft* UFlareShipPilot::GetNearestHostileShip(bool DangerousOnly, EFl
 		return NULL;
 	}
 
+	const FFlareCombatSnapshot& Snapshot = Ship->GetGame()->GetActiveSector()->GetCombatSnapshot();
+	int32 CompanyIndex = Snapshot.GetCompanyIndex(Ship->GetCompany());
+	bool LargeOnly = (Size == EFlarePartSize::L);
+
 	FVector PilotLocation = Ship->GetActorLocation();
 	float MinDistanceSquared = -1;
 	AFlareSpacecraft* NearestHostileShip = NULL;
 
-	for (int32 SpacecraftIndex = 0; SpacecraftIndex < Ship->GetGame()->GetActiveSector()->GetSpacecrafts().Num(); SpacecraftIndex++)
+	for (const FFlareCombatSnapshotEntry& Candidate : Snapshot.GetEntries())
 	{
-		AFlareSpacecraft* ShipCandidate = Ship->GetGame()->GetActiveSector()->GetSpacecrafts()[SpacecraftIndex];
-
-		if (!ShipCandidate->GetParent()->GetDamageSystem()->IsAlive())
+		if (!Candidate.HasFlag(EFlareCombatSnapshotFlags::Alive))
 		{
 			continue;
 		}
 
-		if (ShipCandidate->GetSize() != Size)
+		if (Candidate.HasFlag(EFlareCombatSnapshotFlags::Large) != LargeOnly)
 		{
 			continue;
 		}
 
-		if (DangerousOnly && ! PilotHelper::IsShipDangerous(ShipCandidate))
+		if (DangerousOnly && !Candidate.HasFlag(EFlareCombatSnapshotFlags::Dangerous))
 		{
 			continue;
 		}
 
-		if (Ship->GetCompany()->GetWarState(ShipCandidate->GetCompany()) != EFlareHostility::Hostile)
+		if (!Snapshot.IsHostile(CompanyIndex, Candidate))
 		{
 			continue;
 		}
 
-		float DistanceSquared = (PilotLocation - ShipCandidate->GetActorLocation()).SizeSquared();
+		float DistanceSquared = (PilotLocation - Candidate.Location).SizeSquared();
 		if (NearestHostileShip == NULL || DistanceSquared < MinDistanceSquared)
 		{
 			MinDistanceSquared = DistanceSquared;
-			NearestHostileShip = ShipCandidate;
+			NearestHostileShip = Candidate.Spacecraft;
 		}
 
 	}
@@ -1461,8 +1540,6 @@ AFlareSpacecraft* UFlareShipPilot::GetNearestShip(bool IgnoreDockingShip) const
 
 FVector UFlareShipPilot::GetAngularVelocityToAlignAxis(FVector LocalShipAxis, FVector TargetAxis, FVector TargetAngularVelocity, float DeltaSeconds) const
 {
-	TArray<UActorComponent*> Engines = Ship->GetComponentsByClass(UFlareEngine::StaticClass());
-
 	FVector AngularVelocity = Ship->Airframe->GetPhysicsAngularVelocity();
 	FVector WorldShipAxis = Ship->Airframe->GetComponentToWorld().GetRotation().RotateVector(LocalShipAxis);
 
@@ -1487,7 +1564,7 @@ FVector UFlareShipPilot::GetAngularVelocityToAlignAxis(FVector LocalShipAxis, FV
 	else {
 		FVector SimpleAcceleration = DeltaVelocityAxis * Ship->GetNavigationSystem()->GetAngularAccelerationRate();
 	    // Scale with damages
-		float DamageRatio = Ship->GetNavigationSystem()->GetTotalMaxTorqueInAxis(Engines, DeltaVelocityAxis, true) / Ship->GetNavigationSystem()->GetTotalMaxTorqueInAxis(Engines, DeltaVelocityAxis, false);
+		float DamageRatio = Ship->GetNavigationSystem()->GetTotalMaxTorqueInAxis(DeltaVelocityAxis, true) / Ship->GetNavigationSystem()->GetTotalMaxTorqueInAxis(DeltaVelocityAxis, false);
 	    FVector DamagedSimpleAcceleration = SimpleAcceleration * DamageRatio;
 
 	    FVector Acceleration = DamagedSimpleAcceleration;
@@ -1556,9 +1633,9 @@ AFlareSpacecraft* UFlareShipPilot::GetNearestAvailableStation(bool RealStation)
 	return NearestStation;
 }
 
-TArray<AFlareSpacecraft*> UFlareShipPilot::GetFriendlyStations() const
+void UFlareShipPilot::GetFriendlyStations(TArray<AFlareSpacecraft*, TMemStackAllocator<>>& FriendlyStations) const
 {
-	TArray<AFlareSpacecraft*> FriendlyStations;
+	FriendlyStations.Reset();
 
 	for (int32 SpacecraftIndex = 0; SpacecraftIndex < Ship->GetGame()->GetActiveSector()->GetStations().Num(); SpacecraftIndex++)
 	{
@@ -1575,7 +1652,6 @@ TArray<AFlareSpacecraft*> UFlareShipPilot::GetFriendlyStations() const
 			FriendlyStations.Add(StationCandidate);
 		}
 	}
-	return FriendlyStations;
 }
 
 void UFlareShipPilot::AlignToTargetVelocityWithThrust(float DeltaSeconds)
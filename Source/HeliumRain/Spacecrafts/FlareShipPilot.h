@@ -1,6 +1,7 @@
 #pragma once
 
 #include "FlareSpacecraftTypes.h"
+#include "FlarePilotHelper.h"
 #include "../Game/FlareGameTypes.h"
 #include "FlareShipPilot.generated.h"
 
@@ -73,7 +74,7 @@ public:
 	virtual AFlareSpacecraft* GetNearestAvailableStation(bool RealStation) const;
 
 	/** Return all friendly station in the sector */
-	virtual TArray<AFlareSpacecraft*> GetFriendlyStations() const;
+	virtual void GetFriendlyStations(TArray<AFlareSpacecraft*, TMemStackAllocator<>>& FriendlyStations) const;
 
 	/**
 	 * Return the angular velocity need to align the local ship axis to the target axis
@@ -82,6 +83,15 @@ public:
 
 	virtual void FindBestHostileTarget(EFlareCombatTactic::Type Tactic);
 
+	/** Get the target scoring preferences for a tactic */
+	void GetHostileTargetPreferences(EFlareCombatTactic::Type Tactic, struct PilotHelper::TargetPreferences& TargetPreferences) const;
+
+	/** Switch to a new hostile target, or none */
+	void SetHostileTarget(AFlareSpacecraft* TargetCandidate);
+
+	/** Look for the nearest dangerous hostile ship, when the pilot scheduler allows it */
+	void UpdatePilotAvoidShip();
+
 	void AlignToTargetVelocityWithThrust(float DeltaSeconds);
 
 public:
@@ -105,8 +115,26 @@ public:
 	/** Pilot weapon selection */
 	virtual int32 GetPreferedWeaponGroup() const;
 
+
+	/*----------------------------------------------------
+		Decision phase
+	----------------------------------------------------*/
+
+	/** Check if the pilot will select a hostile target when it ticks */
+	bool NeedsHostileTarget() const;
+
+	/** Get the preferences the decision phase should score targets with */
+	void GetPreparedTargetPreferences(struct PilotHelper::TargetPreferences& TargetPreferences) const;
+
+	/** Store the target selected by the decision phase */
+	void SetPreparedHostileTarget(AFlareSpacecraft* TargetCandidate);
+
 protected:
 
+	/** Get the target selected by the decision phase, if still valid */
+	bool ConsumePreparedHostileTarget(AFlareSpacecraft*& TargetCandidate);
+
+
 	/*----------------------------------------------------
 		Protected data
 	----------------------------------------------------*/
@@ -145,6 +173,14 @@ protected:
 	AFlareSpacecraft*                            PilotLastTargetStation;
 	UPROPERTY()
 	UFlareSpacecraftComponent*			         PilotTargetComponent;
+	UPROPERTY()
+	AFlareSpacecraft*                            PilotAvoidShip;
+
+	// Decision phase result
+	UPROPERTY()
+	AFlareSpacecraft*                            PreparedTargetShip;
+	uint64                                       PreparedTargetFrame;
+	bool                                         HasPreparedTarget;
 
 	float                                        AttackAngle;
 	float                                        AttackDistance;
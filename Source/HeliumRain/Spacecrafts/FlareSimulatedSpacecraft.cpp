@@ -250,6 +250,7 @@ bool UFlareSimulatedSpacecraft::CanBeFlown(FText& OutInfo) const
 void UFlareSimulatedSpacecraft::SetCurrentSector(UFlareSimulatedSector* Sector)
 {
 	CurrentSector = Sector;
+	GetCompany()->InvalidateCompanyValue();
 
 	// Mark the sector as visited
 	if (!Sector->IsTravelSector())
@@ -417,6 +418,12 @@ void UFlareSimulatedSpacecraft::LockResources()
 			}
 		}
 	}
+
+	// Resource use may have changed
+	if (CurrentSector)
+	{
+		CurrentSector->InvalidateMarket();
+	}
 }
 
 void UFlareSimulatedSpacecraft::SetAsteroidData(FFlareAsteroidSave* Data)
@@ -457,6 +464,7 @@ void UFlareSimulatedSpacecraft::Upgrade()
 		Game->GetQuestManager()->OnEvent(FFlareBundle().PutTag("start-station-construction").PutInt32("upgrade", 1));
 	}
 
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Spacecrafts);
 	FLOGV("UFlareSimulatedSpacecraft::Upgrade %s to level %d done", *GetImmatriculation().ToString(), SpacecraftData.Level);
 }
 
@@ -496,6 +504,7 @@ void UFlareSimulatedSpacecraft::SetTrading(bool Trading)
 	}
 
 	SpacecraftData.IsTrading = Trading;
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Spacecrafts);
 }
 
 void UFlareSimulatedSpacecraft::SetIntercepted(bool Intercepted)
@@ -827,6 +836,8 @@ void UFlareSimulatedSpacecraft::FinishConstruction()
 	SpacecraftData.IsUnderConstruction = false;
 	SpacecraftData.Cargo = SpacecraftData.CargoBackup;
 	Load(SpacecraftData);
+
+	Game->GetWorldEvents().Notify(EFlareWorldEvent::Spacecrafts);
 }
 
 void UFlareSimulatedSpacecraft::OrderRepairStock(float FS)
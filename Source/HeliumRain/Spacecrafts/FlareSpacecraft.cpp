@@ -5,6 +5,7 @@
 #include "FlareOrbitalEngine.h"
 #include "FlareRCS.h"
 #include "FlareWeapon.h"
+#include "FlareTurret.h"
 #include "FlareShipPilot.h"
 #include "FlarePilotHelper.h"
 #include "FlareInternalComponent.h"
@@ -14,6 +15,7 @@
 #include "../Player/FlarePlayerController.h"
 #include "../Game/FlareGame.h"
 #include "../Game/FlareAsteroid.h"
+#include "../Game/FlareAllocationStats.h"
 #include "../Game/AI/FlareCompanyAI.h"
 
 #include "../UI/Menus/FlareShipMenu.h"
@@ -22,9 +24,25 @@ DECLARE_CYCLE_STAT(TEXT("FlareSpacecraft Systems"), STAT_FlareSpacecraft_Systems
 DECLARE_CYCLE_STAT(TEXT("FlareSpacecraft Player"), STAT_FlareSpacecraft_PlayerShip, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlareSpacecraft Hit"), STAT_FlareSpacecraft_Hit, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlareSpacecraft Aim"), STAT_FlareSpacecraft_Aim, STATGROUP_Flare);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FlareSpacecraft Tick allocations"), STAT_FlareSpacecraft_TickAllocations, STATGROUP_Flare);
 
 #define LOCTEXT_NAMESPACE "FlareSpacecraft"
 
+// Ships farther than this from the player may use the reduced simulation, in centimeters
+#define SIMULATION_LOD_FAR_DISTANCE 3000000.f
+
+// Ships using the reduced simulation come back to the full one closer than this, in centimeters
+#define SIMULATION_LOD_NEAR_DISTANCE 2000000.f
+
+// Time between two simulation LOD checks, in seconds
+#define SIMULATION_LOD_CHECK_PERIOD 0.5f
+
+// Time step of the reduced simulation, in seconds
+#define SIMULATION_LOD_REDUCED_PERIOD 0.25f
+
+// Time after being hit during which a ship is considered in combat, in seconds
+#define SIMULATION_LOD_COMBAT_COOLDOWN 10.f
+
 
 /*----------------------------------------------------
 	Constructor
@@ -73,6 +91,9 @@ AFlareSpacecraft::AFlareSpacecraft(const class FObjectInitializer& PCIP)
 	StateManager = NULL;
 	CurrentTarget = NULL;
 	NavigationSystem = NULL;
+	SimulationLOD = EFlareSimulationLOD::Full;
+	SimulationLODCheckTimer = 0;
+	PendingSimulationTime = 0;
 }
 
 
@@ -119,6 +140,7 @@ void AFlareSpacecraft::BeginPlay()
 
 void AFlareSpacecraft::Tick(float DeltaSeconds)
 {
+	SCOPE_FLARE_ALLOCATION_COUNTER(STAT_FlareSpacecraft_TickAllocations);
 	FCHECK(IsValidLowLevel());
 
 	// Wait for readiness to call some stuff on load
@@ -140,29 +162,35 @@ void AFlareSpacecraft::Tick(float DeltaSeconds)
 
 	if (!IsPresentationMode() && StateManager && !Paused)
 	{
-		// Tick systems
+		UpdateSimulationLOD(DeltaSeconds);
+
+		// Tick systems, on a coarse clock for distant ships
+		PendingSimulationTime += DeltaSeconds;
+		if (SimulationLOD == EFlareSimulationLOD::Full || PendingSimulationTime >= SIMULATION_LOD_REDUCED_PERIOD)
 		{
 			SCOPE_CYCLE_COUNTER(STAT_FlareSpacecraft_Systems);
-			StateManager->Tick(DeltaSeconds);
-			DockingSystem->TickSystem(DeltaSeconds);
-			NavigationSystem->TickSystem(DeltaSeconds);
-			WeaponsSystem->TickSystem(DeltaSeconds);
-			DamageSystem->TickSystem(DeltaSeconds);
+			float SystemsDeltaSeconds = PendingSimulationTime;
+			PendingSimulationTime = 0;
+
+			StateManager->Tick(SystemsDeltaSeconds);
+			DockingSystem->TickSystem(SystemsDeltaSeconds);
+			NavigationSystem->TickSystem(SystemsDeltaSeconds);
+			WeaponsSystem->TickSystem(SystemsDeltaSeconds);
+			DamageSystem->TickSystem(SystemsDeltaSeconds);
 		}
 
 		// Lights
-		TArray<UActorComponent*> LightComponents = GetComponentsByClass(USpotLightComponent::StaticClass());
-		for (int32 ComponentIndex = 0; ComponentIndex < LightComponents.Num(); ComponentIndex++)
+		bool LightsPowered = !Parent->GetDamageSystem()->HasPowerOutage();
+		for (int32 LightIndex = 0; LightIndex < SpotLights.Num(); LightIndex++)
 		{
-			USpotLightComponent* Component = Cast<USpotLightComponent>(LightComponents[ComponentIndex]);
-			if (Component)
+			if (SpotLights[LightIndex]->IsActive() != LightsPowered)
 			{
-				Component->SetActive(!Parent->GetDamageSystem()->HasPowerOutage());
+				SpotLights[LightIndex]->SetActive(LightsPowered);
 			}
 		}
 
 		// Player ship updates
-		AFlarePlayerController* PC = Cast<AFlarePlayerController>(GetWorld()->GetFirstPlayerController());
+		AFlarePlayerController* PC = GetGame()->GetPC();
 		if (PC)
 		{
 			SCOPE_CYCLE_COUNTER(STAT_FlareSpacecraft_PlayerShip);
@@ -244,6 +272,86 @@ void AFlareSpacecraft::Tick(float DeltaSeconds)
 	Super::Tick(DeltaSeconds);
 }
 
+bool AFlareSpacecraft::IsInCombat()
+{
+	// Recently hit
+	if (DamageSystem->GetTimeSinceLastExternalDamage() < SIMULATION_LOD_COMBAT_COOLDOWN)
+	{
+		return true;
+	}
+
+	// Chasing a target
+	if (Pilot && Pilot->GetTargetShip())
+	{
+		return true;
+	}
+
+	// Turrets engaging a target
+	for (UFlareWeapon* Weapon : WeaponsSystem->GetWeaponList())
+	{
+		UFlareTurret* Turret = Cast<UFlareTurret>(Weapon);
+		if (Turret && Turret->GetTurretPilot() && Turret->GetTurretPilot()->GetTargetShip())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+float AFlareSpacecraft::GetReducedSimulationPeriod()
+{
+	return SIMULATION_LOD_REDUCED_PERIOD;
+}
+
+void AFlareSpacecraft::UpdateSimulationLOD(float DeltaSeconds)
+{
+	SimulationLODCheckTimer -= DeltaSeconds;
+	if (SimulationLODCheckTimer > 0)
+	{
+		return;
+	}
+	SimulationLODCheckTimer = SIMULATION_LOD_CHECK_PERIOD;
+
+	// Anything the player sees or interacts with, precise maneuvers and fights need the full simulation
+	AFlarePlayerController* PC = GetGame()->GetPC();
+	AFlareSpacecraft* PlayerShip = (PC ? PC->GetShipPawn() : NULL);
+	bool NeedsFullSimulation = (!PlayerShip
+		|| PlayerShip == this
+		|| PlayerShip->GetCurrentTarget() == this
+		|| NavigationSystem->IsAutoPilot()
+		|| IsInCombat());
+
+	float DistanceSquared = (PlayerShip ? FVector::DistSquared(PlayerShip->GetActorLocation(), GetActorLocation()) : 0);
+
+	// Hysteresis between the two distances
+	if (SimulationLOD == EFlareSimulationLOD::Full)
+	{
+		if (!NeedsFullSimulation && DistanceSquared > FMath::Square(SIMULATION_LOD_FAR_DISTANCE))
+		{
+			SetSimulationLOD(EFlareSimulationLOD::Reduced);
+		}
+	}
+	else if (NeedsFullSimulation || DistanceSquared < FMath::Square(SIMULATION_LOD_NEAR_DISTANCE))
+	{
+		SetSimulationLOD(EFlareSimulationLOD::Full);
+	}
+}
+
+void AFlareSpacecraft::SetSimulationLOD(EFlareSimulationLOD::Type LOD)
+{
+	SimulationLOD = LOD;
+
+	// Engines are no longer solved, stop the exhausts
+	if (LOD == EFlareSimulationLOD::Reduced)
+	{
+		for (UFlareEngine* Engine : NavigationSystem->GetEngines())
+		{
+			Engine->SetAlpha(0);
+		}
+	}
+}
+
 void AFlareSpacecraft::SetCurrentTarget(AFlareSpacecraft* Target)
 {
 	if (CurrentTarget != Target)
@@ -261,7 +369,7 @@ inline static bool IsCloserToCenter(const FFlareScreenTarget& TargetA, const FFl
 
 TArray<FFlareScreenTarget>& AFlareSpacecraft::GetCurrentTargets()
 {
-	Targets.Empty();
+	Targets.Reset();
 
 	FVector CameraLocation = GetCamera()->GetComponentLocation();
 	FVector CameraAimDirection = GetCamera()->GetComponentRotation().Vector();
@@ -454,19 +562,14 @@ void AFlareSpacecraft::Redock()
 	// Re-dock if we were docked
 	if (GetData().DockedTo != NAME_None && !IsPresentationMode())
 	{
-		// TODO use sector iterator
 		FLOGV("AFlareSpacecraft::Redock : Looking for station '%s'", *GetData().DockedTo.ToString());
 
-		for (int32 SpacecraftIndex = 0; SpacecraftIndex < GetGame()->GetActiveSector()->GetSpacecrafts().Num(); SpacecraftIndex++)
+		// The station may still be waiting for activation, in which case it is spawned now
+		AFlareSpacecraft* Station = GetGame()->GetActiveSector()->FindSpacecraft(GetData().DockedTo);
+		if (Station)
 		{
-			AFlareSpacecraft* Station = GetGame()->GetActiveSector()->GetSpacecrafts()[SpacecraftIndex];
-
-			if (Station->GetImmatriculation() == GetData().DockedTo)
-			{
-				FLOGV("AFlareSpacecraft::Redock : Found dock station '%s'", *Station->GetImmatriculation().ToString());
-				NavigationSystem->ConfirmDock(Station, GetData().DockedAt, false);
-				break;
-			}
+			FLOGV("AFlareSpacecraft::Redock : Found dock station '%s'", *Station->GetImmatriculation().ToString());
+			NavigationSystem->ConfirmDock(Station, GetData().DockedAt, false);
 		}
 	}
 }
@@ -629,6 +732,18 @@ void AFlareSpacecraft::Load(UFlareSimulatedSpacecraft* ParentSpacecraft)
 	// Load dynamic components
 	UpdateDynamicComponents();
 
+	// Find lights
+	SpotLights.Empty();
+	TArray<UActorComponent*> LightComponents = GetComponentsByClass(USpotLightComponent::StaticClass());
+	for (int32 ComponentIndex = 0; ComponentIndex < LightComponents.Num(); ComponentIndex++)
+	{
+		USpotLightComponent* Component = Cast<USpotLightComponent>(LightComponents[ComponentIndex]);
+		if (Component)
+		{
+			SpotLights.Add(Component);
+		}
+	}
+
 	// Initialize components
 	TArray<UActorComponent*> Components = GetComponentsByClass(UFlareSpacecraftComponent::StaticClass());
 	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
@@ -1097,6 +1212,8 @@ void AFlareSpacecraft::OnRepaired()
 		UFlareSpacecraftComponent* Component = Cast<UFlareSpacecraftComponent>(Components[ComponentIndex]);
 		Component->OnRepaired();
 	}
+
+	NavigationSystem->InvalidatePropulsion();
 }
 
 void AFlareSpacecraft::OnRefilled()
@@ -73,6 +73,12 @@ public:
 
 	virtual float GetSpacecraftMass();
 
+	/** Check if the ship is fighting or being fought */
+	bool IsInCombat();
+
+	/** Time step of the reduced simulation, in seconds */
+	static float GetReducedSimulationPeriod();
+
 
 	/*----------------------------------------------------
 		Player interface
@@ -233,6 +239,12 @@ public:
 
 protected:
 
+	/** Move between simulation tiers depending on distance to the player and combat */
+	void UpdateSimulationLOD(float DeltaSeconds);
+
+	void SetSimulationLOD(EFlareSimulationLOD::Type LOD);
+
+
 	/*----------------------------------------------------
 		Internal data
 	----------------------------------------------------*/
@@ -263,6 +275,10 @@ protected:
 	UPROPERTY()
 	UFlareShipPilot*                               Pilot;
 
+	// Spot lights, switched off by power outages
+	UPROPERTY()
+	TArray<USpotLightComponent*>                   SpotLights;
+
 	// Decal material
 	UPROPERTY()
 	UMaterialInstanceDynamic*                      DecalMaterial;
@@ -297,6 +313,11 @@ protected:
 	
 	bool                                           AttachedToParentActor;
 
+	// Simulation level of detail
+	EFlareSimulationLOD::Type                      SimulationLOD;
+	float                                          SimulationLODCheckTimer;
+	float                                          PendingSimulationTime;
+
 	// Joystick settings
 	float                                          JoystickThrustMinSpeed;
 	float                                          JoystickThrustMaxSpeed;
@@ -434,4 +455,9 @@ public:
 	{
 		return Paused;
 	}
+
+	inline EFlareSimulationLOD::Type GetSimulationLOD() const
+	{
+		return SimulationLOD;
+	}
 };
@@ -82,6 +82,16 @@ namespace EFlareSpawnMode
 	};
 }
 
+/** Simulation level of detail of a spacecraft in the active sector */
+namespace EFlareSimulationLOD
+{
+	enum Type
+	{
+		Full, // Full subsystems, every frame
+		Reduced // Coarse ticks, no engine thrust solving, no heat
+	};
+}
+
 /** Resource lock type values */
 UENUM()
 namespace EFlareResourceLock
@@ -32,6 +32,7 @@ void UFlareTurret::Initialize(FFlareSpacecraftComponentSave* Data, UFlareCompany
 {
 	Super::Initialize(Data, Company, OwnerShip, IsInMenu);
 	AimDirection = FVector::ZeroVector;
+	PendingSimulationTime = 0;
 
 	// Initialize pilot
 	Pilot = NewObject<UFlareTurretPilot>(this, UFlareTurretPilot::StaticClass());
@@ -149,9 +150,19 @@ void UFlareTurret::TickComponent(float DeltaTime, enum ELevelTick TickType, FAct
 		return;
 	}
 
+	// Distant ships aim on the same coarse clock as their systems
+	PendingSimulationTime += DeltaTime;
+	if (Spacecraft->GetSimulationLOD() == EFlareSimulationLOD::Reduced && PendingSimulationTime < AFlareSpacecraft::GetReducedSimulationPeriod())
+	{
+		Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+		return;
+	}
+	float TurretDeltaTime = PendingSimulationTime;
+	PendingSimulationTime = 0;
+
 	if (Spacecraft->GetParent()->GetDamageSystem()->IsAlive())
 	{
-		Pilot->TickPilot(DeltaTime);
+		Pilot->TickPilot(TurretDeltaTime);
 		if (Pilot->IsWantFire())
 		{
 			StartFire();
@@ -187,17 +198,17 @@ void UFlareTurret::TickComponent(float DeltaTime, enum ELevelTick TickType, FAct
 
 			float TurretAngleDiff = FMath::UnwindDegrees(TargetTurretAngle - ShipComponentData->Turret.TurretAngle);
 
-			if (FMath::Abs(TurretAngleDiff) <= UsableTurretVelocity * DeltaTime)
+			if (FMath::Abs(TurretAngleDiff) <= UsableTurretVelocity * TurretDeltaTime)
 			{
 				ShipComponentData->Turret.TurretAngle = TargetTurretAngle;
 			}
 			else if (TurretAngleDiff < 0)
 			{
-				ShipComponentData->Turret.TurretAngle -= UsableTurretVelocity * DeltaTime;
+				ShipComponentData->Turret.TurretAngle -= UsableTurretVelocity * TurretDeltaTime;
 			}
 			else
 			{
-				ShipComponentData->Turret.TurretAngle += UsableTurretVelocity * DeltaTime;
+				ShipComponentData->Turret.TurretAngle += UsableTurretVelocity * TurretDeltaTime;
 			}
 
 			TurretComponent->SetRelativeRotation(FRotator(0, ShipComponentData->Turret.TurretAngle, 0));
@@ -230,17 +241,17 @@ void UFlareTurret::TickComponent(float DeltaTime, enum ELevelTick TickType, FAct
 			float UsableBarrelsVelocity = GetUsableRatio() * ComponentDescription->WeaponCharacteristics.TurretCharacteristics.TurretAngularVelocity;
 			float BarrelAngleDiff = FMath::UnwindDegrees(TargetBarrelAngle - ShipComponentData->Turret.BarrelsAngle);
 
-			if (FMath::Abs(BarrelAngleDiff) <= UsableBarrelsVelocity * DeltaTime)
+			if (FMath::Abs(BarrelAngleDiff) <= UsableBarrelsVelocity * TurretDeltaTime)
 			{
 				ShipComponentData->Turret.BarrelsAngle = TargetBarrelAngle;
 			}
 			else if (BarrelAngleDiff < 0)
 			{
-				ShipComponentData->Turret.BarrelsAngle -= UsableBarrelsVelocity * DeltaTime;
+				ShipComponentData->Turret.BarrelsAngle -= UsableBarrelsVelocity * TurretDeltaTime;
 			}
 			else
 			{
-				ShipComponentData->Turret.BarrelsAngle += UsableBarrelsVelocity * DeltaTime;
+				ShipComponentData->Turret.BarrelsAngle += UsableBarrelsVelocity * TurretDeltaTime;
 			}
 			BarrelComponent->SetRelativeRotation(FRotator(ShipComponentData->Turret.BarrelsAngle, 0, 0));
 		}
@@ -285,11 +296,11 @@ FVector UFlareTurret::GetMuzzleLocation(int GunIndex) const
 
 	if (ComponentDescription->WeaponCharacteristics.GunCharacteristics.GunCount <= 1)
 	{
-		return GunComponent->GetSocketLocation(FName("Muzzle"));
+		return GunComponent->GetSocketLocation(GetMuzzleSocketName(-1));
 	}
 	else
 	{
-		return GunComponent->GetSocketLocation(FName(*(FString("Muzzle") + FString::FromInt(GunIndex))));
+		return GunComponent->GetSocketLocation(GetMuzzleSocketName(GunIndex));
 	}
 }
 
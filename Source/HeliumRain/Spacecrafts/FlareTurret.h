@@ -68,6 +68,7 @@ protected:
 
 	// General data
 	FVector  								         AimDirection;
+	float                                            PendingSimulationTime;
 
 
 public:
@@ -2,6 +2,8 @@
 #include "../Flare.h"
 
 #include "FlarePilotHelper.h"
+#include "FlarePilotScheduler.h"
+#include "FlareCombatSnapshot.h"
 #include "FlareTurret.h"
 #include "FlareRCS.h"
 #include "FlareTurretPilot.h"
@@ -10,6 +12,7 @@
 
 #include "../Player/FlarePlayerController.h"
 #include "../Game/FlareGame.h"
+#include "../Game/FlareAllocationStats.h"
 #include "../Game/AI/FlareCompanyAI.h"
 
 DECLARE_CYCLE_STAT(TEXT("FlareTurretPilot Tick"), STAT_FlareTurretPilot_Tick, STATGROUP_Flare);
@@ -18,6 +21,7 @@ DECLARE_CYCLE_STAT(TEXT("FlareTurretPilot Tick Intersect"), STAT_FlareTurretPilo
 DECLARE_CYCLE_STAT(TEXT("FlareTurretPilot Tick Intersect Gun"), STAT_FlareTurretPilot_Intersect_Gun, STATGROUP_Flare);
 
 DECLARE_CYCLE_STAT(TEXT("FlareTurretPilot GetNearestHostileShip"), STAT_FlareTurretPilot_GetNearestHostileShip, STATGROUP_Flare);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FlareTurretPilot Tick allocations"), STAT_FlareTurretPilot_TickAllocations, STATGROUP_Flare);
 
 
 /*----------------------------------------------------
@@ -33,6 +37,10 @@ UFlareTurretPilot::UFlareTurretPilot(const class FObjectInitializer& PCIP)
 	FireReactionTime = FMath::FRandRange(0.1, 0.2);
 	TimeUntilFireReaction = 0;
 	PilotTargetShip = NULL;
+	PreparedReachableTarget = NULL;
+	PreparedAnyTarget = NULL;
+	PreparedTargetFrame = 0;
+	HasPreparedTargets = false;
 }
 
 
@@ -76,6 +84,7 @@ void UFlareTurretPilot::PlayerStopFire()
 void UFlareTurretPilot::TickPilot(float DeltaSeconds)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FlareTurretPilot_Tick);
+	SCOPE_FLARE_ALLOCATION_COUNTER(STAT_FlareTurretPilot_TickAllocations);
 
 	TimeUntilNextTargetSelectionReaction -= DeltaSeconds;
 	TimeUntilFireReaction -= DeltaSeconds;
@@ -252,8 +261,9 @@ void UFlareTurretPilot::TickPilot(float DeltaSeconds)
 
 void UFlareTurretPilot::ProcessTurretTargetSelection()
 {
-
-	if (TimeUntilNextTargetSelectionReaction > 0)
+	// Wait for the reaction time, then for the scheduler to allow a new selection
+	UFlarePilotScheduler* Scheduler = Turret->GetSpacecraft()->GetGame()->GetActiveSector()->GetPilotScheduler();
+	if (TimeUntilNextTargetSelectionReaction > 0 || !Scheduler->CanDecide(Turret->GetSpacecraft()))
 	{
 		if(PilotTargetShip && !PilotTargetShip->GetParent()->GetDamageSystem()->IsAlive())
 		{
@@ -267,12 +277,16 @@ void UFlareTurretPilot::ProcessTurretTargetSelection()
 		TimeUntilNextTargetSelectionReaction = TargetSelectionReactionTime;
 	}
 
-
 	AFlareSpacecraft* OldPilotTargetShip = PilotTargetShip;
 
 	EFlareCombatTactic::Type Tactic = Turret->GetSpacecraft()->GetParent()->GetCompany()->GetTacticManager()->GetCurrentTacticForShipGroup(EFlareCombatGroup::Capitals);
 
-	PilotTargetShip = GetNearestHostileShip(true, Tactic);
+	// Use the targets found by the decision phase if possible
+	AFlareSpacecraft* ReachableTarget = NULL;
+	AFlareSpacecraft* AnyTarget = NULL;
+	bool Prepared = ConsumePreparedTargets(ReachableTarget, AnyTarget);
+
+	PilotTargetShip = (Prepared ? ReachableTarget : GetNearestHostileShip(true, Tactic));
 
 	if (Turret->GetWeaponGroup()->Target)
 	{
@@ -296,11 +310,22 @@ void UFlareTurretPilot::ProcessTurretTargetSelection()
 
 	if (!PilotTargetShip)
 	{
-		PilotTargetShip = GetNearestHostileShip(false, Tactic);
+		PilotTargetShip = (Prepared ? AnyTarget : GetNearestHostileShip(false, Tactic));
 	}
 }
 
 AFlareSpacecraft* UFlareTurretPilot::GetNearestHostileShip(bool ReachableOnly, EFlareCombatTactic::Type Tactic) const
+{
+	struct PilotHelper::TargetPreferences TargetPreferences;
+	GetTargetPreferences(Tactic, TargetPreferences);
+
+	const FFlareCombatSnapshot& Snapshot = Turret->GetSpacecraft()->GetGame()->GetActiveSector()->GetCombatSnapshot();
+	int32 CompanyIndex = Snapshot.GetCompanyIndex(Turret->GetSpacecraft()->GetParent()->GetCompany());
+
+	return SearchTarget(Snapshot, CompanyIndex, TargetPreferences, GetSecurityRadius(), ReachableOnly);
+}
+
+AFlareSpacecraft* UFlareTurretPilot::SearchTarget(const FFlareCombatSnapshot& Snapshot, int32 CompanyIndex, struct PilotHelper::TargetPreferences TargetPreferences, float SecurityRadius, bool ReachableOnly) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_FlareTurretPilot_GetNearestHostileShip);
 
@@ -310,21 +335,56 @@ AFlareSpacecraft* UFlareTurretPilot::GetNearestHostileShip(bool ReachableOnly, E
 	// - From another company
 	// - Is the nearest
 
-	float SecurityRadius = 0;
+	FVector PilotLocation = TargetPreferences.BaseLocation;
+	AFlareSpacecraft* NearestHostileShip = NULL;
 
+	while (NearestHostileShip == NULL)
+	{
+		NearestHostileShip = PilotHelper::GetBestTarget(Snapshot, CompanyIndex, TargetPreferences);
+
+		if(NearestHostileShip == NULL)
+		{
+			// No target
+			return NULL;
+		}
+
+		const FFlareCombatSnapshotEntry* Candidate = Snapshot.Find(NearestHostileShip);
+		check(Candidate);
+
+		float Distance = (PilotLocation - Candidate->Location).Size();
+		if (Distance < SecurityRadius * 100)
+		{
+			TargetPreferences.IgnoreList.Add(NearestHostileShip);
+			NearestHostileShip = NULL;
+			continue;
+		}
+
+		FVector TargetAxis = (Candidate->Location - PilotLocation).GetUnsafeNormal();
+
+		if (ReachableOnly && !Turret->IsReacheableAxis(TargetAxis))
+		{
+			TargetPreferences.IgnoreList.Add(NearestHostileShip);
+			NearestHostileShip = NULL;
+			continue;
+		}
+	}
+	return NearestHostileShip;
+}
+
+float UFlareTurretPilot::GetSecurityRadius() const
+{
 	if (Turret->GetDescription()->WeaponCharacteristics.FuzeType == EFlareShellFuzeType::Proximity)
 	{
-		 SecurityRadius = Turret->GetDescription()->WeaponCharacteristics.AmmoExplosionRadius + Turret->GetSpacecraft()->GetMeshScale() / 100;
+		return Turret->GetDescription()->WeaponCharacteristics.AmmoExplosionRadius + Turret->GetSpacecraft()->GetMeshScale() / 100;
 	}
+	return 0;
+}
 
+void UFlareTurretPilot::GetTargetPreferences(EFlareCombatTactic::Type Tactic, struct PilotHelper::TargetPreferences& TargetPreferences) const
+{
 	FVector PilotLocation = Turret->GetTurretBaseLocation();
-	float MaxDot = 0;
-	AFlareSpacecraft* NearestHostileShip = NULL;
 	FVector FireAxis = Turret->GetFireAxis();
 
-
-
-	struct PilotHelper::TargetPreferences TargetPreferences;
 	TargetPreferences.IsLarge = 1;
 	TargetPreferences.IsSmall = 1;
 	TargetPreferences.IsStation = 0;
@@ -380,42 +440,55 @@ AFlareSpacecraft* UFlareTurretPilot::GetNearestHostileShip(bool ReachableOnly, E
 			TargetPreferences.AttackTargetWeight = 1.0;
 		}
 	}
+}
 
+bool UFlareTurretPilot::ConsumePreparedTargets(AFlareSpacecraft*& ReachableTarget, AFlareSpacecraft*& AnyTarget)
+{
+	// Decisions are prepared either earlier this frame or at the end of the previous one
+	bool Valid = HasPreparedTargets && PreparedTargetFrame + 1 >= GFrameCounter;
+	HasPreparedTargets = false;
 
-	while (NearestHostileShip == NULL)
+	if (!Valid
+	 || (PreparedReachableTarget && !PreparedReachableTarget->GetParent()->GetDamageSystem()->IsAlive())
+	 || (PreparedAnyTarget && !PreparedAnyTarget->GetParent()->GetDamageSystem()->IsAlive()))
 	{
-		NearestHostileShip = PilotHelper::GetBestTarget(Turret->GetSpacecraft(), TargetPreferences);
+		return false;
+	}
 
-		if(NearestHostileShip == NULL)
-		{
-			// No target
-			return NULL;
-		}
+	ReachableTarget = PreparedReachableTarget;
+	AnyTarget = PreparedAnyTarget;
+	return true;
+}
 
+bool UFlareTurretPilot::IsShipDangerous(AFlareSpacecraft* ShipCandidate) const
+{
+	return ShipCandidate->GetParent()->IsMilitary() && ShipCandidate->GetParent()->GetDamageSystem()->GetSubsystemHealth(EFlareSubsystem::SYS_Weapon) > 0;
+}
 
-		float Distance = (PilotLocation - NearestHostileShip->GetActorLocation()).Size();
-		if (Distance < SecurityRadius * 100)
-		{
-			TargetPreferences.IgnoreList.Add(NearestHostileShip);
-			NearestHostileShip = NULL;
-			continue;
-		}
 
-		FVector TargetAxis = (NearestHostileShip->GetActorLocation()- PilotLocation).GetUnsafeNormal();
+/*----------------------------------------------------
+	Decision phase
+----------------------------------------------------*/
 
-		if (ReachableOnly && !Turret->IsReacheableAxis(TargetAxis))
-		{
-			TargetPreferences.IgnoreList.Add(NearestHostileShip);
-			NearestHostileShip = NULL;
-			continue;
-		}
-	}
-	return NearestHostileShip;
+bool UFlareTurretPilot::NeedsTargetSelection(float DeltaSeconds) const
+{
+	return TimeUntilNextTargetSelectionReaction <= DeltaSeconds
+		&& !Turret->GetSpacecraft()->GetWeaponsSystem()->IsInFireDirector();
 }
 
-bool UFlareTurretPilot::IsShipDangerous(AFlareSpacecraft* ShipCandidate) const
+void UFlareTurretPilot::GetPreparedTargetPreferences(struct PilotHelper::TargetPreferences& TargetPreferences, float& SecurityRadius) const
 {
-	return ShipCandidate->GetParent()->IsMilitary() && ShipCandidate->GetParent()->GetDamageSystem()->GetSubsystemHealth(EFlareSubsystem::SYS_Weapon) > 0;
+	EFlareCombatTactic::Type Tactic = Turret->GetSpacecraft()->GetParent()->GetCompany()->GetTacticManager()->GetCurrentTacticForShipGroup(EFlareCombatGroup::Capitals);
+	GetTargetPreferences(Tactic, TargetPreferences);
+	SecurityRadius = GetSecurityRadius();
+}
+
+void UFlareTurretPilot::SetPreparedTargets(AFlareSpacecraft* ReachableTarget, AFlareSpacecraft* AnyTarget)
+{
+	PreparedReachableTarget = ReachableTarget;
+	PreparedAnyTarget = AnyTarget;
+	PreparedTargetFrame = GFrameCounter;
+	HasPreparedTargets = true;
 }
 
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Game/FlareGameTypes.h"
+#include "FlarePilotHelper.h"
 #include "FlareTurretPilot.generated.h"
 
 class UFlareTurret;
@@ -53,6 +54,23 @@ public:
 	virtual bool IsShipDangerous(AFlareSpacecraft* ShipCandidate) const;
 
 
+	/*----------------------------------------------------
+		Decision phase
+	----------------------------------------------------*/
+
+	/** Check if the pilot will select a target when it ticks */
+	bool NeedsTargetSelection(float DeltaSeconds) const;
+
+	/** Get the preferences the decision phase should search targets with */
+	void GetPreparedTargetPreferences(struct PilotHelper::TargetPreferences& TargetPreferences, float& SecurityRadius) const;
+
+	/** Search the best target in a combat snapshot. Only reads the snapshot and the turret, so it may run on any thread. */
+	AFlareSpacecraft* SearchTarget(const FFlareCombatSnapshot& Snapshot, int32 CompanyIndex, struct PilotHelper::TargetPreferences TargetPreferences, float SecurityRadius, bool ReachableOnly) const;
+
+	/** Store the targets selected by the decision phase */
+	void SetPreparedTargets(AFlareSpacecraft* ReachableTarget, AFlareSpacecraft* AnyTarget);
+
+
 protected:
 
 	/*----------------------------------------------------
@@ -63,6 +81,15 @@ protected:
 
 	AFlareSpacecraft* GetNearestHostileShip(bool ReachableOnly, EFlareCombatTactic::Type Tactic) const;
 
+	/** Get the target scoring preferences for a tactic */
+	void GetTargetPreferences(EFlareCombatTactic::Type Tactic, struct PilotHelper::TargetPreferences& TargetPreferences) const;
+
+	/** Get the distance under which targets are too close for proximity fuzes */
+	float GetSecurityRadius() const;
+
+	/** Get the targets selected by the decision phase, if still valid */
+	bool ConsumePreparedTargets(AFlareSpacecraft*& ReachableTarget, AFlareSpacecraft*& AnyTarget);
+
 
 protected:
 
@@ -94,6 +121,12 @@ protected:
 	AFlareSpacecraft*                    PilotTargetShip;
 	UFlareSpacecraftComponent*			 PilotTargetComponent;
 
+	// Decision phase results
+	AFlareSpacecraft*                    PreparedReachableTarget;
+	AFlareSpacecraft*                    PreparedAnyTarget;
+	uint64                               PreparedTargetFrame;
+	bool                                 HasPreparedTargets;
+
 
 	/*----------------------------------------------------
 		Helper
@@ -6,12 +6,14 @@
 #include "FlareShell.h"
 #include "FlareBomb.h"
 #include "../Player/FlarePlayerController.h"
+#include "../Game/FlareAllocationStats.h"
 
 DECLARE_CYCLE_STAT(TEXT("FlareWeapon Firing"), STAT_Weapon_Firing, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlareWeapon FireGun"), STAT_Weapon_FireGun, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlareWeapon ConfigureShellFuze"), STAT_Weapon_ConfigureShellFuze, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlareWeapon IsSafeToFire"), STAT_FlareWeapon_IsSafeToFire, STATGROUP_Flare);
 DECLARE_CYCLE_STAT(TEXT("FlareWeapon Trace"), STAT_FlareWeapon_Trace, STATGROUP_Flare);
+DECLARE_DWORD_COUNTER_STAT(TEXT("FlareWeapon Tick allocations"), STAT_FlareWeapon_TickAllocations, STATGROUP_Flare);
 
 
 /*----------------------------------------------------
@@ -77,6 +79,16 @@ void UFlareWeapon::Initialize(FFlareSpacecraftComponentSave* Data, UFlareCompany
 	ProjectileSpawnParams.bNoFail = true;
 	ProjectileSpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
+	// Socket names, so that aiming doesn't build strings
+	MuzzleSocketNames.Empty();
+	if (ComponentDescription)
+	{
+		for (int32 GunIndex = 0; GunIndex < ComponentDescription->WeaponCharacteristics.GunCharacteristics.GunCount; GunIndex++)
+		{
+			MuzzleSocketNames.Add(FName(*(FString("Muzzle") + FString::FromInt(GunIndex))));
+		}
+	}
+
 	// Additional properties
 	LastFiredGun = -1;
 	SetupFiringEffects();
@@ -117,6 +129,7 @@ FFlareSpacecraftComponentSave* UFlareWeapon::Save()
 
 void UFlareWeapon::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
+	SCOPE_FLARE_ALLOCATION_COUNTER(STAT_FlareWeapon_TickAllocations);
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	TimeSinceLastShell += DeltaTime;
@@ -449,15 +462,33 @@ FVector UFlareWeapon::GetMuzzleLocation(int muzzleIndex) const
 {
 	if (ComponentDescription->WeaponCharacteristics.GunCharacteristics.GunCount == 1)
 	{
-		return GetSocketLocation(FName("Muzzle"));
+		return GetSocketLocation(GetMuzzleSocketName(-1));
 	}
 	else
 	{
-		return GetSocketLocation(FName(*(FString("Muzzle") + FString::FromInt(muzzleIndex))));
+		return GetSocketLocation(GetMuzzleSocketName(muzzleIndex));
 	}
 
 }
 
+FName UFlareWeapon::GetMuzzleSocketName(int GunIndex) const
+{
+	static const FName SingleMuzzleSocketName("Muzzle");
+
+	if (GunIndex < 0)
+	{
+		return SingleMuzzleSocketName;
+	}
+	else if (MuzzleSocketNames.IsValidIndex(GunIndex))
+	{
+		return MuzzleSocketNames[GunIndex];
+	}
+	else
+	{
+		return FName(*(FString("Muzzle") + FString::FromInt(GunIndex)));
+	}
+}
+
 int UFlareWeapon::GetGunCount() const
 {
 	return ComponentDescription->WeaponCharacteristics.GunCharacteristics.GunCount;
@@ -51,6 +51,9 @@ public:
 
 	virtual FVector GetMuzzleLocation(int GunIndex) const;
 
+	/** Get the socket of a gun, or of the only gun if the index is negative */
+	FName GetMuzzleSocketName(int GunIndex) const;
+
 	virtual int GetGunCount() const;
 
 	virtual bool IsTurret() const;
@@ -129,6 +132,7 @@ protected:
 	float                       FiringPeriod;
 	float                       AmmoVelocity;
 	FActorSpawnParameters       ProjectileSpawnParams;
+	TArray<FName>               MuzzleSocketNames;
 
 	UPROPERTY()
 	TArray<AFlareBomb*>         Bombs;
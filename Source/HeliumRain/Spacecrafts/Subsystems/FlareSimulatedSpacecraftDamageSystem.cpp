@@ -611,6 +611,8 @@ void UFlareSimulatedSpacecraftDamageSystem::SetPowerDirty()
 void UFlareSimulatedSpacecraftDamageSystem::SetDamageDirty(FFlareSpacecraftComponentDescription* ComponentDescription)
 {
 	DamageDirty = true;
+	Spacecraft->GetCompany()->InvalidateCompanyValue();
+	Spacecraft->GetGame()->GetWorldEvents().Notify(EFlareWorldEvent::Spacecrafts);
 	if(ComponentDescription->GeneralCharacteristics.ElectricSystem)
 	{
 		SetPowerDirty();
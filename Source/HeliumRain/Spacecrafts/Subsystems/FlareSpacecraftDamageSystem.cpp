@@ -36,34 +36,38 @@ void UFlareSpacecraftDamageSystem::TickSystem(float DeltaSeconds)
 
 	Parent->TickSystem();
 
-	// Apply heat variation : add producted heat then substract radiated heat.
+	// Distant ships keep their heat until they are simulated fully again
+	if (Spacecraft->GetSimulationLOD() == EFlareSimulationLOD::Full)
+	{
+		// Apply heat variation : add producted heat then substract radiated heat.
 
-	// Get the to heat production and heat sink surface
-	float HeatProduction = 0.f;
-	float HeatSinkSurface = 0.f;
+		// Get the to heat production and heat sink surface
+		float HeatProduction = 0.f;
+		float HeatSinkSurface = 0.f;
 
-	for (int32 i = 0; i < Components.Num(); i++)
-	{
-		UFlareSpacecraftComponent* Component = Cast<UFlareSpacecraftComponent>(Components[i]);
-		HeatProduction += Component->GetHeatProduction();
-		HeatSinkSurface += Component->GetHeatSinkSurface();
-	}
+		for (int32 i = 0; i < Components.Num(); i++)
+		{
+			UFlareSpacecraftComponent* Component = Cast<UFlareSpacecraftComponent>(Components[i]);
+			HeatProduction += Component->GetHeatProduction();
+			HeatSinkSurface += Component->GetHeatSinkSurface();
+		}
 
-	// Add a part of sun radiation to ship heat production
-	// Sun flow is 3.094KW/m^2 and keep only 10 % and modulate 90% by sun occlusion
-	HeatProduction += HeatSinkSurface * 3.094 * 0.1 * (1 - 0.9 * Spacecraft->GetGame()->GetPlanetarium()->GetSunOcclusion());
+		// Add a part of sun radiation to ship heat production
+		// Sun flow is 3.094KW/m^2 and keep only 10 % and modulate 90% by sun occlusion
+		HeatProduction += HeatSinkSurface * 3.094 * 0.1 * (1 - 0.9 * Spacecraft->GetGame()->GetPlanetarium()->GetSunOcclusion());
 
-	// Heat up
-	Data->Heat += HeatProduction * DeltaSeconds;
-	// Radiate: Stefan-Boltzmann constant=5.670373e-8
-	float Temperature = Data->Heat / Description->HeatCapacity;
-	float HeatRadiation = 0.f;
-	if (Temperature > 0)
-	{
-		HeatRadiation = HeatSinkSurface * 5.670373e-8 * FMath::Pow(Temperature, 4) / 1000;
+		// Heat up
+		Data->Heat += HeatProduction * DeltaSeconds;
+		// Radiate: Stefan-Boltzmann constant=5.670373e-8
+		float Temperature = Data->Heat / Description->HeatCapacity;
+		float HeatRadiation = 0.f;
+		if (Temperature > 0)
+		{
+			HeatRadiation = HeatSinkSurface * 5.670373e-8 * FMath::Pow(Temperature, 4) / 1000;
+		}
+		// Don't radiate too much energy : negative temperature is not possible
+		Data->Heat -= FMath::Min(HeatRadiation * DeltaSeconds, Data->Heat);
 	}
-	// Don't radiate too much energy : negative temperature is not possible
-	Data->Heat -= FMath::Min(HeatRadiation * DeltaSeconds, Data->Heat);
 
 	// Power outage
 	if (Data->PowerOutageDelay > 0)
@@ -196,6 +200,12 @@ void UFlareSpacecraftDamageSystem::UpdatePower()
 		UFlareSpacecraftComponent* Component = Cast<UFlareSpacecraftComponent>(Components[ComponentIndex]);
 		Component->UpdateLight();
 	}
+
+	// Engine thrust depends on damage and power
+	if (Spacecraft->GetNavigationSystem())
+	{
+		Spacecraft->GetNavigationSystem()->InvalidatePropulsion();
+	}
 }
 
 void UFlareSpacecraftDamageSystem::OnSpacecraftDestroyed()
@@ -40,6 +40,7 @@ UFlareSpacecraftNavigationSystem::UFlareSpacecraftNavigationSystem(const class F
 	, LinearMaxDockingVelocity(10)
 	, NegligibleSpeedRatio(0.0005)
 	, HasUsedOrbitalBoost(false)
+	, PropulsionDirty(true)
 {
 	AnticollisionAngle = FMath::FRandRange(0, 360);
 	DockConstraint = NULL;
@@ -56,6 +57,11 @@ void UFlareSpacecraftNavigationSystem::TickSystem(float DeltaSeconds)
 
 	UpdateCOM();
 
+	if (PropulsionDirty)
+	{
+		UpdatePropulsionThrust();
+	}
+
 	// Manual pilot
 	if (IsManualPilot() && Spacecraft->GetParent()->GetDamageSystem()->IsAlive())
 	{
@@ -130,6 +136,7 @@ void UFlareSpacecraftNavigationSystem::Initialize(AFlareSpacecraft* OwnerSpacecr
 void UFlareSpacecraftNavigationSystem::Start()
 {
 	UpdateCOM();
+	UpdatePropulsion();
 }
 
 
@@ -290,15 +297,8 @@ AFlareSpacecraft* UFlareSpacecraftNavigationSystem::GetDockStation()
 {
 	if (IsDocked())
 	{
-		for (int32 SpacecraftIndex = 0; SpacecraftIndex < Spacecraft->GetGame()->GetActiveSector()->GetSpacecrafts().Num(); SpacecraftIndex++)
-		{
-			AFlareSpacecraft* Station = Spacecraft->GetGame()->GetActiveSector()->GetSpacecrafts()[SpacecraftIndex];
-
-			if (Station && Station->GetParent()->GetImmatriculation() == Data->DockedTo)
-			{
-				return Station;
-			}
-		}
+		// Spawns the station if it is still waiting for activation
+		return Spacecraft->GetGame()->GetActiveSector()->FindSpacecraft(Data->DockedTo);
 	}
 	return NULL;
 }
@@ -740,11 +740,9 @@ void UFlareSpacecraftNavigationSystem::ConfirmDock(AFlareSpacecraft* DockStation
 	DockConstraint->SetConstrainedComponents(Spacecraft->Airframe, NAME_None, DockStation->Airframe,NAME_None);
 
 	// Cut engines
-	TArray<UActorComponent*> Engines = Spacecraft->GetComponentsByClass(UFlareEngine::StaticClass());
 	for (int32 EngineIndex = 0; EngineIndex < Engines.Num(); EngineIndex++)
 	{
-		UFlareEngine* Engine = Cast<UFlareEngine>(Engines[EngineIndex]);
-		Engine->SetAlpha(0.0f);
+		Engines[EngineIndex]->SetAlpha(0.0f);
 	}
 
 
@@ -938,8 +936,6 @@ bool UFlareSpacecraftNavigationSystem::UpdateLinearAttitudeAuto(float DeltaSecon
 {
 	SCOPE_CYCLE_COUNTER(STAT_NavigationSystem_UpdateLinearAttitudeAuto);
 
-	TArray<UActorComponent*> Engines = Spacecraft->GetComponentsByClass(UFlareEngine::StaticClass());
-
 	FVector DeltaPosition = (TargetLocation - Spacecraft->GetActorLocation()) / 100; // Distance in meters
 	FVector DeltaPositionDirection = DeltaPosition;
 	DeltaPositionDirection.Normalize();
@@ -958,7 +954,7 @@ bool UFlareSpacecraftNavigationSystem::UpdateLinearAttitudeAuto(float DeltaSecon
 	else
 	{
 
-		FVector Acceleration = GetTotalMaxThrustInAxis(Engines, DeltaVelocityAxis, false) / Spacecraft->GetSpacecraftMass();
+		FVector Acceleration = GetTotalMaxThrustInAxis(DeltaVelocityAxis, false) / Spacecraft->GetSpacecraftMass();
 		float AccelerationInAngleAxis =  FMath::Abs(FVector::DotProduct(Acceleration, DeltaPositionDirection));
 
 		// TODO: Fix security ratio engine flickering
@@ -1025,8 +1021,6 @@ void UFlareSpacecraftNavigationSystem::UpdateAngularAttitudeAuto(float DeltaSeco
 {
 	SCOPE_CYCLE_COUNTER(STAT_NavigationSystem_UpdateAngularAttitudeAuto);
 
-	TArray<UActorComponent*> Engines = Spacecraft->GetComponentsByClass(UFlareEngine::StaticClass());
-
 	// Rotation data
 	FFlareShipCommandData Command;
 	CommandData.Peek(Command);
@@ -1062,7 +1056,7 @@ void UFlareSpacecraftNavigationSystem::UpdateAngularAttitudeAuto(float DeltaSeco
 	else {
 		FVector SimpleAcceleration = DeltaVelocityAxis * AngularAccelerationRate;
 		// Scale with damages
-		float DamageRatio = GetTotalMaxTorqueInAxis(Engines, DeltaVelocityAxis, true) / GetTotalMaxTorqueInAxis(Engines, DeltaVelocityAxis, false);
+		float DamageRatio = GetTotalMaxTorqueInAxis(DeltaVelocityAxis, true) / GetTotalMaxTorqueInAxis(DeltaVelocityAxis, false);
 		FVector DamagedSimpleAcceleration = SimpleAcceleration * DamageRatio;
 
 		FVector Acceleration = DamagedSimpleAcceleration;
@@ -1103,8 +1097,6 @@ FVector UFlareSpacecraftNavigationSystem::GetAngularVelocityToAlignAxis(FVector
 {
 	SCOPE_CYCLE_COUNTER(STAT_NavigationSystem_GetAngularVelocityToAlignAxis);
 
-	TArray<UActorComponent*> Engines = Spacecraft->GetComponentsByClass(UFlareEngine::StaticClass());
-
 	FVector AngularVelocity = Spacecraft->Airframe->GetPhysicsAngularVelocity();
 	FVector WorldShipAxis = Spacecraft->Airframe->GetComponentToWorld().GetRotation().RotateVector(LocalShipAxis);
 
@@ -1129,7 +1121,7 @@ FVector UFlareSpacecraftNavigationSystem::GetAngularVelocityToAlignAxis(FVector
 	else {
 		FVector SimpleAcceleration = DeltaVelocityAxis * GetAngularAccelerationRate();
 		// Scale with damages
-		float DamageRatio = GetTotalMaxTorqueInAxis(Engines, DeltaVelocityAxis, true) / GetTotalMaxTorqueInAxis(Engines, DeltaVelocityAxis, false);
+		float DamageRatio = GetTotalMaxTorqueInAxis(DeltaVelocityAxis, true) / GetTotalMaxTorqueInAxis(DeltaVelocityAxis, false);
 		FVector DamagedSimpleAcceleration = SimpleAcceleration * DamageRatio;
 
 		FVector Acceleration = DamagedSimpleAcceleration;
@@ -1178,15 +1170,12 @@ void UFlareSpacecraftNavigationSystem::PhysicSubTick(float DeltaSeconds)
 {
 	SCOPE_CYCLE_COUNTER(STAT_NavigationSystem_Physics);
 
-	TArray<UActorComponent*> Engines = Spacecraft->GetComponentsByClass(UFlareEngine::StaticClass());
-
 	if(Spacecraft->GetParent()->GetDamageSystem()->IsUncontrollable())
 	{
 		// Shutdown engines
 		for (int32 EngineIndex = 0; EngineIndex < Engines.Num(); EngineIndex++)
 		{
-			UFlareEngine* Engine = Cast<UFlareEngine>(Engines[EngineIndex]);
-			Engine->SetAlpha(0);
+			Engines[EngineIndex]->SetAlpha(0);
 		}
 
 		return;
@@ -1220,7 +1209,7 @@ void UFlareSpacecraftNavigationSystem::PhysicSubTick(float DeltaSeconds)
 	if (!DeltaV.IsNearlyZero())
 	{
 		// First, try without using the boost
-		FVector Acceleration = DeltaVAxis * GetTotalMaxThrustInAxis(Engines, -DeltaVAxis, false).Size() / Spacecraft->GetSpacecraftMass();
+		FVector Acceleration = DeltaVAxis * GetTotalMaxThrustInAxis(-DeltaVAxis, false).Size() / Spacecraft->GetSpacecraftMass();
 
 		float AccelerationDeltaV = Acceleration.Size() * DeltaSeconds;
 
@@ -1228,7 +1217,7 @@ void UFlareSpacecraftNavigationSystem::PhysicSubTick(float DeltaSeconds)
 		// Second, if the not enought trust check with the boost
 		if (UseOrbitalBoost && AccelerationDeltaV < DeltaV.Size() )
 		{
-			FVector AccelerationWithBoost = DeltaVAxis * GetTotalMaxThrustInAxis(Engines, -DeltaVAxis, true).Size() / Spacecraft->GetSpacecraftMass();
+			FVector AccelerationWithBoost = DeltaVAxis * GetTotalMaxThrustInAxis(-DeltaVAxis, true).Size() / Spacecraft->GetSpacecraftMass();
 
 			if (AccelerationWithBoost.Size() > Acceleration.Size())
 			{
@@ -1258,10 +1247,10 @@ void UFlareSpacecraftNavigationSystem::PhysicSubTick(float DeltaSeconds)
 		FVector SimpleAcceleration = DeltaAngularVAxis * AngularAccelerationRate;
 
 		// Scale with damages
-		float TotalMaxTorqueInAxis = GetTotalMaxTorqueInAxis(Engines, DeltaAngularVAxis, false);
+		float TotalMaxTorqueInAxis = GetTotalMaxTorqueInAxis(DeltaAngularVAxis, false);
 		if (!FMath::IsNearlyZero(TotalMaxTorqueInAxis))
 		{
-			float DamageRatio = GetTotalMaxTorqueInAxis(Engines, DeltaAngularVAxis, true) / TotalMaxTorqueInAxis;
+			float DamageRatio = GetTotalMaxTorqueInAxis(DeltaAngularVAxis, true) / TotalMaxTorqueInAxis;
 			FVector DamagedSimpleAcceleration = SimpleAcceleration * DamageRatio;
 			FVector ClampedSimplifiedAcceleration = DamagedSimpleAcceleration.GetClampedToMaxSize(DeltaAngularV.Size() / DeltaSeconds);
 
@@ -1269,11 +1258,21 @@ void UFlareSpacecraftNavigationSystem::PhysicSubTick(float DeltaSeconds)
 		}
 	}
 
-	// Update engine alpha
+	// Distant ships don't show their exhausts
+	if (Spacecraft->GetSimulationLOD() == EFlareSimulationLOD::Reduced)
+	{
+		return;
+	}
+
+	// Update engine alpha, in airframe space
+	const FTransform& AirframeTransform = Spacecraft->Airframe->GetComponentToWorld();
+	FVector LocalDeltaVAxis = AirframeTransform.InverseTransformVectorNoScale(DeltaVAxis);
+	FVector LocalDeltaAngularVAxis = AirframeTransform.InverseTransformVectorNoScale(DeltaAngularVAxis);
+	FVector LocalCOM = AirframeTransform.InverseTransformPositionNoScale(COM);
+
 	for (int32 EngineIndex = 0; EngineIndex < Engines.Num(); EngineIndex++)
 	{
-		UFlareEngine* Engine = Cast<UFlareEngine>(Engines[EngineIndex]);
-		FVector ThrustAxis = Engine->GetThrustAxis();
+		const FVector& ThrustAxis = EngineThrustAxes[EngineIndex];
 		float LinearAlpha = 0;
 		float AngularAlpha = 0;
 
@@ -1283,29 +1282,29 @@ void UFlareSpacecraftNavigationSystem::PhysicSubTick(float DeltaSeconds)
 		}
 		else if (!DeltaV.IsNearlyZero() || !DeltaAngularV.IsNearlyZero())
 		{
-			if(Engine->IsA(UFlareOrbitalEngine::StaticClass()))
+			if(EngineIsOrbital[EngineIndex])
 			{
 				if(HasUsedOrbitalBoost)
 				{
-					LinearAlpha = (-FVector::DotProduct(ThrustAxis, DeltaVAxis) + 0.2) * LinearMasterBoostAlpha;
+					LinearAlpha = (-FVector::DotProduct(ThrustAxis, LocalDeltaVAxis) + 0.2) * LinearMasterBoostAlpha;
 				}
 				AngularAlpha = 0;
 			}
 			else
 			{
-				LinearAlpha = -FVector::DotProduct(ThrustAxis, DeltaVAxis) * LinearMasterAlpha;
-				FVector EngineOffset = (Engine->GetComponentLocation() - COM) / 100;
+				LinearAlpha = -FVector::DotProduct(ThrustAxis, LocalDeltaVAxis) * LinearMasterAlpha;
+				FVector EngineOffset = (EngineLocations[EngineIndex] - LocalCOM) / 100;
 				FVector TorqueDirection = FVector::CrossProduct(EngineOffset, ThrustAxis);
 				TorqueDirection.Normalize();
 
-				if (!DeltaAngularV.IsNearlyZero() && !Engine->IsA(UFlareOrbitalEngine::StaticClass()))
+				if (!DeltaAngularV.IsNearlyZero())
 				{
-					AngularAlpha = -FVector::DotProduct(TorqueDirection, DeltaAngularVAxis);
+					AngularAlpha = -FVector::DotProduct(TorqueDirection, LocalDeltaAngularVAxis);
 				}
 			}
 		}
 
-		Engine->SetAlpha(FMath::Clamp(LinearAlpha + AngularAlpha, 0.0f, 1.0f));
+		Engines[EngineIndex]->SetAlpha(FMath::Clamp(LinearAlpha + AngularAlpha, 0.0f, 1.0f));
 	}
 }
 
@@ -1314,60 +1313,110 @@ void UFlareSpacecraftNavigationSystem::UpdateCOM()
 	COM = Spacecraft->Airframe->GetBodyInstance()->GetCOMPosition();
 }
 
+void UFlareSpacecraftNavigationSystem::UpdatePropulsion()
+{
+	Engines.Empty();
+	EngineLocations.Empty();
+	EngineThrustAxes.Empty();
+	EngineInitialMaxThrusts.Empty();
+	EngineIsOrbital.Empty();
+
+	// Engines don't move on the airframe : store them in airframe space once
+	const FTransform& AirframeTransform = Spacecraft->Airframe->GetComponentToWorld();
+	TArray<UActorComponent*> EngineComponents = Spacecraft->GetComponentsByClass(UFlareEngine::StaticClass());
+	for (int32 EngineIndex = 0; EngineIndex < EngineComponents.Num(); EngineIndex++)
+	{
+		UFlareEngine* Engine = Cast<UFlareEngine>(EngineComponents[EngineIndex]);
+
+		Engines.Add(Engine);
+		EngineLocations.Add(AirframeTransform.InverseTransformPositionNoScale(Engine->GetComponentLocation()));
+		EngineThrustAxes.Add(AirframeTransform.InverseTransformVectorNoScale(Engine->GetThrustAxis()).GetSafeNormal());
+		EngineInitialMaxThrusts.Add(Engine->GetInitialMaxThrust());
+		EngineIsOrbital.Add(Engine->IsA(UFlareOrbitalEngine::StaticClass()));
+	}
+
+	UpdatePropulsionThrust();
+}
+
+void UFlareSpacecraftNavigationSystem::InvalidatePropulsion()
+{
+	PropulsionDirty = true;
+}
+
+void UFlareSpacecraftNavigationSystem::UpdatePropulsionThrust()
+{
+	// Overheat is applied at evaluation time, since it changes every frame
+	EngineMaxThrusts.SetNum(Engines.Num());
+	for (int32 EngineIndex = 0; EngineIndex < Engines.Num(); EngineIndex++)
+	{
+		EngineMaxThrusts[EngineIndex] = EngineInitialMaxThrusts[EngineIndex] * Engines[EngineIndex]->UFlareSpacecraftComponent::GetUsableRatio();
+	}
+
+	PropulsionDirty = false;
+}
+
 
 /*----------------------------------------------------
 		Getters (Attitude)
 ----------------------------------------------------*/
 
-FVector UFlareSpacecraftNavigationSystem::GetTotalMaxThrustInAxis(TArray<UActorComponent*>& Engines, FVector Axis, bool WithOrbitalEngines) const
+FVector UFlareSpacecraftNavigationSystem::GetTotalMaxThrustInAxis(FVector Axis, bool WithOrbitalEngines) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_NavigationSystem_GetTotalMaxThrustInAxis);
 
-	Axis.Normalize();
+	const FTransform& AirframeTransform = Spacecraft->Airframe->GetComponentToWorld();
+	FVector LocalAxis = AirframeTransform.InverseTransformVectorNoScale(Axis);
+	LocalAxis.Normalize();
+
+	float OverheatRatio = 1.0f - Spacecraft->GetDamageSystem()->GetOverheatRatio(0.05);
 	FVector TotalMaxThrust = FVector::ZeroVector;
-	for (int32 i = 0; i < Engines.Num(); i++)
-	{
-		UFlareEngine* Engine = Cast<UFlareEngine>(Engines[i]);
 
-		FVector WorldThrustAxis = Engine->GetThrustAxis();
-		float Ratio = FVector::DotProduct(WorldThrustAxis, Axis);
+	for (int32 EngineIndex = 0; EngineIndex < Engines.Num(); EngineIndex++)
+	{
+		const FVector& ThrustAxis = EngineThrustAxes[EngineIndex];
+		float MaxThrust = EngineMaxThrusts[EngineIndex] * OverheatRatio;
+		float Ratio = FVector::DotProduct(ThrustAxis, LocalAxis);
 
-		if (Engine->IsA(UFlareOrbitalEngine::StaticClass()))
+		if (EngineIsOrbital[EngineIndex])
 		{
 			if(WithOrbitalEngines && Ratio + 0.2 > 0)
 			{
-				TotalMaxThrust += WorldThrustAxis * Engine->GetMaxThrust() * (Ratio + 0.2);
+				TotalMaxThrust += ThrustAxis * MaxThrust * (Ratio + 0.2);
 			}
 		}
 		else
 		{
 			if (Ratio > 0)
 			{
-				TotalMaxThrust += WorldThrustAxis * Engine->GetMaxThrust() * Ratio;
+				TotalMaxThrust += ThrustAxis * MaxThrust * Ratio;
 			}
 		}
 	}
 
-	return TotalMaxThrust;
+	return AirframeTransform.TransformVectorNoScale(TotalMaxThrust);
 }
 
-float UFlareSpacecraftNavigationSystem::GetTotalMaxTorqueInAxis(TArray<UActorComponent*>& Engines, FVector TorqueAxis, bool WithDamages) const
+float UFlareSpacecraftNavigationSystem::GetTotalMaxTorqueInAxis(FVector TorqueAxis, bool WithDamages) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_NavigationSystem_GetTotalMaxTorqueInAxis);
 
-	TorqueAxis.Normalize();
-	float TotalMaxTorque = 0;
+	const FTransform& AirframeTransform = Spacecraft->Airframe->GetComponentToWorld();
+	FVector LocalTorqueAxis = AirframeTransform.InverseTransformVectorNoScale(TorqueAxis);
+	FVector LocalCOM = AirframeTransform.InverseTransformPositionNoScale(COM);
+	LocalTorqueAxis.Normalize();
 
-	for (int32 i = 0; i < Engines.Num(); i++) {
-		UFlareEngine* Engine = Cast<UFlareEngine>(Engines[i]);
+	float OverheatRatio = 1.0f - Spacecraft->GetDamageSystem()->GetOverheatRatio(0.05);
+	float TotalMaxTorque = 0;
 
+	for (int32 EngineIndex = 0; EngineIndex < Engines.Num(); EngineIndex++)
+	{
 		// Ignore orbital engines for torque computation
-		if (Engine->IsA(UFlareOrbitalEngine::StaticClass()))
+		if (EngineIsOrbital[EngineIndex])
 		{
-		  continue;
+			continue;
 		}
 
-		float MaxThrust = (WithDamages ? Engine->GetMaxThrust() : Engine->GetInitialMaxThrust());
+		float MaxThrust = (WithDamages ? EngineMaxThrusts[EngineIndex] * OverheatRatio : EngineInitialMaxThrusts[EngineIndex]);
 
 		if (MaxThrust == 0)
 		{
@@ -1375,20 +1424,16 @@ float UFlareSpacecraftNavigationSystem::GetTotalMaxTorqueInAxis(TArray<UActorCom
 			continue;
 		}
 
-		FVector EngineOffset = (Engine->GetComponentLocation() - COM) / 100;
+		FVector EngineOffset = (EngineLocations[EngineIndex] - LocalCOM) / 100;
+		FVector Torque = FVector::CrossProduct(EngineOffset, EngineThrustAxes[EngineIndex]);
+		FVector TorqueDirection = Torque.GetSafeNormal();
 
-		FVector WorldThrustAxis = Engine->GetThrustAxis();
-		WorldThrustAxis.Normalize();
-		FVector TorqueDirection = FVector::CrossProduct(EngineOffset, WorldThrustAxis);
-		TorqueDirection.Normalize();
-
-		float Ratio = FVector::DotProduct(TorqueAxis, TorqueDirection);
+		float Ratio = FVector::DotProduct(LocalTorqueAxis, TorqueDirection);
 
 		if (Ratio > 0)
 		{
-			TotalMaxTorque += FVector::CrossProduct(EngineOffset, WorldThrustAxis).Size() * MaxThrust * Ratio;
+			TotalMaxTorque += Torque.Size() * MaxThrust * Ratio;
 		}
-
 	}
 
 	return TotalMaxTorque;
@@ -4,6 +4,7 @@
 #include "FlareSpacecraftNavigationSystem.generated.h"
 
 class AFlareSpacecraft;
+class UFlareEngine;
 
 
 
@@ -246,8 +247,17 @@ public:
 	/** Update the ship's center of mass */
 	void UpdateCOM();
 
+	/** Build the propulsion model from the ship's engines */
+	void UpdatePropulsion();
+
+	/** Refresh the engine thrusts on the next tick, after a damage or power change */
+	void InvalidatePropulsion();
+
 protected:
 
+	/** Refresh the engine thrusts from damage and power state */
+	void UpdatePropulsionThrust();
+
 
 	/*----------------------------------------------------
 		Protected data
@@ -286,6 +296,15 @@ protected:
 	bool                                     UseOrbitalBoost;
 	FVector                                  COM;
 
+	// Propulsion model, in airframe space
+	TArray<UFlareEngine*>                    Engines;
+	TArray<FVector>                          EngineLocations;
+	TArray<FVector>                          EngineThrustAxes;
+	TArray<float>                            EngineInitialMaxThrusts;
+	TArray<float>                            EngineMaxThrusts; // With damages, without overheat
+	TArray<bool>                             EngineIsOrbital;
+	bool                                     PropulsionDirty;
+
 
 public:
 
@@ -295,19 +314,23 @@ public:
 
 	/**
 	 * Return the maximum current (with damages) trust the ship can provide in a specific axis.
-	 * Engines : List of engine to use to compute the max thrust
 	 * Axis : Axis of the thurst
 	 * WithObitalEngines : if false, ignore orbitals engines
 	 */
-	FVector GetTotalMaxThrustInAxis(TArray<UActorComponent*>& Engines, FVector Axis, bool WithOrbitalEngines) const;
+	FVector GetTotalMaxThrustInAxis(FVector Axis, bool WithOrbitalEngines) const;
 
 	/**
 	 * Return the maximum torque the ship can provide in a specific axis.
-	 * Engines : List of engine to use to compute the max thrust
 	 * TorqueDirection : Axis of the torque
 	 * WithDamages : if true, use current thrust value and not theorical thrust value
 	 */
-	float GetTotalMaxTorqueInAxis(TArray<UActorComponent*>& Engines, FVector TorqueDirection, bool WithDamages) const;
+	float GetTotalMaxTorqueInAxis(FVector TorqueDirection, bool WithDamages) const;
+
+	/** Get the ship's engines */
+	inline const TArray<UFlareEngine*>& GetEngines() const
+	{
+		return Engines;
+	}
 
 
 	/*----------------------------------------------------
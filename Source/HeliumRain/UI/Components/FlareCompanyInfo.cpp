@@ -362,18 +362,22 @@ FText SFlareCompanyInfo::GetCompanyCombatValue() const
 
 	if (Company)
 	{
-		CompanyValue CompanyValue = Company->GetCompanyValue(NULL, false);
-
-		if (CompanyValue.ArmyCurrentCombatPoints > 0 || CompanyValue.ArmyTotalCombatPoints > 0)
-		{
-			Result = FText::Format(LOCTEXT("CompanyCombatValueFormat", "{0}/{1}"),
-				FText::AsNumber(CompanyValue.ArmyCurrentCombatPoints),
-				FText::AsNumber(CompanyValue.ArmyTotalCombatPoints));
-		}
-		else
+		SFlareCompanyInfo* UnprotectedThis = const_cast<SFlareCompanyInfo*>(this);
+		Result = UnprotectedThis->CompanyCombatValueText.Get(Company->GetGame()->GetWorldEvents(), Company, [this]()
 		{
-			Result = LOCTEXT("CompanyCombatZero", "0");
-		}
+			CompanyValue CompanyValue = Company->GetCompanyValue(NULL, false);
+
+			if (CompanyValue.ArmyCurrentCombatPoints > 0 || CompanyValue.ArmyTotalCombatPoints > 0)
+			{
+				return FText::Format(LOCTEXT("CompanyCombatValueFormat", "{0}/{1}"),
+					FText::AsNumber(CompanyValue.ArmyCurrentCombatPoints),
+					FText::AsNumber(CompanyValue.ArmyTotalCombatPoints));
+			}
+			else
+			{
+				return LOCTEXT("CompanyCombatZero", "0");
+			}
+		});
 	}
 
 	return Result;
@@ -397,7 +401,11 @@ FText SFlareCompanyInfo::GetCompanyValue() const
 
 	if (Company)
 	{
-		Result = FText::AsNumber(UFlareGameTools::DisplayMoney(Company->GetCompanyValue().TotalValue));
+		SFlareCompanyInfo* UnprotectedThis = const_cast<SFlareCompanyInfo*>(this);
+		Result = UnprotectedThis->CompanyValueText.Get(Company->GetGame()->GetWorldEvents(), Company, [this]()
+		{
+			return FText::AsNumber(UFlareGameTools::DisplayMoney(Company->GetCompanyValue().TotalValue));
+		});
 	}
 
 	return Result;
@@ -409,21 +417,25 @@ FText SFlareCompanyInfo::GetCompanyInfo() const
 
 	if (Company)
 	{
-		// Stations
-		int32 CompanyStationCount = Company->GetCompanyStations().Num();
-		FText StationText = FText::Format(LOCTEXT("StationInfoFormat", "{0} {1}"),
-			FText::AsNumber(CompanyStationCount), CompanyStationCount == 1 ? LOCTEXT("Station", "station") : LOCTEXT("Stations", "stations"));
-
-		// Ships
-		int32 CompanyShipCount = Company->GetCompanyShips().Num();
-		FText ShipText = FText::Format(LOCTEXT("ShipInfoFormat", "{0} {1}"),
-			FText::AsNumber(CompanyShipCount), CompanyShipCount == 1 ? LOCTEXT("Ship", "ship") : LOCTEXT("Ships", "ships"));
-		
-		// Full string
-		return FText::Format(LOCTEXT("CompanyInfoFormat", "{0} credits in bank\n{1}, {2} "),
-			FText::AsNumber(UFlareGameTools::DisplayMoney(Company->GetMoney())),
-			StationText,
-			ShipText);
+		SFlareCompanyInfo* UnprotectedThis = const_cast<SFlareCompanyInfo*>(this);
+		Result = UnprotectedThis->CompanyInfoText.Get(Company->GetGame()->GetWorldEvents(), Company, [this]()
+		{
+			// Stations
+			int32 CompanyStationCount = Company->GetCompanyStations().Num();
+			FText StationText = FText::Format(LOCTEXT("StationInfoFormat", "{0} {1}"),
+				FText::AsNumber(CompanyStationCount), CompanyStationCount == 1 ? LOCTEXT("Station", "station") : LOCTEXT("Stations", "stations"));
+
+			// Ships
+			int32 CompanyShipCount = Company->GetCompanyShips().Num();
+			FText ShipText = FText::Format(LOCTEXT("ShipInfoFormat", "{0} {1}"),
+				FText::AsNumber(CompanyShipCount), CompanyShipCount == 1 ? LOCTEXT("Ship", "ship") : LOCTEXT("Ships", "ships"));
+
+			// Full string
+			return FText::Format(LOCTEXT("CompanyInfoFormat", "{0} credits in bank\n{1}, {2} "),
+				FText::AsNumber(UFlareGameTools::DisplayMoney(Company->GetMoney())),
+				StationText,
+				ShipText);
+		});
 	}
 
 	return Result;
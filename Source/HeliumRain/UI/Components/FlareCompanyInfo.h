@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../Flare.h"
+#include "../../Game/FlareWorldEvents.h"
 
 
 class UFlareCompany;
@@ -130,5 +131,10 @@ protected:
 	AFlarePlayerController*                    Player;
 	UFlareCompany*                             Company;
 
+	// Texts built from the company
+	FFlareCachedText                           CompanyValueText;
+	FFlareCachedText                           CompanyInfoText;
+	FFlareCachedText                           CompanyCombatValueText;
+
 
 };
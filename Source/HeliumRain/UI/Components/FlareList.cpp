@@ -8,6 +8,9 @@
 
 #define LOCTEXT_NAMESPACE "FlareList"
 
+// Height above which the list scrolls on its own, so that only the visible rows get widgets
+#define LIST_MAX_HEIGHT 900
+
 
 /*----------------------------------------------------
 	Construct
@@ -111,11 +114,15 @@ void SFlareList::Construct(const FArguments& InArgs)
 				+ SVerticalBox::Slot()
 				.AutoHeight()
 				[
-					SAssignNew(WidgetList, SListView< TSharedPtr<FInterfaceContainer> >)
-					.ListItemsSource(&FilteredObjectList)
-					.SelectionMode(ESelectionMode::Single)
-					.OnGenerateRow(this, &SFlareList::GenerateTargetInfo)
-					.OnSelectionChanged(this, &SFlareList::OnTargetSelected)
+					SNew(SBox)
+					.MaxDesiredHeight(LIST_MAX_HEIGHT)
+					[
+						SAssignNew(WidgetList, SListView< TSharedPtr<FInterfaceContainer> >)
+						.ListItemsSource(&FilteredObjectList)
+						.SelectionMode(ESelectionMode::Single)
+						.OnGenerateRow(this, &SFlareList::GenerateTargetInfo)
+						.OnSelectionChanged(this, &SFlareList::OnTargetSelected)
+					]
 				]
 			]
 		]
@@ -134,41 +141,55 @@ void SFlareList::Construct(const FArguments& InArgs)
 
 void SFlareList::AddFleet(UFlareFleet* Fleet)
 {
-	ObjectList.AddUnique(FInterfaceContainer::New(Fleet));
+	if (FleetItems.Contains(Fleet))
+	{
+		return;
+	}
+
+	TSharedPtr<FInterfaceContainer>* PreviousItem = PreviousFleetItems.Find(Fleet);
+	TSharedPtr<FInterfaceContainer> Item = (PreviousItem ? *PreviousItem : FInterfaceContainer::New(Fleet));
+
+	FleetItems.Add(Fleet, Item);
+	ObjectList.Add(Item);
 }
 
 void SFlareList::AddShip(UFlareSimulatedSpacecraft* Ship)
 {
 	HasShips = true;
-	ObjectList.AddUnique(FInterfaceContainer::New(Ship));
+
+	if (ShipItems.Contains(Ship))
+	{
+		return;
+	}
+
+	TSharedPtr<FInterfaceContainer>* PreviousItem = PreviousShipItems.Find(Ship);
+	TSharedPtr<FInterfaceContainer> Item = (PreviousItem ? *PreviousItem : FInterfaceContainer::New(Ship));
+
+	ShipItems.Add(Ship, Item);
+	ObjectList.Add(Item);
 }
 
 void SFlareList::RefreshList()
 {
 	struct FSortBySize
 	{
-		FORCEINLINE bool operator()(const TSharedPtr<FInterfaceContainer> PtrA, const TSharedPtr<FInterfaceContainer> PtrB) const
+		FORCEINLINE bool operator()(const FFlareListRow& A, const FFlareListRow& B) const
 		{
-			FCHECK(PtrA.IsValid());
-			FCHECK(PtrB.IsValid());
-
-			if (PtrA->FleetPtr)
+			if (A.IsFleet)
 			{
-				if (PtrB->FleetPtr)
+				if (B.IsFleet)
 				{
-					UFlareFleet* PlayerFleet = PtrA->FleetPtr->GetGame()->GetPC()->GetPlayerFleet();
-
-					if (PtrA->FleetPtr == PlayerFleet)
+					if (A.IsPlayerFleet)
 					{
 						return true;
 					}
-					else if (PtrB->FleetPtr == PlayerFleet)
+					else if (B.IsPlayerFleet)
 					{
 						return false;
 					}
 					else
 					{
-						return (PtrA->FleetPtr->GetShips().Num() > PtrB->FleetPtr->GetShips().Num());
+						return (A.FleetShipCount > B.FleetShipCount);
 					}
 				}
 				else
@@ -176,55 +197,52 @@ void SFlareList::RefreshList()
 					return true;
 				}
 			}
-			else if (PtrB->FleetPtr)
+			else if (B.IsFleet)
 			{
 				return false;
 			}
 			else
 			{
-				UFlareSimulatedSpacecraft* A = PtrA->SpacecraftPtr;
-				UFlareSimulatedSpacecraft* B = PtrB->SpacecraftPtr;
-
-				if (A->IsPlayerShip() != B->IsPlayerShip())
+				if (A.IsPlayerShip != B.IsPlayerShip)
 				{
-					return A->IsPlayerShip();
+					return A.IsPlayerShip;
 				}
-				else if (A->IsStation() && B->IsStation())
+				else if (A.IsStation && B.IsStation)
 				{
-					if (A->GetDescription()->IsSubstation && !B->GetDescription()->IsSubstation)
+					if (A.IsSubstation && !B.IsSubstation)
 					{
 						return true;
 					}
-					else if (!A->GetDescription()->IsSubstation && B->GetDescription()->IsSubstation)
+					else if (!A.IsSubstation && B.IsSubstation)
 					{
 						return false;
 					}
 				}
-				else if (A->IsStation() && !B->IsStation())
+				else if (A.IsStation && !B.IsStation)
 				{
 					return true;
 				}
-				else if (!A->IsStation() && B->IsStation())
+				else if (!A.IsStation && B.IsStation)
 				{
 					return false;
 				}
-				else if (A->GetSize() > B->GetSize())
+				else if (A.Size > B.Size)
 				{
 					return true;
 				}
-				else if (A->GetSize() < B->GetSize())
+				else if (A.Size < B.Size)
 				{
 					return false;
 				}
-				else if (A->IsMilitary())
+				else if (A.IsMilitary)
 				{
-					if (!B->IsMilitary())
+					if (!B.IsMilitary)
 					{
 						return true;
 					}
 					else
 					{
-						return A->GetWeaponsSystem()->GetWeaponGroupCount() > B->GetWeaponsSystem()->GetWeaponGroupCount();
+						return A.WeaponGroupCount > B.WeaponGroupCount;
 					}
 				}
 				else
@@ -238,33 +256,49 @@ void SFlareList::RefreshList()
 
 	ClearSelection();
 
-	// Apply filters
-	FilteredObjectList.Empty();
+	// Apply filters on row data
+	UFlareFleet* PlayerFleet = MenuManager->GetPC()->GetPlayerFleet();
+	Rows.Reset();
 	for (auto Object : ObjectList)
 	{
+		FFlareListRow Row;
+		FillRow(Row, Object, PlayerFleet);
+
 		// Ships have three filters
-		if (Object->SpacecraftPtr)
+		if (!Row.IsFleet)
 		{
-			bool IsStation = Object->SpacecraftPtr->IsStation();
-			bool IsMilitary = Object->SpacecraftPtr->IsMilitary();
-
-			if ((IsStation && ShowStationsButton->IsActive())
-			 || (IsMilitary && ShowMilitaryButton->IsActive())
-			 || (!IsStation && !IsMilitary && ShowFreightersButton->IsActive()))
+			if ((Row.IsStation && ShowStationsButton->IsActive())
+			 || (Row.IsMilitary && ShowMilitaryButton->IsActive())
+			 || (!Row.IsStation && !Row.IsMilitary && ShowFreightersButton->IsActive()))
 			{
-				FilteredObjectList.Add(Object);
+				Rows.Add(Row);
 			}
 		}
 
 		// Fleets have no filters
 		else
 		{
-			FilteredObjectList.Add(Object);
+			Rows.Add(Row);
 		}
 	}
 
-	// Sort and update
-	FilteredObjectList.Sort(FSortBySize());
+	// Sort rows
+	Rows.Sort(FSortBySize());
+	FilteredObjectList.Reset();
+	for (const FFlareListRow& Row : Rows)
+	{
+		FilteredObjectList.Add(Row.Item);
+	}
+
+	// Items that were kept may already have a widget, update it instead of building a new one
+	for (auto Object : FilteredObjectList)
+	{
+		UpdateItemWidget(Object);
+	}
+	PreviousShipItems.Empty();
+	PreviousFleetItems.Empty();
+
+	// Update
 	WidgetList->RequestListRefresh();
 	SlatePrepass(FSlateApplicationBase::Get().GetApplicationScale());
 }
@@ -303,8 +337,15 @@ void SFlareList::Reset()
 {
 	HasShips = false;
 
+	// Keep the items until the next refresh, for objects that will be added again
+	PreviousShipItems.Append(ShipItems);
+	PreviousFleetItems.Append(FleetItems);
+	ShipItems.Empty();
+	FleetItems.Empty();
+
 	ObjectList.Empty();
 	FilteredObjectList.Empty();
+	Rows.Empty();
 
 	WidgetList->ClearSelection();
 	WidgetList->RequestListRefresh();
@@ -445,17 +486,66 @@ void SFlareList::OnToggleShowFlags()
 
 void SFlareList::OnShipRemoved(UFlareSimulatedSpacecraft* Ship)
 {
-	for (auto Spacecraft : ObjectList)
+	TSharedPtr<FInterfaceContainer> Item;
+	if (ShipItems.RemoveAndCopyValue(Ship, Item))
 	{
-		if (Spacecraft->SpacecraftPtr == Ship)
+		ObjectList.Remove(Item);
+		FilteredObjectList.Remove(Item);
+		Rows.RemoveAll([&Item](const FFlareListRow& Row)
 		{
-			ObjectList.Remove(Spacecraft);
-			break;
-		}
+			return Row.Item == Item;
+		});
 	}
 
+	// Only the removed row changes, other widgets are kept
+	ClearSelection();
 	PreviousWidget.Reset();
-	RefreshList();
+	WidgetList->RequestListRefresh();
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+void SFlareList::FillRow(FFlareListRow& Row, TSharedPtr<FInterfaceContainer> Item, UFlareFleet* PlayerFleet) const
+{
+	FCHECK(Item.IsValid());
+
+	Row.Item = Item;
+	Row.IsFleet = (Item->FleetPtr != NULL);
+	Row.IsPlayerFleet = (Row.IsFleet && Item->FleetPtr == PlayerFleet);
+	Row.FleetShipCount = (Row.IsFleet ? Item->FleetPtr->GetShips().Num() : 0);
+
+	UFlareSimulatedSpacecraft* Spacecraft = Item->SpacecraftPtr;
+	Row.IsPlayerShip = (Spacecraft && Spacecraft->IsPlayerShip());
+	Row.IsStation = (Spacecraft && Spacecraft->IsStation());
+	Row.IsSubstation = (Spacecraft && Spacecraft->GetDescription()->IsSubstation);
+	Row.IsMilitary = (Spacecraft && Spacecraft->IsMilitary());
+	Row.Size = (Spacecraft ? Spacecraft->GetSize() : 0);
+	Row.WeaponGroupCount = (Row.IsMilitary ? Spacecraft->GetWeaponsSystem()->GetWeaponGroupCount() : 0);
+}
+
+void SFlareList::UpdateItemWidget(TSharedPtr<FInterfaceContainer> Item)
+{
+	TSharedPtr<SFlareListItem> ItemWidget = StaticCastSharedPtr<SFlareListItem>(WidgetList->WidgetFromItem(Item));
+	if (!ItemWidget.IsValid())
+	{
+		return;
+	}
+
+	if (Item->SpacecraftPtr && ItemWidget->GetContainer()->GetContent()->GetTypeAsString() == "SFlareSpacecraftInfo")
+	{
+		TSharedRef<SFlareSpacecraftInfo> SpacecraftInfo = StaticCastSharedRef<SFlareSpacecraftInfo>(ItemWidget->GetContainer()->GetContent());
+		SpacecraftInfo->SetSpacecraft(Item->SpacecraftPtr);
+		SpacecraftInfo->Show();
+	}
+	else if (Item->FleetPtr && ItemWidget->GetContainer()->GetContent()->GetTypeAsString() == "SFlareFleetInfo")
+	{
+		TSharedRef<SFlareFleetInfo> FleetInfo = StaticCastSharedRef<SFlareFleetInfo>(ItemWidget->GetContainer()->GetContent());
+		FleetInfo->SetFleet(Item->FleetPtr);
+		FleetInfo->Show();
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
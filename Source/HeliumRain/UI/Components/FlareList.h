@@ -88,6 +88,32 @@ protected:
 	void OnShipRemoved(UFlareSimulatedSpacecraft* Ship);
 
 
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Sort and filter data of an item, read once per refresh instead of once per comparison */
+	struct FFlareListRow
+	{
+		TSharedPtr<FInterfaceContainer>                          Item;
+		bool                                                     IsFleet;
+		bool                                                     IsPlayerFleet;
+		int32                                                    FleetShipCount;
+		bool                                                     IsPlayerShip;
+		bool                                                     IsStation;
+		bool                                                     IsSubstation;
+		bool                                                     IsMilitary;
+		int32                                                    Size;
+		int32                                                    WeaponGroupCount;
+	};
+
+	/** Fill the sort and filter data of an item */
+	void FillRow(FFlareListRow& Row, TSharedPtr<FInterfaceContainer> Item, UFlareFleet* PlayerFleet) const;
+
+	/** Update the widget of an item that was kept through a refresh */
+	void UpdateItemWidget(TSharedPtr<FInterfaceContainer> Item);
+
+
 protected:
 
 	/*----------------------------------------------------
@@ -103,6 +129,13 @@ protected:
 	TSharedPtr< SListView< TSharedPtr<FInterfaceContainer> > >   WidgetList;
 	TArray< TSharedPtr<FInterfaceContainer> >                    ObjectList;
 	TArray< TSharedPtr<FInterfaceContainer> >                    FilteredObjectList;
+	TArray<FFlareListRow>                                        Rows;
+
+	// Items of the current content, and of the content before the last reset, so that unchanged objects keep their row widget
+	TMap<UFlareSimulatedSpacecraft*, TSharedPtr<FInterfaceContainer>> ShipItems;
+	TMap<UFlareFleet*, TSharedPtr<FInterfaceContainer>>          FleetItems;
+	TMap<UFlareSimulatedSpacecraft*, TSharedPtr<FInterfaceContainer>> PreviousShipItems;
+	TMap<UFlareFleet*, TSharedPtr<FInterfaceContainer>>          PreviousFleetItems;
 	TSharedPtr<FInterfaceContainer>                              SelectedObject;
 	TSharedPtr<SFlareListItem>                                   PreviousWidget;
 
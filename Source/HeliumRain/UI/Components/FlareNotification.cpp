@@ -184,6 +184,11 @@ bool SFlareNotification::IsDuplicate(const FName& OtherTag) const
 	return (OtherTag == Tag);
 }
 
+bool SFlareNotification::IsPinned() const
+{
+	return (NotificationTimeout == 0);
+}
+
 void SFlareNotification::Finish(bool Now)
 {
 	// 1s to finish quietly
@@ -61,6 +61,9 @@ public:
 	/** Check if this notification is similar to... */
 	bool IsDuplicate(const FName& OtherTag) const;
 
+	/** Check if this notification stays until dismissed */
+	bool IsPinned() const;
+
 	/** Complete this notification */
 	void Finish(bool Now = true);
 
@@ -9,6 +9,13 @@
 #define LOCTEXT_NAMESPACE "FlareNotifier"
 
 
+// Maximum number of notifications on screen, the oldest ones being dismissed
+#define NOTIFIER_MAX_NOTIFICATIONS 6
+
+// Maximum number of notifications shown at the end of a batch, the others being summarized
+#define NOTIFIER_MAX_BATCH_NOTIFICATIONS 4
+
+
 /*----------------------------------------------------
 	Construct
 ----------------------------------------------------*/
@@ -17,6 +24,8 @@ void SFlareNotifier::Construct(const FArguments& InArgs)
 {
 	// Data
 	MenuManager = InArgs._MenuManager;
+	QueuedNotificationOrder = 0;
+	BatchDepth = 0;
 	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
 	int32 ObjectiveInfoWidth = 370;
 	FLinearColor ObjectiveColor = Theme.ObjectiveColor;
@@ -98,9 +107,128 @@ void SFlareNotifier::Construct(const FArguments& InArgs)
 ----------------------------------------------------*/
 
 void SFlareNotifier::Notify(FText Text, FText Info, FName Identifier, EFlareNotification::Type Type, bool Pinned, EFlareMenu::Type TargetMenu, FFlareMenuParameterData TargetInfo)
+{
+	if (IsBatching())
+	{
+		QueueNotification(Text, Info, Identifier, Type, Pinned, TargetMenu, TargetInfo);
+	}
+	else
+	{
+		AddNotification(Text, Info, Identifier, Type, Pinned, TargetMenu, TargetInfo);
+	}
+}
+
+void SFlareNotifier::ClearNotifications(FName Identifier, bool Now)
+{
+	if (Identifier != NAME_None)
+	{
+		// Queued notifications would show up later
+		QueuedNotifications.RemoveAll([=](const FFlareQueuedNotification& Queued)
+		{
+			return Queued.Tag == Identifier;
+		});
+	}
+
+	FinishNotifications(Identifier, Now);
+}
+
+void SFlareNotifier::FlushNotifications()
+{
+	QueuedNotifications.Empty();
+
+	for (auto& NotificationEntry : NotificationData)
+	{
+		NotificationEntry->Finish();
+	}
+}
+
+void SFlareNotifier::BeginBatch()
+{
+	if (BatchDepth == 0)
+	{
+		QueuedNotifications.Reset();
+		QueuedNotificationOrder = 0;
+	}
+
+	BatchDepth++;
+}
+
+bool SFlareNotifier::EndBatch(EFlareNotification::Type& MainType)
+{
+	FCHECK(BatchDepth > 0);
+	BatchDepth--;
+	if (BatchDepth > 0 || QueuedNotifications.Num() == 0)
+	{
+		return false;
+	}
+
+	// Pinned notifications first, then quests and military events, then the newest
+	QueuedNotifications.Sort([](const FFlareQueuedNotification& A, const FFlareQueuedNotification& B)
+	{
+		if (A.Pinned != B.Pinned)
+		{
+			return A.Pinned;
+		}
+		else if (A.Type != B.Type)
+		{
+			return A.Type > B.Type;
+		}
+		return A.Order > B.Order;
+	});
+	MainType = QueuedNotifications[0].Type;
+
+	// Pinned notifications are never summarized
+	int32 ShownCount = 0;
+	while (ShownCount < QueuedNotifications.Num()
+		&& (ShownCount < NOTIFIER_MAX_BATCH_NOTIFICATIONS || QueuedNotifications[ShownCount].Pinned))
+	{
+		ShownCount++;
+	}
+
+	// Summary of the other ones, at the bottom
+	int32 HiddenCount = 0;
+	for (int32 Index = ShownCount; Index < QueuedNotifications.Num(); Index++)
+	{
+		HiddenCount += QueuedNotifications[Index].Count;
+	}
+	if (HiddenCount > 0)
+	{
+		AddNotification(FText::Format(LOCTEXT("BatchSummaryFormat", "{0} more events"), FText::AsNumber(HiddenCount)),
+			LOCTEXT("BatchSummaryInfo", "Less important events happened at the same time."),
+			FName("notifier-batch-summary"),
+			EFlareNotification::NT_Info,
+			false,
+			EFlareMenu::MENU_None,
+			FFlareMenuParameterData());
+	}
+
+	// Most important notifications on top
+	for (int32 Index = ShownCount - 1; Index >= 0; Index--)
+	{
+		const FFlareQueuedNotification& Queued = QueuedNotifications[Index];
+		FText Text = Queued.Text;
+		if (Queued.Count > 1)
+		{
+			Text = FText::Format(LOCTEXT("BatchCountFormat", "{0} (x{1})"), Queued.Text, FText::AsNumber(Queued.Count));
+		}
+
+		AddNotification(Text, Queued.Info, Queued.Tag, Queued.Type, Queued.Pinned, Queued.TargetMenu, Queued.TargetInfo);
+	}
+
+	QueuedNotifications.Reset();
+	QueuedNotificationOrder = 0;
+	return true;
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+void SFlareNotifier::AddNotification(FText Text, FText Info, FName Identifier, EFlareNotification::Type Type, bool Pinned, EFlareMenu::Type TargetMenu, FFlareMenuParameterData TargetInfo)
 {
 	// Remove notification with the same tag.
-	ClearNotifications(Identifier, true);
+	FinishNotifications(Identifier, true);
 
 	// Add notification
 	TSharedPtr<SFlareNotification> NotificationEntry;
@@ -121,9 +249,27 @@ void SFlareNotifier::Notify(FText Text, FText Info, FName Identifier, EFlareNoti
 
 	// Store a reference to it
 	NotificationData.Add(NotificationEntry);
+
+	// Dismiss the oldest notifications above the limit
+	int32 ActiveCount = 0;
+	for (auto& Entry : NotificationData)
+	{
+		if (!Entry->IsFinished())
+		{
+			ActiveCount++;
+		}
+	}
+	for (int Index = 0; Index < NotificationData.Num() && ActiveCount > NOTIFIER_MAX_NOTIFICATIONS; Index++)
+	{
+		if (!NotificationData[Index]->IsFinished() && !NotificationData[Index]->IsPinned())
+		{
+			NotificationData[Index]->Finish(false);
+			ActiveCount--;
+		}
+	}
 }
 
-void SFlareNotifier::ClearNotifications(FName Identifier, bool Now)
+void SFlareNotifier::FinishNotifications(FName Identifier, bool Now)
 {
 	if (Identifier != NAME_None)
 	{
@@ -137,12 +283,38 @@ void SFlareNotifier::ClearNotifications(FName Identifier, bool Now)
 	}
 }
 
-void SFlareNotifier::FlushNotifications()
+void SFlareNotifier::QueueNotification(FText Text, FText Info, FName Identifier, EFlareNotification::Type Type, bool Pinned, EFlareMenu::Type TargetMenu, FFlareMenuParameterData TargetInfo)
 {
-	for (auto& NotificationEntry : NotificationData)
+	// Similar notifications share a tag, or have the same text when they have none
+	FFlareQueuedNotification* Queued = QueuedNotifications.FindByPredicate([&](const FFlareQueuedNotification& Candidate)
 	{
-		NotificationEntry->Finish();
+		if (Identifier != NAME_None)
+		{
+			return Candidate.Tag == Identifier;
+		}
+		return Candidate.Tag == NAME_None && Candidate.Type == Type && Candidate.Text.EqualTo(Text);
+	});
+
+	if (Queued)
+	{
+		Queued->Count++;
+		Queued->Pinned |= Pinned;
 	}
+	else
+	{
+		Queued = &QueuedNotifications[QueuedNotifications.AddDefaulted()];
+		Queued->Count = 1;
+		Queued->Pinned = Pinned;
+	}
+
+	// The newest notification replaces the previous ones
+	Queued->Text = Text;
+	Queued->Info = Info;
+	Queued->Tag = Identifier;
+	Queued->Type = Type;
+	Queued->TargetMenu = TargetMenu;
+	Queued->TargetInfo = TargetInfo;
+	Queued->Order = QueuedNotificationOrder++;
 }
 
 
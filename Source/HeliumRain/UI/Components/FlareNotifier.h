@@ -8,6 +8,25 @@ class AFlareMenuManager;
 class SFlareButton;
 
 
+/** Notification waiting for the end of a batch */
+struct FFlareQueuedNotification
+{
+	FText                                           Text;
+	FText                                           Info;
+	FName                                           Tag;
+	EFlareNotification::Type                        Type;
+	bool                                            Pinned;
+	EFlareMenu::Type                                TargetMenu;
+	FFlareMenuParameterData                         TargetInfo;
+
+	/** Number of similar notifications merged into this one */
+	int32                                           Count;
+
+	/** Position of the last merged notification in the batch */
+	int32                                           Order;
+};
+
+
 class SFlareNotifier : public SCompoundWidget
 {
 	/*----------------------------------------------------
@@ -45,6 +64,18 @@ public:
 	/** Remove all notifications from the screen */
 	void FlushNotifications();
 
+	/** Queue notifications instead of showing them, merging similar ones, until the batch ends */
+	void BeginBatch();
+
+	/** Show the most important notifications of the batch, return false if there was none */
+	bool EndBatch(EFlareNotification::Type& MainType);
+
+	/** Check if notifications are being queued */
+	bool IsBatching() const
+	{
+		return BatchDepth > 0;
+	}
+
 
 	/*----------------------------------------------------
 		Callbacks
@@ -58,6 +89,20 @@ public:
 
 protected:
 
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Create a notification widget, finishing the oldest ones above the limit */
+	void AddNotification(FText Text, FText Info, FName Tag, EFlareNotification::Type Type, bool Pinned, EFlareMenu::Type TargetMenu, FFlareMenuParameterData TargetInfo);
+
+	/** Finish the notification widgets with the given tag */
+	void FinishNotifications(FName Tag, bool Now);
+
+	/** Add a notification to the batch, or merge it with a similar one */
+	void QueueNotification(FText Text, FText Info, FName Tag, EFlareNotification::Type Type, bool Pinned, EFlareMenu::Type TargetMenu, FFlareMenuParameterData TargetInfo);
+
+
 	/*----------------------------------------------------
 		Protected data
 	----------------------------------------------------*/
@@ -70,6 +115,11 @@ protected:
 	TArray< TSharedPtr<SFlareNotification> >        NotificationData;
 	TSharedPtr<SVerticalBox>                        NotificationContainer;
 
+	// Batch data
+	TArray<FFlareQueuedNotification>                QueuedNotifications;
+	int32                                           QueuedNotificationOrder;
+	int32                                           BatchDepth;
+
 
 public:
 
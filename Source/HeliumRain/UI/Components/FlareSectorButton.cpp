@@ -25,6 +25,14 @@ void SFlareSectorButton::Construct(const FArguments& InArgs)
 	OnClicked = InArgs._OnClicked;
 	Sector = InArgs._Sector;
 	PlayerCompany = InArgs._PlayerCompany;
+	RefreshState();
+
+	// Battles, fleets and days change what the button shows
+	AFlareMenuManager* MenuManager = AFlareMenuManager::GetSingleton();
+	if (MenuManager)
+	{
+		MenuManager->OnWorldChanged().AddSP(this, &SFlareSectorButton::OnWorldChanged);
+	}
 
 	ChildSlot
 	.VAlign(VAlign_Top)
@@ -79,6 +87,51 @@ void SFlareSectorButton::Construct(const FArguments& InArgs)
 }
 
 
+void SFlareSectorButton::RefreshState()
+{
+	AFlareMenuManager* MenuManager = AFlareMenuManager::GetSingleton();
+
+	State.SectorText = FText();
+	State.FriendlynessColor = FLinearColor::White;
+	State.IsPlayerFleetHere = false;
+
+	// The game may have been unloaded
+	if (Sector.IsValid() && PlayerCompany.IsValid())
+	{
+		FText SectorTitle = Sector->GetSectorName();
+		FText ShipText;
+		FText StationText;
+		FText BattleStatusText;
+
+		if (PlayerCompany->HasVisitedSector(Sector.Get()))
+		{
+			if (Sector->GetSectorStations().Num() > 0)
+			{
+				StationText = Sector->GetSectorStations().Num() == 1 ? LOCTEXT("Station", "{0} station") : LOCTEXT("Stations", "{0} stations");
+				StationText = FText::Format(StationText, FText::AsNumber(Sector->GetSectorStations().Num()));
+			}
+
+			if (Sector->GetSectorShips().Num() > 0)
+			{
+				FText CommaText = (Sector->GetSectorStations().Num() > 0) ? LOCTEXT("Return", "\n") : FText();
+				ShipText = Sector->GetSectorShips().Num() == 1 ? LOCTEXT("Ship", "{0} {1} ship") : LOCTEXT("Ships", "{0} {1} ships");
+				ShipText = FText::Format(ShipText, CommaText, FText::AsNumber(Sector->GetSectorShips().Num()));
+			}
+
+			BattleStatusText = Sector->GetSectorBattleStateText(PlayerCompany.Get());
+		}
+
+		State.SectorText = FText::Format(LOCTEXT("SectorTextFormat", "{0}\n{1}{2}\n{3}"), SectorTitle, StationText, ShipText, BattleStatusText);
+		State.FriendlynessColor = Sector->GetSectorFriendlynessColor(PlayerCompany.Get());
+
+		if (MenuManager)
+		{
+			State.IsPlayerFleetHere = (Sector.Get() == MenuManager->GetPC()->GetPlayerFleet()->GetCurrentSector());
+		}
+	}
+}
+
+
 /*----------------------------------------------------
 	Callbacks
 ----------------------------------------------------*/
@@ -88,9 +141,9 @@ void SFlareSectorButton::OnMouseEnter(const FGeometry& MyGeometry, const FPointe
 	SWidget::OnMouseEnter(MyGeometry, MouseEvent);
 
 	AFlareMenuManager* MenuManager = AFlareMenuManager::GetSingleton();
-	if (MenuManager && Sector)
+	if (MenuManager && Sector.IsValid() && PlayerCompany.IsValid())
 	{
-		FText Status = Sector->GetSectorFriendlynessText(PlayerCompany);
+		FText Status = Sector->GetSectorFriendlynessText(PlayerCompany.Get());
 		FText SectorNameText = FText::Format(LOCTEXT("SectorNameFormat", "{0} ({1})"), Sector->GetSectorName(), Status);
 		MenuManager->ShowTooltip(this, SectorNameText, Sector->GetSectorDescription());
 	}
@@ -107,39 +160,17 @@ void SFlareSectorButton::OnMouseLeave(const FPointerEvent& MouseEvent)
 	}
 }
 
-FText SFlareSectorButton::GetSectorText() const
+void SFlareSectorButton::OnWorldChanged(int32 Events)
 {
-	FText SectorText;
-	FText BattleStatusText;
-	
-	if (Sector)
+	if (Events & (EFlareWorldEvent::Fleets | EFlareWorldEvent::Sectors | EFlareWorldEvent::Day | EFlareWorldEvent::Companies))
 	{
-		FText SectorTitle = Sector->GetSectorName();
-		FText ShipText;
-		FText StationText;
-
-		if (PlayerCompany->HasVisitedSector(Sector))
-		{
-			if (Sector->GetSectorStations().Num() > 0)
-			{
-				StationText = Sector->GetSectorStations().Num() == 1 ? LOCTEXT("Station", "{0} station") : LOCTEXT("Stations", "{0} stations");
-				StationText = FText::Format(StationText, FText::AsNumber(Sector->GetSectorStations().Num()));
-			}
-
-			if (Sector->GetSectorShips().Num() > 0)
-			{
-				FText CommaText = (Sector->GetSectorStations().Num() > 0) ? LOCTEXT("Return", "\n") : FText();
-				ShipText = Sector->GetSectorShips().Num() == 1 ? LOCTEXT("Ship", "{0} {1} ship") : LOCTEXT("Ships", "{0} {1} ships");
-				ShipText = FText::Format(ShipText, CommaText, FText::AsNumber(Sector->GetSectorShips().Num()));
-			}
-
-			BattleStatusText = Sector->GetSectorBattleStateText(PlayerCompany);
-		}
-
-		SectorText = FText::Format(LOCTEXT("SectorTextFormat", "{0}\n{1}{2}\n{3}"), SectorTitle, StationText, ShipText, BattleStatusText);
+		RefreshState();
 	}
+}
 
-	return SectorText;
+FText SFlareSectorButton::GetSectorText() const
+{
+	return State.SectorText;
 }
 
 const FSlateBrush* SFlareSectorButton::GetBackgroundBrush() const
@@ -152,10 +183,9 @@ const FSlateBrush* SFlareSectorButton::GetBackgroundBrush() const
 FSlateColor SFlareSectorButton::GetMainColor() const
 {
 	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
-	AFlareMenuManager* MenuManager = AFlareMenuManager::GetSingleton();
 	FLinearColor Color = FLinearColor::White;
 
-	if (Sector == MenuManager->GetPC()->GetPlayerFleet()->GetCurrentSector())
+	if (State.IsPlayerFleetHere)
 	{
 		Color = Theme.FriendlyColor;
 	}
@@ -170,15 +200,15 @@ FSlateColor SFlareSectorButton::GetBorderColor() const
 	AFlareMenuManager* MenuManager = AFlareMenuManager::GetSingleton();
 	FLinearColor Color = FLinearColor::White;
 
-	if (Sector)
+	if (Sector.IsValid())
 	{
-		if (MenuManager->GetPC()->GetCurrentObjective() && MenuManager->GetPC()->GetCurrentObjective()->IsTarget(Sector))
+		if (MenuManager->GetPC()->GetCurrentObjective() && MenuManager->GetPC()->GetCurrentObjective()->IsTarget(Sector.Get()))
 		{
 			return Theme.ObjectiveColor;
 		}
 		else
 		{
-			Color = Sector->GetSectorFriendlynessColor(PlayerCompany);
+			Color = State.FriendlynessColor;
 		}
 	}
 
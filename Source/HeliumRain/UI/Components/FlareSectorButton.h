@@ -8,6 +8,15 @@ class UFlareCompany;
 class UFlareSimulatedSector;
 
 
+/** What a sector button shows of its sector, refreshed on world changes instead of every paint */
+struct FFlareSectorButtonState
+{
+	FText                          SectorText;
+	FLinearColor                   FriendlynessColor;
+	bool                           IsPlayerFleetHere;
+};
+
+
 class SFlareSectorButton : public SCompoundWidget
 {
 	/*----------------------------------------------------
@@ -35,6 +44,9 @@ public:
 	/** Create the widget */
 	void Construct(const FArguments& InArgs);
 
+	/** Read the sector state again */
+	void RefreshState();
+
 
 protected:
 
@@ -48,6 +60,9 @@ protected:
 	/** Mouse left (tooltip) */
 	virtual void OnMouseLeave(const FPointerEvent& MouseEvent) override;
 
+	/** Refresh the state after a world change */
+	void OnWorldChanged(int32 Events);
+
 	/** Get the text to display */
 	FText GetSectorText() const;
 
@@ -75,8 +90,9 @@ protected:
 	
 	// Data
 	FFlareButtonClicked            OnClicked;
-	UFlareSimulatedSector*         Sector;
-	UFlareCompany*                 PlayerCompany;
+	TWeakObjectPtr<UFlareSimulatedSector> Sector;
+	TWeakObjectPtr<UFlareCompany>  PlayerCompany;
+	FFlareSectorButtonState        State;
 
 	// Slate data
 	TSharedPtr<STextBlock>         TextBlock;
@@ -839,44 +839,52 @@ FSlateColor SFlareSpacecraftInfo::GetTextColor() const
 
 FText SFlareSpacecraftInfo::GetDescription() const
 {
-	// Common text
-	FText DefaultText = LOCTEXT("Default", "UNKNOWN OBJECT");
-
-	// Description builder
-	if (TargetSpacecraftDesc && TargetSpacecraft->IsValidLowLevel())
+	SFlareSpacecraftInfo* UnprotectedThis = const_cast<SFlareSpacecraftInfo*>(this);
+	return UnprotectedThis->DescriptionText.Get(PC->GetGame()->GetWorldEvents(), TargetSpacecraft, [this]()
 	{
-		if(TargetSpacecraft && TargetSpacecraft->IsStation())
-		{
-			return FText::Format(LOCTEXT("DescriptionStationFormat", "(Lv {0})"), FText::AsNumber(TargetSpacecraft->GetLevel()));
-		}
-		else
+		// Common text
+		FText DefaultText = LOCTEXT("Default", "UNKNOWN OBJECT");
+
+		// Description builder
+		if (TargetSpacecraftDesc && TargetSpacecraft->IsValidLowLevel())
 		{
-			return FText::Format(LOCTEXT("DescriptionFormat", "({0})"), TargetSpacecraftDesc->Name);
+			if(TargetSpacecraft && TargetSpacecraft->IsStation())
+			{
+				return FText::Format(LOCTEXT("DescriptionStationFormat", "(Lv {0})"), FText::AsNumber(TargetSpacecraft->GetLevel()));
+			}
+			else
+			{
+				return FText::Format(LOCTEXT("DescriptionFormat", "({0})"), TargetSpacecraftDesc->Name);
+			}
 		}
-	}
 
-	return DefaultText;
+		return DefaultText;
+	});
 }
 
 FText SFlareSpacecraftInfo::GetCombatValue() const
 {
-	FText Result;
-
-	if (TargetSpacecraft->IsValidLowLevel())
+	SFlareSpacecraftInfo* UnprotectedThis = const_cast<SFlareSpacecraftInfo*>(this);
+	return UnprotectedThis->CombatValueText.Get(PC->GetGame()->GetWorldEvents(), TargetSpacecraft, [this]()
 	{
-		if (TargetSpacecraft->GetCombatPoints(true) > 0 || TargetSpacecraft->GetCombatPoints(false) > 0)
-		{
-			Result = FText::Format(LOCTEXT("GetCombatValueFormat", "{0}/{1}"),
-				FText::AsNumber(TargetSpacecraft->GetCombatPoints(true)),
-				FText::AsNumber(TargetSpacecraft->GetCombatPoints(false)));
-		}
-		else
+		FText Result;
+
+		if (TargetSpacecraft->IsValidLowLevel())
 		{
-			Result = LOCTEXT("GetCombatValueZero", "0");
+			if (TargetSpacecraft->GetCombatPoints(true) > 0 || TargetSpacecraft->GetCombatPoints(false) > 0)
+			{
+				Result = FText::Format(LOCTEXT("GetCombatValueFormat", "{0}/{1}"),
+					FText::AsNumber(TargetSpacecraft->GetCombatPoints(true)),
+					FText::AsNumber(TargetSpacecraft->GetCombatPoints(false)));
+			}
+			else
+			{
+				Result = LOCTEXT("GetCombatValueZero", "0");
+			}
 		}
-	}
 
-	return Result;
+		return Result;
+	});
 }
 
 const FSlateBrush* SFlareSpacecraftInfo::GetIcon() const
@@ -995,73 +1003,91 @@ FText SFlareSpacecraftInfo::GetSpacecraftInfo() const
 			DistanceText = LOCTEXT("PlayerShipText", "Player ship - ");
 		}
 
-		// Class text
-		FText ClassText;
-		if (TargetSpacecraft->IsStation())
+		// The distance changes while flying, the rest only with the world
+		SFlareSpacecraftInfo* UnprotectedThis = const_cast<SFlareSpacecraftInfo*>(this);
+		if (DistanceText.ToString() != SpacecraftInfoDistance)
 		{
-			ClassText = FText::FromString(TargetSpacecraft->GetDescription()->Name.ToString() + " - ");
+			UnprotectedThis->SpacecraftInfoDistance = DistanceText.ToString();
+			UnprotectedThis->SpacecraftInfoText.Invalidate();
 		}
-		
-		// Our company
-		UFlareCompany* TargetCompany = TargetSpacecraft->GetCompany();
-		if (TargetCompany && PC && TargetCompany == PC->GetCompany())
+
+		return UnprotectedThis->SpacecraftInfoText.Get(PC->GetGame()->GetWorldEvents(), TargetSpacecraft, [=]()
 		{
-			// Station : show production, if simulated
-			if (TargetSpacecraft->IsStation())
-			{
-				FText ProductionStatusText = FText();
-				TArray<UFlareFactory*>& Factories = TargetSpacecraft->GetFactories();
+			return ComputeSpacecraftInfo(DistanceText);
+		});
+	}
 
-				if (Factories.Num() > 0)
-				{
-					for (int FactoryIndex = 0; FactoryIndex < Factories.Num(); FactoryIndex++)
-					{
-						FText NewLineText = (FactoryIndex > 0) ? FText::FromString("\n") : FText();
-						UFlareFactory* Factory = Factories[FactoryIndex];
-
-						ProductionStatusText = FText::Format(LOCTEXT("ProductionStatusFormat", "{0}{1}{2} : {3}"),
-							ProductionStatusText,
-							NewLineText,
-							Factory->GetDescription()->Name,
-							Factory->GetFactoryStatus());
-					}
-
-					return FText::Format(LOCTEXT("StationInfoFormat", "{0}{1}{2}"),
-						DistanceText,
-						ClassText,
-						ProductionStatusText);
-				}
-				else
+	return FText();
+}
+
+FText SFlareSpacecraftInfo::ComputeSpacecraftInfo(FText DistanceText) const
+{
+	// Class text
+	FText ClassText;
+	if (TargetSpacecraft->IsStation())
+	{
+		ClassText = FText::FromString(TargetSpacecraft->GetDescription()->Name.ToString() + " - ");
+	}
+	
+	// Our company
+	UFlareCompany* TargetCompany = TargetSpacecraft->GetCompany();
+	if (TargetCompany && PC && TargetCompany == PC->GetCompany())
+	{
+		// Station : show production, if simulated
+		if (TargetSpacecraft->IsStation())
+		{
+			FText ProductionStatusText = FText();
+			TArray<UFlareFactory*>& Factories = TargetSpacecraft->GetFactories();
+
+			if (Factories.Num() > 0)
+			{
+				for (int FactoryIndex = 0; FactoryIndex < Factories.Num(); FactoryIndex++)
 				{
-					return FText::Format(LOCTEXT("StationInfoFormatNoFactories", "{0}{1}No factories"),
-						DistanceText,
-						ClassText);
+					FText NewLineText = (FactoryIndex > 0) ? FText::FromString("\n") : FText();
+					UFlareFactory* Factory = Factories[FactoryIndex];
+
+					ProductionStatusText = FText::Format(LOCTEXT("ProductionStatusFormat", "{0}{1}{2} : {3}"),
+						ProductionStatusText,
+						NewLineText,
+						Factory->GetDescription()->Name,
+						Factory->GetFactoryStatus());
 				}
-			}
 
-			// Ship : show fleet info - GetSpacecraftInfoAdditional() will feed the rest
+				return FText::Format(LOCTEXT("StationInfoFormat", "{0}{1}{2}"),
+					DistanceText,
+					ClassText,
+					ProductionStatusText);
+			}
 			else
 			{
-				UFlareFleet* Fleet = TargetSpacecraft->GetCurrentFleet();
-				if (Fleet)
-				{
-					return FText::Format(LOCTEXT("SpacecraftInfoFormat", "{0}{1} - "), DistanceText, Fleet->GetStatusInfo());
-				}
-				return FText();
+				return FText::Format(LOCTEXT("StationInfoFormatNoFactories", "{0}{1}No factories"),
+					DistanceText,
+					ClassText);
 			}
 		}
 
-		// Other company
-		else if (TargetCompany)
+		// Ship : show fleet info - GetSpacecraftInfoAdditional() will feed the rest
+		else
 		{
-			return FText::Format(LOCTEXT("OwnedByFormat", "{0}{1}{2} ({3})"),
-				DistanceText,
-				ClassText,
-				TargetCompany->GetCompanyName(),
-				TargetCompany->GetPlayerHostilityText());
+			UFlareFleet* Fleet = TargetSpacecraft->GetCurrentFleet();
+			if (Fleet)
+			{
+				return FText::Format(LOCTEXT("SpacecraftInfoFormat", "{0}{1} - "), DistanceText, Fleet->GetStatusInfo());
+			}
+			return FText();
 		}
 	}
 
+	// Other company
+	else if (TargetCompany)
+	{
+		return FText::Format(LOCTEXT("OwnedByFormat", "{0}{1}{2} ({3})"),
+			DistanceText,
+			ClassText,
+			TargetCompany->GetCompanyName(),
+			TargetCompany->GetPlayerHostilityText());
+	}
+
 	return FText();
 }
 
@@ -1074,30 +1100,34 @@ FText SFlareSpacecraftInfo::GetSpacecraftInfoAdditional() const
 		return FText();
 	}
 
-	// Fleet info
-	if (TargetSpacecraft && TargetSpacecraft->IsValidLowLevel())
+	SFlareSpacecraftInfo* UnprotectedThis = const_cast<SFlareSpacecraftInfo*>(this);
+	return UnprotectedThis->SpacecraftInfoAdditionalText.Get(PC->GetGame()->GetWorldEvents(), TargetSpacecraft, [this]()
 	{
-		UFlareCompany* TargetCompany = TargetSpacecraft->GetCompany();
-		UFlareFleet* Fleet = TargetSpacecraft->GetCurrentFleet();
-
-		if (TargetCompany && PC && TargetCompany == PC->GetCompany() && !TargetSpacecraft->IsStation() && Fleet)
+		// Fleet info
+		if (TargetSpacecraft && TargetSpacecraft->IsValidLowLevel())
 		{
-			FText FleetAssignedText;
-			if (Fleet->GetCurrentTradeRoute())
+			UFlareCompany* TargetCompany = TargetSpacecraft->GetCompany();
+			UFlareFleet* Fleet = TargetSpacecraft->GetCurrentFleet();
+
+			if (TargetCompany && PC && TargetCompany == PC->GetCompany() && !TargetSpacecraft->IsStation() && Fleet)
 			{
-				FleetAssignedText = FText::Format(LOCTEXT("FleetAssignedFormat", " - {0}"),
-					Fleet->GetCurrentTradeRoute()->GetTradeRouteName());
-			}
+				FText FleetAssignedText;
+				if (Fleet->GetCurrentTradeRoute())
+				{
+					FleetAssignedText = FText::Format(LOCTEXT("FleetAssignedFormat", " - {0}"),
+						Fleet->GetCurrentTradeRoute()->GetTradeRouteName());
+				}
 
-			return FText::Format(LOCTEXT("FleetFormat", "{0} ({1} / {2}){3}"),
-				Fleet->GetFleetName(),
-				FText::AsNumber(Fleet->GetShipCount()),
-				FText::AsNumber(Fleet->GetMaxShipCount()),
-				FleetAssignedText);
+				return FText::Format(LOCTEXT("FleetFormat", "{0} ({1} / {2}){3}"),
+					Fleet->GetFleetName(),
+					FText::AsNumber(Fleet->GetShipCount()),
+					FText::AsNumber(Fleet->GetMaxShipCount()),
+					FleetAssignedText);
+			}
 		}
-	}
 
-	return FText();
+		return FText();
+	});
 }
 
 FSlateColor SFlareSpacecraftInfo::GetAdditionalTextColor() const
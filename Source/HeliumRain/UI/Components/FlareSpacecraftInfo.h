@@ -6,6 +6,7 @@
 #include "../Components/FlareShipStatus.h"
 #include "../../Player/FlarePlayerController.h"
 #include "../../Game/FlareCompany.h"
+#include "../../Game/FlareWorldEvents.h"
 
 
 DECLARE_DELEGATE_OneParam(FFlareObjectRemoved, UFlareSimulatedSpacecraft*)
@@ -143,6 +144,9 @@ public:
 	/** Get the company name or the current fleet's name or the production status */
 	FText GetSpacecraftInfo() const;
 
+	/** Build the spacecraft info after the distance text */
+	FText ComputeSpacecraftInfo(FText DistanceText) const;
+
 	/** Get the current fleet's name */
 	FText GetSpacecraftInfoAdditional() const;
 
@@ -167,6 +171,13 @@ protected:
 	FText                             TargetName;
 	FFlareObjectRemoved               OnRemoved;
 
+	// Texts built from the target
+	FFlareCachedText                  DescriptionText;
+	FFlareCachedText                  CombatValueText;
+	FFlareCachedText                  SpacecraftInfoText;
+	FFlareCachedText                  SpacecraftInfoAdditionalText;
+	FString                           SpacecraftInfoDistance;
+
 	// Slate data (buttons)
 	TSharedPtr<SVerticalBox>          MessageBox;
 	TSharedPtr<SFlareButton>          InspectButton;
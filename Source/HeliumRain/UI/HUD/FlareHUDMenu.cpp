@@ -373,6 +373,14 @@ FText SFlareHUDMenu::GetInfoText() const
 			Result += " - " + BattleText.ToString();
 		}
 
+		// Sector still spawning
+		UFlareSector* ActiveSector = MenuManager->GetPC()->GetGame()->GetActiveSector();
+		if (ActiveSector->IsActivating())
+		{
+			Result += "\n" + FText::Format(LOCTEXT("SectorActivationFormat", "Entering sector ({0}%)"),
+				FText::AsNumber(FMath::RoundToInt(100 * ActiveSector->GetActivationProgress()))).ToString();
+		}
+
 		// Add performance
 		FText PerformanceText = MenuManager->GetPC()->GetNavHUD()->GetPerformanceText();
 		if (PerformanceText.ToString().Len())
@@ -24,6 +24,7 @@ void SFlareCompanyMenu::Construct(const FArguments& InArgs)
 	MenuManager = InArgs._MenuManager;
 	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
 	AFlarePlayerController* PC = MenuManager->GetPC();
+	MenuManager->OnWorldChanged().AddSP(this, &SFlareCompanyMenu::OnWorldChanged);
 	
 	// Build structure
 	ChildSlot
@@ -135,9 +136,35 @@ void SFlareCompanyMenu::Enter(UFlareCompany* Target)
 			const FFlareSpacecraftComponentDescription* PartDesc = PC->GetGame()->GetShipPartsCatalog()->Get("object-safe");
 			PC->GetMenuPawn()->ShowPart(PartDesc);
 		}
-		
+	}
+
+	UpdateShipList();
+	ShipList->SetVisibility(EVisibility::Visible);
+}
+
+void SFlareCompanyMenu::Exit()
+{
+	SetEnabled(false);
+	ShipList->Reset();
+	ShipList->SetVisibility(EVisibility::Collapsed);
+
+	Company = NULL;
+	SetVisibility(EVisibility::Collapsed);
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+void SFlareCompanyMenu::UpdateShipList()
+{
+	ShipList->Reset();
+
+	if (Company)
+	{
 		// Station list
-		TArray<UFlareSimulatedSpacecraft*>& CompanyStations = Target->GetCompanyStations();
+		TArray<UFlareSimulatedSpacecraft*>& CompanyStations = Company->GetCompanyStations();
 		for (int32 i = 0; i < CompanyStations.Num(); i++)
 		{
 			if (CompanyStations[i]->GetDamageSystem()->IsAlive())
@@ -147,7 +174,7 @@ void SFlareCompanyMenu::Enter(UFlareCompany* Target)
 		}
 
 		// Ship list
-		TArray<UFlareSimulatedSpacecraft*>& CompanyShips = Target->GetCompanyShips();
+		TArray<UFlareSimulatedSpacecraft*>& CompanyShips = Company->GetCompanyShips();
 		for (int32 i = 0; i < CompanyShips.Num(); i++)
 		{
 			if (CompanyShips[i]->GetDamageSystem()->IsAlive())
@@ -158,17 +185,14 @@ void SFlareCompanyMenu::Enter(UFlareCompany* Target)
 	}
 
 	ShipList->RefreshList();
-	ShipList->SetVisibility(EVisibility::Visible);
 }
 
-void SFlareCompanyMenu::Exit()
+void SFlareCompanyMenu::OnWorldChanged(int32 Events)
 {
-	SetEnabled(false);
-	ShipList->Reset();
-	ShipList->SetVisibility(EVisibility::Collapsed);
-
-	Company = NULL;
-	SetVisibility(EVisibility::Collapsed);
+	if (IsEnabled() && (Events & (EFlareWorldEvent::Fleets | EFlareWorldEvent::Day)))
+	{
+		UpdateShipList();
+	}
 }
 
 
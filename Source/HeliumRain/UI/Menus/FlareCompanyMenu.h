@@ -41,10 +41,19 @@ public:
 	void Exit();
 
 
-	
-
 protected:
 
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Fill the list of stations and ships */
+	void UpdateShipList();
+
+	/** Refresh the content after a world change */
+	void OnWorldChanged(int32 Events);
+
+
 	/*----------------------------------------------------
 		Protected data
 	----------------------------------------------------*/
@@ -23,6 +23,7 @@ void SFlareFleetMenu::Construct(const FArguments& InArgs)
 	// Data
 	MenuManager = InArgs._MenuManager;
 	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
+	MenuManager->OnWorldChanged().AddSP(this, &SFlareFleetMenu::OnWorldChanged);
 
 	// Setup
 	FleetToAdd = NULL;
@@ -341,6 +342,19 @@ void SFlareFleetMenu::UpdateShipList(UFlareFleet* Fleet)
 	ShipList->RefreshList();
 }
 
+void SFlareFleetMenu::OnWorldChanged(int32 Events)
+{
+	if (IsEnabled() && (Events & (EFlareWorldEvent::Fleets | EFlareWorldEvent::Day)))
+	{
+		// Selections may point to ships that moved
+		FleetToAdd = NULL;
+		ShipToRemove = NULL;
+
+		UpdateShipList(FleetToEdit);
+		UpdateFleetList();
+	}
+}
+
 
 /*----------------------------------------------------
 	Content callbacks
@@ -47,6 +47,10 @@ public:
 
 protected:
 
+	/** Refresh the content after a world change */
+	void OnWorldChanged(int32 Events);
+
+
 	/*----------------------------------------------------
 		Content callbacks
 	----------------------------------------------------*/
@@ -6,7 +6,6 @@
 #include "../../Player/FlareMenuManager.h"
 #include "../../Player/FlarePlayerController.h"
 #include "../../Spacecrafts/FlareSpacecraft.h"
-#include "../Components/FlareSectorButton.h"
 
 
 #define LOCTEXT_NAMESPACE "FlareOrbitalMenu"
@@ -26,6 +25,8 @@ void SFlareOrbitalMenu::Construct(const FArguments& InArgs)
 	// FF setup
 	FastForwardPeriod = 0.5f;
 	FastForwardStopRequested = false;
+	MapCompany = NULL;
+	MenuManager->OnWorldChanged().AddSP(this, &SFlareOrbitalMenu::OnWorldChanged);
 
 	// Build structure
 	ChildSlot
@@ -291,7 +292,6 @@ void SFlareOrbitalMenu::Enter()
 	StopFastForward();
 
 	UpdateMap();
-
 	UpdateTradeRouteList();
 
 	Game->SaveGame(MenuManager->GetPC(), true);
@@ -302,15 +302,19 @@ void SFlareOrbitalMenu::Exit()
 	SetEnabled(false);
 	SetVisibility(EVisibility::Collapsed);
 
+	StopFastForward();
+
+	TradeRouteList->ClearChildren();
+
+	// Closed menus don't follow the world, and the game may be unloaded before the next visit
 	NemaBox->ClearChildren();
 	AnkaBox->ClearChildren();
 	AstaBox->ClearChildren();
 	HelaBox->ClearChildren();
 	AdenaBox->ClearChildren();
-
-	TradeRouteList->ClearChildren();
-
-	StopFastForward();
+	SectorButtons.Empty();
+	MapSectors.Empty();
+	MapCompany = NULL;
 }
 
 void SFlareOrbitalMenu::StopFastForward()
@@ -325,6 +329,9 @@ void SFlareOrbitalMenu::StopFastForward()
 		FastForwardActive = false;
 		Game->SaveGame(MenuManager->GetPC(), true);
 		Game->ActivateCurrentSector();
+
+		// World events didn't refresh the list during the fast forward
+		UpdateTradeRouteList();
 	}
 }
 
@@ -339,11 +346,6 @@ void SFlareOrbitalMenu::Tick(const FGeometry& AllottedGeometry, const double InC
 
 	if (IsEnabled() && MenuManager.IsValid())
 	{
-		for(UFlareSimulatedSector* Sector : MenuManager->GetPC()->GetCompany()->GetKnownSectors())
-		{
-			MenuManager->GetPC()->CheckSectorStateChanges(Sector);
-		}
-
 		// Fast forward every FastForwardPeriod
 		TimeSinceFastForward += InDeltaTime;
 		if (FastForwardActive)
@@ -363,8 +365,64 @@ void SFlareOrbitalMenu::Tick(const FGeometry& AllottedGeometry, const double InC
 	}
 }
 
+void SFlareOrbitalMenu::OnWorldChanged(int32 Events)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	// Battle states only change with the simulation
+	if (Events & (EFlareWorldEvent::Fleets | EFlareWorldEvent::Spacecrafts | EFlareWorldEvent::Day))
+	{
+		for (UFlareSimulatedSector* Sector : MenuManager->GetPC()->GetCompany()->GetKnownSectors())
+		{
+			MenuManager->GetPC()->CheckSectorStateChanges(Sector);
+		}
+	}
+
+	// Sector buttons refresh themselves, the map only changes with discoveries
+	if (Events & EFlareWorldEvent::Sectors)
+	{
+		UpdateMap();
+	}
+
+	// The rest is only refreshed once the fast forward stops
+	if (FastForwardActive)
+	{
+		return;
+	}
+
+	if (Events & (EFlareWorldEvent::Fleets | EFlareWorldEvent::Day))
+	{
+		UpdateTradeRouteList();
+	}
+
+	// Save after each simulated day, as reopening the menu did
+	if (Events & EFlareWorldEvent::Day)
+	{
+		Game->SaveGame(MenuManager->GetPC(), true);
+	}
+}
+
 void SFlareOrbitalMenu::UpdateMap()
 {
+	UFlareCompany* PlayerCompany = MenuManager->GetPC()->GetCompany();
+	TArray<UFlareSimulatedSector*>& KnownSectors = PlayerCompany->GetKnownSectors();
+
+	if (PlayerCompany == MapCompany && KnownSectors == MapSectors)
+	{
+		return;
+	}
+
+	// Another game was loaded
+	if (PlayerCompany != MapCompany)
+	{
+		SectorButtons.Empty();
+		MapCompany = PlayerCompany;
+	}
+	MapSectors = KnownSectors;
+
 	TArray<FFlareSectorCelestialBodyDescription>& OrbitalBodies = Game->GetOrbitalBodies()->OrbitalBodies;
 
 	UpdateMapForBody(NemaBox,  &OrbitalBodies[0]);
@@ -419,21 +477,29 @@ void SFlareOrbitalMenu::UpdateMapForBody(TSharedPtr<SFlarePlanetaryBox> Map, con
 		});
 	KnownSectors.Sort(FSortByAltitudeAndPhase());
 
-	// Add the sectors
+	// Add the sectors, reusing their buttons
 	for (int32 SectorIndex = 0; SectorIndex < KnownSectors.Num(); SectorIndex++)
 	{
 		UFlareSimulatedSector* Sector = KnownSectors[SectorIndex];
-		TSharedPtr<int32> IndexPtr(new int32(MenuManager->GetPC()->GetCompany()->GetKnownSectors().Find(Sector)));
+		TSharedPtr<SFlareSectorButton>& SectorButton = SectorButtons.FindOrAdd(Sector);
+
+		if (!SectorButton.IsValid())
+		{
+			TSharedPtr<int32> IndexPtr(new int32(MenuManager->GetPC()->GetCompany()->GetKnownSectors().Find(Sector)));
+
+			SAssignNew(SectorButton, SFlareSectorButton)
+				.Sector(Sector)
+				.PlayerCompany(MenuManager->GetPC()->GetCompany())
+				.OnClicked(this, &SFlareOrbitalMenu::OnOpenSector, IndexPtr);
+		}
 
 		Map->AddSlot()
 		[
-			SNew(SFlareSectorButton)
-			.Sector(Sector)
-			.PlayerCompany(MenuManager->GetPC()->GetCompany())
-			.OnClicked(this, &SFlareOrbitalMenu::OnOpenSector, IndexPtr)
+			SectorButton.ToSharedRef()
 		];
 	}
 }
+
 void SFlareOrbitalMenu::UpdateTradeRouteList()
 {
 	UFlareCompany* Company = MenuManager->GetPC()->GetCompany();
@@ -4,6 +4,7 @@
 #include "../Components/FlarePlanetaryBox.h"
 #include "../../Game/FlareSimulatedSector.h"
 #include "../Components/FlareButton.h"
+#include "../Components/FlareSectorButton.h"
 
 class AFlareMenuManager;
 
@@ -54,7 +55,7 @@ protected:
 		Drawing
 	----------------------------------------------------*/
 	
-	/** Update the map with new data from the planetarium */
+	/** Lay out the sector buttons again if the known sectors changed */
 	void UpdateMap();
 
 	/** Update the map for a specific celestial body */
@@ -62,6 +63,9 @@ protected:
 
 	/** Generate the trade route list */
 	void UpdateTradeRouteList();
+
+	/** Refresh the content after a world change */
+	void OnWorldChanged(int32 Events);
 	
 
 	/*----------------------------------------------------
@@ -142,5 +146,10 @@ protected:
 	TSharedPtr<SFlarePlanetaryBox>              HelaBox;
 	TSharedPtr<SFlarePlanetaryBox>              AdenaBox;
 	TSharedPtr<SFlareButton>                    FastForwardAuto;
+
+	// Sector buttons, kept while the menu is open
+	TMap<UFlareSimulatedSector*, TSharedPtr<SFlareSectorButton>> SectorButtons;
+	TArray<UFlareSimulatedSector*>              MapSectors;
+	UFlareCompany*                              MapCompany;
 	TSharedPtr<SVerticalBox>                    TradeRouteList;
 };
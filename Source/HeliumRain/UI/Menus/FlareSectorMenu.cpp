@@ -21,6 +21,7 @@ void SFlareSectorMenu::Construct(const FArguments& InArgs)
 	MenuManager = InArgs._MenuManager;
 	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
 	AFlarePlayerController* PC = MenuManager->GetPC();
+	MenuManager->OnWorldChanged().AddSP(this, &SFlareSectorMenu::OnWorldChanged);
 
 	// Build structure
 	ChildSlot
@@ -392,13 +393,48 @@ void SFlareSectorMenu::Enter(UFlareSimulatedSector* Sector)
 	SetVisibility(EVisibility::Visible);
 	AFlarePlayerController* PC = MenuManager->GetPC();
 
+	UpdateSpacecraftLists();
+	OwnedShipList->SetVisibility(EVisibility::Visible);
+	OtherShipList->SetVisibility(EVisibility::Visible);
+
+	UpdateFleetList(PC->GetPlayerFleet());
+}
+
+void SFlareSectorMenu::Exit()
+{
+	SetEnabled(false);
+	TargetSector = NULL;
+
+	OwnedShipList->Reset();
+	OtherShipList->Reset();
+	OwnedReserveShipList->Reset();
+	OtherReserveShipList->Reset();
+	OwnedShipList->SetVisibility(EVisibility::Collapsed);
+	OtherShipList->SetVisibility(EVisibility::Collapsed);
+	SetVisibility(EVisibility::Collapsed);
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+void SFlareSectorMenu::UpdateSpacecraftLists()
+{
+	AFlarePlayerController* PC = MenuManager->GetPC();
+
+	OwnedShipList->Reset();
+	OtherShipList->Reset();
+	OwnedReserveShipList->Reset();
+	OtherReserveShipList->Reset();
+
 	// Known sector
 	if (PC->GetCompany()->HasVisitedSector(TargetSector) || TargetSector->IsTravelSector())
 	{
 		// Add stations
-		for (int32 SpacecraftIndex = 0; SpacecraftIndex < Sector->GetSectorStations().Num(); SpacecraftIndex++)
+		for (int32 SpacecraftIndex = 0; SpacecraftIndex < TargetSector->GetSectorStations().Num(); SpacecraftIndex++)
 		{
-			UFlareSimulatedSpacecraft* StationCandidate = Sector->GetSectorStations()[SpacecraftIndex];
+			UFlareSimulatedSpacecraft* StationCandidate = TargetSector->GetSectorStations()[SpacecraftIndex];
 
 			if (StationCandidate && StationCandidate->GetDamageSystem()->IsAlive())
 			{
@@ -414,9 +450,9 @@ void SFlareSectorMenu::Enter(UFlareSimulatedSector* Sector)
 		}
 
 		// Add ships
-		for (int32 SpacecraftIndex = 0; SpacecraftIndex < Sector->GetSectorShips().Num(); SpacecraftIndex++)
+		for (int32 SpacecraftIndex = 0; SpacecraftIndex < TargetSector->GetSectorShips().Num(); SpacecraftIndex++)
 		{
-			UFlareSimulatedSpacecraft* ShipCandidate = Sector->GetSectorShips()[SpacecraftIndex];
+			UFlareSimulatedSpacecraft* ShipCandidate = TargetSector->GetSectorShips()[SpacecraftIndex];
 
 			if (ShipCandidate && ShipCandidate->GetDamageSystem()->IsAlive())
 			{
@@ -456,10 +492,12 @@ void SFlareSectorMenu::Enter(UFlareSimulatedSector* Sector)
 	OtherShipList->RefreshList();
 	OwnedReserveShipList->RefreshList();
 	OtherReserveShipList->RefreshList();
-	OwnedShipList->SetVisibility(EVisibility::Visible);
-	OtherShipList->SetVisibility(EVisibility::Visible);
+}
+
+void SFlareSectorMenu::UpdateFleetList(UFlareFleet* SelectedFleet)
+{
+	AFlarePlayerController* PC = MenuManager->GetPC();
 
-	// Fleet list
 	FleetList.Empty();
 	int32 FleetCount = PC->GetCompany()->GetCompanyFleets().Num();
 	for (int32 FleetIndex = 0; FleetIndex < FleetCount; FleetIndex++)
@@ -471,21 +509,22 @@ void SFlareSectorMenu::Enter(UFlareSimulatedSector* Sector)
 		}
 	}
 	FleetSelector->RefreshOptions();
-	FleetSelector->SetSelectedItem(PC->GetPlayerFleet());
+
+	// Keep the previous selection if that fleet still exists
+	if (!FleetList.Contains(SelectedFleet))
+	{
+		SelectedFleet = PC->GetPlayerFleet();
+	}
+	FleetSelector->SetSelectedItem(SelectedFleet);
 }
 
-void SFlareSectorMenu::Exit()
+void SFlareSectorMenu::OnWorldChanged(int32 Events)
 {
-	SetEnabled(false);
-	TargetSector = NULL;
-
-	OwnedShipList->Reset();
-	OtherShipList->Reset();
-	OwnedReserveShipList->Reset();
-	OtherReserveShipList->Reset();
-	OwnedShipList->SetVisibility(EVisibility::Collapsed);
-	OtherShipList->SetVisibility(EVisibility::Collapsed);
-	SetVisibility(EVisibility::Collapsed);
+	if (IsEnabled() && TargetSector && (Events & (EFlareWorldEvent::Fleets | EFlareWorldEvent::Sectors | EFlareWorldEvent::Day)))
+	{
+		UpdateSpacecraftLists();
+		UpdateFleetList(FleetSelector->GetSelectedItem());
+	}
 }
 
 
@@ -967,58 +1006,71 @@ FText SFlareSectorMenu::GetSectorLocation() const
 
 	if (IsEnabled() && TargetSector)
 	{
-		FFlareCelestialBody* Body = TargetSector->GetGame()->GetGameWorld()->GetPlanerarium()->FindCelestialBody(TargetSector->GetOrbitParameters()->CelestialBodyIdentifier);
-
-		if (Body)
+		SFlareSectorMenu* UnprotectedThis = const_cast<SFlareSectorMenu*>(this);
+		Result = UnprotectedThis->SectorLocationText.Get(MenuManager->GetGame()->GetWorldEvents(), TargetSector, [this]()
 		{
-			FText LightRatioString;
-			FString AttributeString;
+			return ComputeSectorLocation();
+		});
+	}
 
-			// Light ratio
-			if (TargetSector->GetDescription()->IsSolarPoor)
-			{
-				LightRatioString = LOCTEXT("SectorLightRatioFoggy", "0%");
-				AttributeString += LOCTEXT("Dusty", "Dusty").ToString();
-			}
-			else
-			{
-				int32 LightRatio = 100 * TargetSector->GetGame()->GetGameWorld()->GetPlanerarium()->GetLightRatio(Body, TargetSector->GetOrbitParameters()->Altitude);
-				LightRatioString = FText::Format(LOCTEXT("SectorLightRatioFormat", "{0}%"), FText::AsNumber(LightRatio));
-			}
+	return Result;
+}
 
-			// Icy
-			if (TargetSector->GetDescription()->IsIcy)
-			{
-				if (AttributeString.Len())
-				{
-					AttributeString += ", ";
-				}
-				AttributeString += LOCTEXT("Icy", "Icy").ToString();
-			}
+FText SFlareSectorMenu::ComputeSectorLocation() const
+{
+	FText Result;
+
+	FFlareCelestialBody* Body = TargetSector->GetGame()->GetGameWorld()->GetPlanerarium()->FindCelestialBody(TargetSector->GetOrbitParameters()->CelestialBodyIdentifier);
+
+	if (Body)
+	{
+		FText LightRatioString;
+		FString AttributeString;
+
+		// Light ratio
+		if (TargetSector->GetDescription()->IsSolarPoor)
+		{
+			LightRatioString = LOCTEXT("SectorLightRatioFoggy", "0%");
+			AttributeString += LOCTEXT("Dusty", "Dusty").ToString();
+		}
+		else
+		{
+			int32 LightRatio = 100 * TargetSector->GetGame()->GetGameWorld()->GetPlanerarium()->GetLightRatio(Body, TargetSector->GetOrbitParameters()->Altitude);
+			LightRatioString = FText::Format(LOCTEXT("SectorLightRatioFormat", "{0}%"), FText::AsNumber(LightRatio));
+		}
 
-			// Geostationary
-			if (TargetSector->GetDescription()->IsGeostationary)
+		// Icy
+		if (TargetSector->GetDescription()->IsIcy)
+		{
+			if (AttributeString.Len())
 			{
-				if (AttributeString.Len())
-				{
-					AttributeString += ", ";
-				}
-				AttributeString += LOCTEXT("Geostationary", "Geostationary").ToString();
+				AttributeString += ", ";
 			}
+			AttributeString += LOCTEXT("Icy", "Icy").ToString();
+		}
 
-			// Spacer
+		// Geostationary
+		if (TargetSector->GetDescription()->IsGeostationary)
+		{
 			if (AttributeString.Len())
 			{
-				AttributeString = "- " + AttributeString;
+				AttributeString += ", ";
 			}
+			AttributeString += LOCTEXT("Geostationary", "Geostationary").ToString();
+		}
 
-			// Result
-			Result = FText::Format(LOCTEXT("SectorLocation",  "Orbiting {0} - Altitude: {1} km - {2} light {3}"),
-				Body->Name,
-				FText::AsNumber(TargetSector->GetOrbitParameters()->Altitude),
-				LightRatioString,
-				FText::FromString(AttributeString));
+		// Spacer
+		if (AttributeString.Len())
+		{
+			AttributeString = "- " + AttributeString;
 		}
+
+		// Result
+		Result = FText::Format(LOCTEXT("SectorLocation",  "Orbiting {0} - Altitude: {1} km - {2} light {3}"),
+			Body->Name,
+			FText::AsNumber(TargetSector->GetOrbitParameters()->Altitude),
+			LightRatioString,
+			FText::FromString(AttributeString));
 	}
 
 	return Result;
@@ -1035,19 +1087,23 @@ FText SFlareSectorMenu::GetOwnCombatValue() const
 
 	if (IsEnabled() && TargetSector)
 	{
-		UFlareCompany* PlayerCompany = MenuManager->GetPC()->GetCompany();
-		CompanyValue Value = PlayerCompany->GetCompanyValue(TargetSector, false);
-
-		if (Value.ArmyCurrentCombatPoints > 0 || Value.ArmyTotalCombatPoints > 0)
-		{
-			Result = FText::Format(LOCTEXT("CombatValueFormat", "{0}/{1}"),
-				FText::AsNumber(Value.ArmyCurrentCombatPoints),
-				FText::AsNumber(Value.ArmyTotalCombatPoints));
-		}
-		else
+		SFlareSectorMenu* UnprotectedThis = const_cast<SFlareSectorMenu*>(this);
+		Result = UnprotectedThis->OwnCombatValueText.Get(MenuManager->GetGame()->GetWorldEvents(), TargetSector, [this]()
 		{
-			Result = LOCTEXT("CombatValueZero", "0");
-		}
+			UFlareCompany* PlayerCompany = MenuManager->GetPC()->GetCompany();
+			CompanyValue Value = PlayerCompany->GetCompanyValue(TargetSector, false);
+
+			if (Value.ArmyCurrentCombatPoints > 0 || Value.ArmyTotalCombatPoints > 0)
+			{
+				return FText::Format(LOCTEXT("CombatValueFormat", "{0}/{1}"),
+					FText::AsNumber(Value.ArmyCurrentCombatPoints),
+					FText::AsNumber(Value.ArmyTotalCombatPoints));
+			}
+			else
+			{
+				return LOCTEXT("CombatValueZero", "0");
+			}
+		});
 	}
 
 	return Result;
@@ -1059,19 +1115,23 @@ FText SFlareSectorMenu::GetFullCombatValue() const
 
 	if (IsEnabled() && TargetSector)
 	{
-		int32 AllPoints = SectorHelper::GetArmyCombatPoints(TargetSector, false);
-		int32 CurrentAllPoints = SectorHelper::GetArmyCombatPoints(TargetSector, true);
-
-		if (CurrentAllPoints > 0 || AllPoints > 0)
+		SFlareSectorMenu* UnprotectedThis = const_cast<SFlareSectorMenu*>(this);
+		Result = UnprotectedThis->FullCombatValueText.Get(MenuManager->GetGame()->GetWorldEvents(), TargetSector, [this]()
 		{
-			Result = FText::Format(LOCTEXT("CombatValueFormat", "{0}/{1}"),
-				FText::AsNumber(CurrentAllPoints),
-				FText::AsNumber(AllPoints));
-		}
-		else
-		{
-			Result = LOCTEXT("CombatValueZero", "0");
-		}
+			int32 AllPoints = SectorHelper::GetArmyCombatPoints(TargetSector, false);
+			int32 CurrentAllPoints = SectorHelper::GetArmyCombatPoints(TargetSector, true);
+
+			if (CurrentAllPoints > 0 || AllPoints > 0)
+			{
+				return FText::Format(LOCTEXT("CombatValueFormat", "{0}/{1}"),
+					FText::AsNumber(CurrentAllPoints),
+					FText::AsNumber(AllPoints));
+			}
+			else
+			{
+				return LOCTEXT("CombatValueZero", "0");
+			}
+		});
 	}
 
 	return Result;
@@ -1083,20 +1143,24 @@ FText SFlareSectorMenu::GetHostileCombatValue() const
 
 	if (IsEnabled() && TargetSector)
 	{
-		UFlareCompany* PlayerCompany = MenuManager->GetPC()->GetCompany();
-		int32 HostilePoints = SectorHelper::GetHostileArmyCombatPoints(TargetSector, PlayerCompany, false);
-		int32 CurrentHostilePoints = SectorHelper::GetHostileArmyCombatPoints(TargetSector, PlayerCompany, true);
-
-		if (CurrentHostilePoints > 0 || HostilePoints > 0)
-		{
-			Result = FText::Format(LOCTEXT("CombatValueFormat", "{0}/{1}"),
-				FText::AsNumber(CurrentHostilePoints),
-				FText::AsNumber(HostilePoints));
-		}
-		else
+		SFlareSectorMenu* UnprotectedThis = const_cast<SFlareSectorMenu*>(this);
+		Result = UnprotectedThis->HostileCombatValueText.Get(MenuManager->GetGame()->GetWorldEvents(), TargetSector, [this]()
 		{
-			Result = LOCTEXT("CombatValueZero", "0");
-		}
+			UFlareCompany* PlayerCompany = MenuManager->GetPC()->GetCompany();
+			int32 HostilePoints = SectorHelper::GetHostileArmyCombatPoints(TargetSector, PlayerCompany, false);
+			int32 CurrentHostilePoints = SectorHelper::GetHostileArmyCombatPoints(TargetSector, PlayerCompany, true);
+
+			if (CurrentHostilePoints > 0 || HostilePoints > 0)
+			{
+				return FText::Format(LOCTEXT("CombatValueFormat", "{0}/{1}"),
+					FText::AsNumber(CurrentHostilePoints),
+					FText::AsNumber(HostilePoints));
+			}
+			else
+			{
+				return LOCTEXT("CombatValueZero", "0");
+			}
+		});
 	}
 
 	return Result;
@@ -40,6 +40,20 @@ public:
 
 protected:
 
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Fill the station and ship lists of the target sector */
+	void UpdateSpacecraftLists();
+
+	/** Fill the fleet selector, keeping a fleet selected if possible */
+	void UpdateFleetList(UFlareFleet* SelectedFleet);
+
+	/** Refresh the content after a world change */
+	void OnWorldChanged(int32 Events);
+
+
 	/*----------------------------------------------------
 		Content callbacks
 	----------------------------------------------------*/
@@ -95,6 +109,9 @@ protected:
 	/** Get the sector's location */
 	FText GetSectorLocation() const;
 
+	/** Build the sector's location */
+	FText ComputeSectorLocation() const;
+
 	/** Get the combat value visibility */
 	EVisibility GetCombatValueVisibility() const;
 
@@ -158,6 +175,12 @@ protected:
 	TSharedPtr<SFlareList>                     OtherReserveShipList;
 	UFlareSimulatedSector*                     TargetSector;
 
+	// Texts built from the sector
+	FFlareCachedText                           SectorLocationText;
+	FFlareCachedText                           OwnCombatValueText;
+	FFlareCachedText                           FullCombatValueText;
+	FFlareCachedText                           HostileCombatValueText;
+
 	// Station data
 	FFlareSpacecraftDescription*               StationDescription;
 
@@ -17,6 +17,8 @@
 void SFlareWorldEconomyMenu::Construct(const FArguments& InArgs)
 {
 	MenuManager = InArgs._MenuManager;
+	StatsDate = -1;
+	MenuManager->OnWorldChanged().AddSP(this, &SFlareWorldEconomyMenu::OnWorldChanged);
 	const FFlareStyleCatalog& Theme = FFlareStyleSet::GetDefaultTheme();
 
 	// Build structure
@@ -317,7 +319,7 @@ void SFlareWorldEconomyMenu::Enter(FFlareResourceDescription* Resource, UFlareSi
 	{
 		TargetResource = Resource;
 	}
-	WorldStats = WorldHelper::ComputeWorldResourceStats(MenuManager->GetGame());
+	UpdateResourceStats();
 
 	// Update resource selector
 	ResourceSelector->RefreshOptions();
@@ -515,6 +517,46 @@ void SFlareWorldEconomyMenu::Exit()
 	SetEnabled(false);
 	SetVisibility(EVisibility::Collapsed);
 	SectorList->ClearChildren();
+	SectorStats.Empty();
+}
+
+
+/*----------------------------------------------------
+	Internal
+----------------------------------------------------*/
+
+void SFlareWorldEconomyMenu::UpdateResourceStats()
+{
+	WorldStats = WorldHelper::ComputeWorldResourceStats(MenuManager->GetGame());
+
+	SectorStats.Reset();
+	for (UFlareSimulatedSector* Sector : MenuManager->GetPC()->GetCompany()->GetVisitedSectors())
+	{
+		SectorStats.Add(Sector, SectorHelper::ComputeSectorResourceStats(Sector));
+	}
+
+	StatsDate = MenuManager->GetGame()->GetGameWorld()->GetDate();
+}
+
+const WorldHelper::FlareResourceStats* SFlareWorldEconomyMenu::GetSectorResourceStats(UFlareSimulatedSector* Sector) const
+{
+	if (StatsDate != MenuManager->GetGame()->GetGameWorld()->GetDate())
+	{
+		SFlareWorldEconomyMenu* UnprotectedThis = const_cast<SFlareWorldEconomyMenu*>(this);
+		UnprotectedThis->UpdateResourceStats();
+	}
+
+	const TMap<FFlareResourceDescription*, WorldHelper::FlareResourceStats>* Stats = SectorStats.Find(Sector);
+	return (Stats ? Stats->Find(TargetResource) : NULL);
+}
+
+void SFlareWorldEconomyMenu::OnWorldChanged(int32 Events)
+{
+	if (IsEnabled() && (Events & (EFlareWorldEvent::Cargo | EFlareWorldEvent::Sectors | EFlareWorldEvent::Day)))
+	{
+		UpdateResourceStats();
+		GenerateSectorList();
+	}
 }
 
 
@@ -643,9 +685,12 @@ FText SFlareWorldEconomyMenu::GetResourceProductionInfo(UFlareSimulatedSector* S
 		FNumberFormattingOptions Format;
 		Format.MaximumFractionalDigits = 1;
 
-		TMap<FFlareResourceDescription*, WorldHelper::FlareResourceStats> Stats = SectorHelper::ComputeSectorResourceStats(Sector);
-		return FText::Format(LOCTEXT("ResourceMainProductionFormat", "{0}"),
-			FText::AsNumber(Stats[TargetResource].Production, &Format));
+		const WorldHelper::FlareResourceStats* Stats = GetSectorResourceStats(Sector);
+		if (Stats)
+		{
+			return FText::Format(LOCTEXT("ResourceMainProductionFormat", "{0}"),
+				FText::AsNumber(Stats->Production, &Format));
+		}
 	}
 
 	return FText();
@@ -658,9 +703,12 @@ FText SFlareWorldEconomyMenu::GetResourceConsumptionInfo(UFlareSimulatedSector*
 		FNumberFormattingOptions Format;
 		Format.MaximumFractionalDigits = 1;
 
-		TMap<FFlareResourceDescription*, WorldHelper::FlareResourceStats> Stats = SectorHelper::ComputeSectorResourceStats(Sector);
-		return FText::Format(LOCTEXT("ResourceMainConsumptionFormat", "{0}"),
-			FText::AsNumber(Stats[TargetResource].Consumption, &Format));
+		const WorldHelper::FlareResourceStats* Stats = GetSectorResourceStats(Sector);
+		if (Stats)
+		{
+			return FText::Format(LOCTEXT("ResourceMainConsumptionFormat", "{0}"),
+				FText::AsNumber(Stats->Consumption, &Format));
+		}
 	}
 
 	return FText();
@@ -670,9 +718,12 @@ FText SFlareWorldEconomyMenu::GetResourceStockInfo(UFlareSimulatedSector* Sector
 {
 	if (TargetResource)
 	{
-		TMap<FFlareResourceDescription*, WorldHelper::FlareResourceStats> Stats = SectorHelper::ComputeSectorResourceStats(Sector);
-		return FText::Format(LOCTEXT("ResourceMainStockFormat", "{0}"),
-			FText::AsNumber(Stats[TargetResource].Stock));
+		const WorldHelper::FlareResourceStats* Stats = GetSectorResourceStats(Sector);
+		if (Stats)
+		{
+			return FText::Format(LOCTEXT("ResourceMainStockFormat", "{0}"),
+				FText::AsNumber(Stats->Stock));
+		}
 	}
 
 	return FText();
@@ -683,10 +734,12 @@ FText SFlareWorldEconomyMenu::GetResourceCapacityInfo(UFlareSimulatedSector* Sec
 {
 	if (TargetResource)
 	{
-
-		TMap<FFlareResourceDescription*, WorldHelper::FlareResourceStats> Stats = SectorHelper::ComputeSectorResourceStats(Sector);
-		return FText::Format(LOCTEXT("ResourceMainCapacityFormat", "{0}"),
-			FText::AsNumber(Stats[TargetResource].Capacity));
+		const WorldHelper::FlareResourceStats* Stats = GetSectorResourceStats(Sector);
+		if (Stats)
+		{
+			return FText::Format(LOCTEXT("ResourceMainCapacityFormat", "{0}"),
+				FText::AsNumber(Stats->Capacity));
+		}
 	}
 
 	return FText();
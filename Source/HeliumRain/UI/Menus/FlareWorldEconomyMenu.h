@@ -46,6 +46,20 @@ public:
 
 protected:
 
+	/*----------------------------------------------------
+		Internal
+	----------------------------------------------------*/
+
+	/** Compute the resource stats of the world and of every visited sector */
+	void UpdateResourceStats();
+
+	/** Get the stats of the target resource in a sector, computed again when the day changes */
+	const WorldHelper::FlareResourceStats* GetSectorResourceStats(UFlareSimulatedSector* Sector) const;
+
+	/** Refresh the content after a world change */
+	void OnWorldChanged(int32 Events);
+
+
 	/*----------------------------------------------------
 		Callbacks
 	----------------------------------------------------*/
@@ -109,6 +123,8 @@ protected:
 	TWeakObjectPtr<class AFlareMenuManager>         MenuManager;
 	FFlareResourceDescription*                      TargetResource;
 	TMap<FFlareResourceDescription*, WorldHelper::FlareResourceStats> WorldStats;
+	TMap<UFlareSimulatedSector*, TMap<FFlareResourceDescription*, WorldHelper::FlareResourceStats>> SectorStats;
+	int64                                           StatsDate;
 
 	// Slate data
 	TSharedPtr<SVerticalBox>                        SectorList;